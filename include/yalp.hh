@@ -68,7 +68,10 @@ enum Type {
   TT_HASH_TABLE,
   TT_STREAM,
   TT_MACRO,
+  TT_WEAK_REF,
   TT_BOX,  // TODO: This label should not be public, so hide this.
+  TT_CODE,  // Linked code, also internal.
+  TT_GLOBAL_CELL,  // Global variable binding, also internal.
   NUMBER_OF_TYPES,
 };
 
@@ -87,6 +90,10 @@ public:
   inline Fixnum toFixnum() const;
 #ifndef DISABLE_FLONUM
   Flonum toFlonum(State* state) const;
+#endif
+#ifdef IMMEDIATE_FLONUM
+  // Creates flonum without heap allocation, returns false if it can't.
+  static bool immediateFlonum(Flonum f, Value* pValue);
 #endif
   inline bool isObject() const;
   inline Object* toObject() const;
@@ -102,6 +109,8 @@ public:
   unsigned int calcHash(State* state) const;
 
   void mark();
+  // Whether the value is kept in running GC, non object always is.
+  bool isMarked() const;
 
   static const Value NIL;
 
@@ -111,17 +120,70 @@ public:
 private:
   void outputSymbol(State* state, Stream* o) const;
   void outputCharacter(Stream* o, bool inspect) const;
+#ifdef IMMEDIATE_FLONUM
+  Flonum getImmediateFlonum() const;
+#endif
 
   Fixnum v_;
 };
 
 typedef Value (*NativeFuncType)(State* state);
 
+// GC statistics, see `State::getGcStats`. Times are in microseconds, and
+// bytes of objects are sizes of their slots.
+struct GcStats {
+  // Pause histogram: under 100us, 1ms, 10ms, 100ms, 1s, and the rest.
+  enum { PAUSE_BUCKETS = 6 };
+
+  long minorCount;
+  long fullCount;  // Including finished incremental cycles.
+  long stepCount;  // Pauses of incremental full GC.
+  long totalPauseUsec;
+  long maxPauseUsec;
+  long pauseHistogram[PAUSE_BUCKETS];
+
+  size_t heapBytes;  // Same as `State::getHeapBytes`.
+  size_t totalAllocatedBytes;  // Objects and non managed memory.
+  // Allocated bytes per second, since last full GC.
+  double allocationRate;
+
+  // Allocated objects for each type, since the state is created.
+  size_t allocatedObjects[NUMBER_OF_TYPES];
+  size_t allocatedBytes[NUMBER_OF_TYPES];
+  // Live objects for each type, counted in sweep of last full GC.
+  size_t liveObjects[NUMBER_OF_TYPES];
+  size_t liveBytes[NUMBER_OF_TYPES];
+};
+
+// Passed to GC callback, when a GC finishes.
+struct GcEvent {
+  enum Kind {
+    MINOR,
+    FULL,
+    INCREMENTAL,  // Incremental full GC, at the end of its cycle.
+  };
+
+  Kind kind;
+  long pauseUsec;  // Sum of steps for incremental one.
+  size_t heapBytesBefore;
+  size_t heapBytesAfter;
+};
+
+// Called after each GC, it must not allocate objects.
+typedef void (*GcCallback)(State* state, const GcEvent* event, void* userdata);
+
 // State class.
 class State {
 public:
   static State* create();
   static State* create(AllocFunc allocFunc);
+  // Full GC marks and sweeps with `gcThreadNum` threads, including the
+  // caller's. `allocFunc` can be called from them, but not concurrently.
+  static State* create(AllocFunc allocFunc, int gcThreadNum);
+  // Heap size (see `getHeapBytes`) is kept within `heapBudget` bytes:
+  // allocation over it raises an error, and running code returns
+  // OUT_OF_MEMORY. 0 for no limit.
+  static State* create(AllocFunc allocFunc, int gcThreadNum, size_t heapBudget);
   // Delete.
   void release();
 
@@ -140,7 +202,7 @@ public:
   Value referGlobal(Value sym, bool* pExist = NULL) const;
   void defineGlobal(Value sym, Value value);
   void defineNative(const char* name, NativeFuncType func, int minArgNum, int maxArgNum);
-  SHashTable* getGlobalVariableTable() const;
+  SHashTable* getGlobalVariableTable() const;  // symbol -> global cell (internal)
 
   // Converts C++ bool value to lisp bool value.
   inline Value boolean(bool b) const;
@@ -160,14 +222,24 @@ public:
   // Converts C string to lisp String.
   Value string(const char* str);
   Value string(const char* str, size_t len);
-  Value allocatedString(const char* string, size_t len);  // string is passed.
+  Value allocatedString(const char* string, size_t len);  // string is passed, and freed.
 
 #ifndef DISABLE_FLONUM
   // Floating point number.
   Value flonum(Flonum f);
 #endif
 
-  SHashTable* createHashTable(bool equal);
+  // Weak table doesn't keep its keys or values from GC, and entries are
+  // removed when they are collected.
+  enum Weakness {
+    NOT_WEAK,
+    WEAK_KEY,
+    WEAK_VALUE,
+    WEAK_KEY_VALUE,
+  };
+  SHashTable* createHashTable(bool equal, Weakness weakness = NOT_WEAK);
+  // Refers the value weakly, it gets nil when the value is collected.
+  Value createWeakRef(Value v);
 
   // File stream.
   Value createFileStream(FILE* fp);
@@ -190,9 +262,13 @@ public:
   // Gets result value for the index.
   Value getResult(int index) const;
 
+  // Arena keeps objects allocated after saved index from GC, it grows as
+  // needed. `HandleScope` restores it automatically.
   int saveArena() const;
   void restoreArena(int index);
   void restoreArenaWith(int index, Value v);
+  // Adds the value to arena.
+  void pushArena(Value v);
 
   // Raises runtime error.
   void runtimeError(const char* msg, ...);
@@ -234,8 +310,37 @@ public:
   void checkType(Value x, Type expected);
 
   void collectGarbage();
+  // Bounds pause of full GC: it runs incrementally, in steps which trace
+  // or sweep objects up to the size. 0 runs it at once.
+  void setGcStepSize(int size);
+  // Full GC is paced on heap size (bytes of objects and their buffers):
+  // it runs when the heap grows by the factor from the size after last
+  // GC, or reaches the limit (0 for no limit) if it is smaller.
+  void setGcGrowthFactor(double factor);
+  void setGcHeapLimit(size_t limit);
+  size_t getHeapBytes() const;
+  void getGcStats(GcStats* stats) const;
+  // Sets callback called after each GC (NULL to remove).
+  void setGcCallback(GcCallback callback, void* userdata);
   void setVmTrace(bool b);
 
+  // Sampling profiler: returns false if it can't be started.
+  bool startProfile();
+  void stopProfile();
+  // Outputs samples as collapsed stacks (for flamegraph).
+  void outputProfile(Stream* o) const;
+  // Gets sample counts for each function: ((name . count) ...)
+  Value getProfileCounts();
+  // Allocation profiler: samples an object in about every `interval`
+  // allocations, and sums them for each site (function, and opcode or
+  // native function which allocates in it).
+  void startAllocProfile(int interval = ALLOC_PROFILE_INTERVAL);
+  void stopAllocProfile();
+  // Outputs estimated bytes and counts of sites: `bytes count function site`
+  void outputAllocProfile(Stream* o) const;
+  // Gets them: ((function site count . bytes) ...), in descending order of bytes.
+  Value getAllocProfileCounts();
+
   bool compile(Value exp, Value* pValue);
 
   // Execute compiled code.
@@ -257,6 +362,7 @@ private:
   ErrorCode runBinary(Stream* stream, Value* pResult);
   void markRoot();
   void allocFailed(void* p, size_t size);
+  ErrorCode runFailed(ErrorCode err, int arena);
 
   jmp_buf* setJmpbuf(jmp_buf* jmp);
   void longJmp();
@@ -271,10 +377,35 @@ private:
   Vm* vm_;
   jmp_buf* jmp_;
   int gensymIndex_;
+  bool outOfMemory_;
+  GcCallback gcCallback_;
+  void* gcCallbackData_;
 
   friend struct StateAllocatorCallback;
 };
 
+// Handle scope: objects allocated in the scope (or kept explicitly) are
+// protected from GC, until the scope ends.
+class HandleScope {
+public:
+  explicit HandleScope(State* state)
+    : state_(state), index_(state->saveArena())  {}
+  ~HandleScope()  { state_->restoreArena(index_); }
+
+  // Protects the value in the scope, and returns it.
+  Value keep(Value v)  { state_->pushArena(v); return v; }
+  // Releases objects allocated in the scope so far, except `v` which is
+  // protected after the scope ends (in the outer scope), and returns it.
+  Value escape(Value v);
+
+private:
+  HandleScope(const HandleScope&);
+  void operator=(const HandleScope&);
+
+  State* state_;
+  int index_;
+};
+
 inline bool Value::eq(Value target) const  { return v_ == target.v_; }
 inline bool Value::isTrue() const  { return !eq(Value::NIL); }
 inline bool Value::isFalse() const  { return eq(Value::NIL); }
@@ -288,6 +419,13 @@ inline Value State::referGlobal(const char* sym, bool* pExist) const  { return r
 inline void State::defineGlobal(const char* sym, Value value)  { return defineGlobal(intern(sym), value); }
 inline void State::defineNative(const char* name, NativeFuncType func, int minArgNum)  { defineNative(name, func, minArgNum, minArgNum); }
 
+inline Value HandleScope::escape(Value v) {
+  state_->restoreArenaWith(index_, v);
+  if (v.isObject())
+    ++index_;
+  return v;
+}
+
 //=============================================================================
 /*
   Value: tagged pointer representation.
@@ -295,6 +433,7 @@ inline void State::defineNative(const char* name, NativeFuncType func, int minAr
     XXXXXX00 : Object
     XXXX0010 : Symbol
     XXXX0110 : Character
+    XXXX1010 : Flonum (IMMEDIATE_FLONUM)
  */
 
 const Fixnum TAG_SHIFT = 2;
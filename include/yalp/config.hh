@@ -15,4 +15,51 @@
 // Use `float` for Flonum? (default: double)
 //#define USE_FLOAT
 
+// Encode flonum into Value directly, instead of allocating an object?
+// (64-bit only. If Flonum is double, only values whose lowest 4 bits of
+// mantissa are zero are encoded, others are allocated)
+#if defined(__LP64__) && !defined(DISABLE_FLONUM)
+#define IMMEDIATE_FLONUM
+#endif
+
+// Count executed opcode pairs/triples, and report them in debug info?
+//#define COUNT_OPCODE_SEQUENCE
+
+// Reconstruct call stack from VM frames on error, instead of tracking it
+// at every call? (Frames replaced by tail calls are not shown)
+//#define LAZY_CALL_STACK
+
+// Compile hot closures into native code? (Linux/x86-64 only)
+//#define ENABLE_JIT
+
+// Call count of a closure to be compiled by JIT.
+#define JIT_CALL_THRESHOLD  (100)
+
+// Initial and maximum size of VM stack (in Values).
+// Exceeding the maximum raises "Stack overflow" error.
+#define INITIAL_STACK_SIZE  (1024)
+#define MAX_STACK_SIZE  (1024 * 1024)
+
+// Number of young objects which triggers minor GC.
+// Survivors of minor GC are promoted to old generation.
+#define NURSERY_SIZE  (64 * 1024)
+
+// Heap size (in bytes, managed objects and non managed memory like their
+// buffers) which triggers the first full GC. Next one is triggered when the
+// heap grows by GC_GROWTH_FACTOR times of the size after last GC, but not
+// below GC_MIN_HEAP_SIZE.
+#define GC_MIN_HEAP_SIZE  (16 * 1024 * 1024)
+#define GC_GROWTH_FACTOR  (2.0)
+
+// Maximum number of objects which a step of incremental full GC traces or
+// sweeps, to bound its pause. 0 runs full GC at once.
+#define GC_STEP_SIZE  (4096)
+
+// Sampling interval of profiler (in micro seconds of CPU time).
+#define PROFILE_INTERVAL_USEC  (1000)
+
+// Average number of object allocations between samples of allocation
+// profiler, the actual interval is randomized not to follow loops.
+#define ALLOC_PROFILE_INTERVAL  (1000)
+
 #endif
@@ -23,6 +23,7 @@ enum ErrorCode {
   // Run
   FILE_NOT_FOUND,
   RUNTIME_ERROR,
+  OUT_OF_MEMORY,  // Allocation failed, or heap budget is exceeded.
 };
 
 }  // namespace yalp
@@ -2,6 +2,8 @@
 // GcObject
 /*
  * Base class for memory managed object.
+ * Object has no vtable: its header holds a type tag, and `mark` and
+ * `destruct` are dispatched with it (defined in object.cc).
  * `destruct` method is called instead of destructor.
  */
 //=============================================================================
@@ -15,17 +17,24 @@ class Allocator;
 
 class GcObject {
 protected:
-  GcObject()  {}  // Empty construct needed, otherwise member cleared.
-  ~GcObject()  {}  // Destructor is not called, so no need virtual modifier.
-  virtual void destruct(Allocator*)  {}
-
-  virtual void mark();
+  explicit GcObject(int typeTag) : typeTag_(typeTag)  {}
+  ~GcObject()  {}  // Destructor is not called.
+
+  // Releases memory which the object owns.
+  void destruct(Allocator* allocator);
+  // Marks the object, and pushes it onto mark stack of the allocator:
+  // objects which it refers are marked when it is popped, not recursively.
+  void mark();
+  // Marks objects which it refers (dispatched with the type tag).
+  void trace();
+  // Drops weak references to unmarked objects, after marking.
+  void clearWeak();
+
+  // Mark bit is kept in the bitmap of the page which holds the object,
+  // so the object must be allocated by Allocator.
   bool isMarked() const;
 
-private:
-  void clearMark();
-
-  GcObject* next_;
+  int typeTag_;
 
   friend class Allocator;
 };
@@ -6,8 +6,9 @@ Derived classes should hide their destructor,
 and thier destructor should do nothing,
 because yalp uses GC and destructor is not called.
 
-Destructor is called if a instance is created explicitly (in C stack).
-`destruct` virtual method is called when a instance is managed with
+Objects have no virtual function: `Object` dispatches `equal`, `calcHash`
+and `output` with the type tag, into the method of the derived class
+which hides it. `destruct` is called when a instance is freed by
 Allocator.
  */
 //=============================================================================
@@ -32,19 +33,23 @@ class Stream;
 // Base class.
 class Object : public GcObject {
 public:
-  virtual Type getType() const = 0;
-  virtual bool equal(const Object* target) const;
-  virtual unsigned int calcHash(State* state) const;
+  Type getType() const  { return static_cast<Type>(typeTag_); }
+  bool equal(const Object* target) const;
+  unsigned int calcHash(State* state) const;
 
-  virtual void output(State* state, Stream* o, bool inspect) const = 0;
+  void output(State* state, Stream* o, bool inspect) const;
 
-  virtual bool isCallable() const;
+  bool isCallable() const;
 
 protected:
   // Prevent to call destructor from outside.
-  Object()  {}  // Empty construct needed, otherwise member cleared.
+  explicit Object(Type type) : GcObject(type)  {}
   ~Object()  {}
 
+  // Must be called when a value is stored into this object after its
+  // construction: old object can't refer young one, so promotes it.
+  void writeBarrier(Value x)  { if (isMarked()) x.mark(); }
+
   friend class State;
   friend class Value;
 };
@@ -53,20 +58,19 @@ protected:
 class Cell : public Object {
 public:
   Cell(Value a, Value d);
-  virtual Type getType() const override;
-  virtual bool equal(const Object* target) const override;
-  virtual unsigned int calcHash(State* state) const override;
+  bool equal(const Object* target) const;
+  unsigned int calcHash(State* state) const;
 
   Value car() const  { return car_; }
   Value cdr() const  { return cdr_; }
   void setCar(Value a);
   void setCdr(Value d);
 
-  virtual void output(State* state, Stream* o, bool inspect) const override;
+  void output(State* state, Stream* o, bool inspect) const;
 
 protected:
   ~Cell()  {}
-  virtual void mark() override;
+  void trace();
 
 private:
   const char* isAbbrev(State* state) const;
@@ -75,31 +79,31 @@ private:
   Value cdr_;
 
   friend class State;
+  friend class GcObject;
 };
 
 // String class.
+// Characters are stored after the object (with terminator), so it must be
+// allocated with `getAllocSize`.
 class String : public Object {
 public:
-  // The given string is allocated in heap and be taken ownership.
   String(const char* string, size_t len);
-  virtual Type getType() const override;
-  virtual bool equal(const Object* target) const override;
-  virtual unsigned int calcHash(State* state) const override;
+  static size_t getAllocSize(size_t len)  { return sizeof(String) + len + 1; }
+  bool equal(const Object* target) const;
+  unsigned int calcHash(State* state) const;
 
-  const char* c_str() const  { return string_; }
+  const char* c_str() const  { return reinterpret_cast<const char*>(this + 1); }
   size_t len() const  { return len_; }
 
-  virtual void output(State* state, Stream* o, bool inspect) const override;
+  void output(State* state, Stream* o, bool inspect) const;
 
 protected:
   ~String()  {}
 private:
-  virtual void destruct(Allocator* allocator) override;
-
-  const char* string_;
   size_t len_;
 
   friend class State;
+  friend class GcObject;
 };
 
 #ifndef DISABLE_FLONUM
@@ -107,12 +111,11 @@ private:
 class SFlonum : public Object {
 public:
   SFlonum(Flonum v);
-  virtual Type getType() const override;
-  virtual bool equal(const Object* target) const override;
+  bool equal(const Object* target) const;
 
   Flonum toFlonum() const  { return v_; }
 
-  virtual void output(State* state, Stream* o, bool inspect) const override;
+  void output(State* state, Stream* o, bool inspect) const;
 
 protected:
   ~SFlonum()  {}
@@ -127,26 +130,26 @@ protected:
 class Vector : public Object {
 public:
   Vector(Allocator* allocator, int size);
-  virtual Type getType() const override;
-  virtual bool equal(const Object* target) const override;
+  bool equal(const Object* target) const;
 
   int size() const  { return size_; }
 
   Value get(int index);
   void set(int index, Value x);
 
-  virtual void output(State* state, Stream* o, bool inspect) const override;
+  void output(State* state, Stream* o, bool inspect) const;
 
 protected:
   ~Vector()  {}
-  virtual void destruct(Allocator* allocator) override;
-  virtual void mark() override;
+  void destruct(Allocator* allocator);
+  void trace();
 
   Value* buffer_;
   int size_;
 
   friend class State;
   friend class Vm;
+  friend class GcObject;
 };
 
 // HashTable class.
@@ -154,10 +157,10 @@ class SHashTable : public Object {
 public:
   typedef HashTable<Value, Value> TableType;
 
-  explicit SHashTable(Allocator* allocator, HashPolicy<Value>* policy);
-  virtual Type getType() const override;
+  explicit SHashTable(Allocator* allocator, HashPolicy<Value>* policy,
+                      State::Weakness weakness = State::NOT_WEAK);
 
-  virtual void output(State* state, Stream* o, bool inspect) const override;
+  void output(State* state, Stream* o, bool inspect) const;
 
   void put(Value key, Value value);
   const Value* get(Value key) const;
@@ -167,27 +170,52 @@ public:
   int getEntryCount() const;
   int getConflictCount() const;
   int getMaxDepth() const;
+  State::Weakness getWeakness() const  { return weakness_; }
+  // Read-only table can't be modified by `table-put!` and `table-delete!`.
+  bool isReadOnly() const  { return readOnly_; }
+  void setReadOnly()  { readOnly_ = true; }
 
   const TableType* getHashTable() const  { return table_; }
 
 protected:
   ~SHashTable();
-  virtual void mark() override;
+  void trace();
+  void clearWeak();
 
 private:
-  virtual void destruct(Allocator* allocator) override;
+  void destruct(Allocator* allocator);
 
   TableType* table_;
+  State::Weakness weakness_;
+  bool readOnly_;
 
   friend class State;
   friend class Vm;
+  friend class GcObject;
 };
 
-class Callable : public Object {
+// Weak reference: refers an object without keeping it from GC.
+class WeakRef : public Object {
 public:
-  Callable();
+  explicit WeakRef(Value x) : Object(TT_WEAK_REF), x_(x)  {}
+
+  // Returns nil if the object is collected.
+  Value get() const  { return x_; }
+
+  void output(State* state, Stream* o, bool inspect) const;
 
-  virtual bool isCallable() const;
+protected:
+  ~WeakRef()  {}
+  void clearWeak();
+
+  Value x_;
+
+  friend class GcObject;
+};
+
+class Callable : public Object {
+public:
+  explicit Callable(Type type);
 
   const Symbol* getName() const  { return name_; }
   void setName(const Symbol* name);
@@ -199,16 +227,23 @@ protected:
 // Closure class.
 class Closure : public Callable {
 public:
-  Closure(State* state, Value body, int freeVarCount,
-          int minArgNum, int maxArgNum);
-  virtual Type getType() const override;
+  Closure(State* state, Value code, Value* body, int freeVarCount,
+          int minArgNum, int maxArgNum, int stackDepth);
 
-  Value getBody() const  { return body_; }
+  Value getCode() const  { return code_; }
+  Value* getBody() const  { return body_; }
   int getMinArgNum() const  { return minArgNum_; }
   int getMaxArgNum() const  { return maxArgNum_; }
   bool hasRestParam() const  { return maxArgNum_ < 0; }
+  // Maximum stack depth of the body, reserved at entry.
+  int getStackDepth() const  { return stackDepth_; }
+#ifdef ENABLE_JIT
+  // Counts up calls, returns the total.
+  int countCall()  { return ++callCount_; }
+#endif
 
   void setFreeVariable(int index, Value value) {
+    writeBarrier(value);
     freeVariables_[index] = value;
   }
 
@@ -217,28 +252,36 @@ public:
     return freeVariables_[index];
   }
 
-  virtual void output(State*, Stream* o, bool) const override;
+  void output(State*, Stream* o, bool) const;
 
 protected:
+  Closure(Type type, State* state, Value code, Value* body, int freeVarCount,
+          int minArgNum, int maxArgNum, int stackDepth);
   ~Closure()  {}
-  virtual void destruct(Allocator* allocator) override;
-  virtual void mark() override;
+  void destruct(Allocator* allocator);
+  void trace();
 
-  Value body_;
+  Value code_;  // Linked code which contains body.
+  Value* body_;
   Value* freeVariables_;
   int freeVarCount_;
   int minArgNum_;
   int maxArgNum_;
+  int stackDepth_;
+#ifdef ENABLE_JIT
+  int callCount_;
+#endif
+
+  friend class GcObject;
 };
 
 // Macro class.
 class Macro : public Closure {
 public:
-  Macro(State* state, Value name, Value body, int freeVarCount,
-        int minArgNum, int maxArgNum);
-  virtual Type getType() const override  { return TT_MACRO; }
-
-  virtual void output(State*, Stream* o, bool) const override;
+  Macro(State* state, Value name, Value code, Value* body, int freeVarCount,
+        int minArgNum, int maxArgNum, int stackDepth);
+  
+  void output(State*, Stream* o, bool) const;
 
 protected:
   ~Macro()  {}
@@ -248,13 +291,12 @@ protected:
 class NativeFunc : public Callable {
 public:
   NativeFunc(NativeFuncType func, int minArgNum, int maxArgNum);
-  virtual Type getType() const override;
 
   int getMinArgNum() const  { return minArgNum_; }
   int getMaxArgNum() const  { return maxArgNum_; }
   Value call(State* state)  { return func_(state); }
 
-  virtual void output(State*, Stream* o, bool) const override;
+  void output(State*, Stream* o, bool) const;
 
 protected:
   ~NativeFunc()  {}
@@ -269,53 +311,54 @@ class Continuation : public Callable {
 public:
   Continuation(State* state, const Value* stack, int size,
                const CallStack* callStack, int callStackSize);
-  virtual Type getType() const override;
 
   int getStackSize() const  { return stackSize_; }
   const Value* getStack() const  { return copiedStack_; }
   int getCallStackSize() const  { return callStackSize_; }
   const CallStack* getCallStack() const  { return callStack_; }
 
-  virtual void output(State*, Stream* o, bool) const override;
+  void output(State*, Stream* o, bool) const;
 
 protected:
   ~Continuation()  {}
-  virtual void destruct(Allocator* allocator) override;
-  virtual void mark() override;
+  void destruct(Allocator* allocator);
+  void trace();
 
   Value* copiedStack_;
   CallStack* callStack_;
   int stackSize_;
   int callStackSize_;
+
+  friend class GcObject;
 };
 
 /**
  * SStream class
- *   SStream class has a ownership for the given Stream instance,
- *   only when SStream is created in heap (using Allocator#newObject method).
- *   Otherwise (the case what SStream is created in stack),
- *   SStream class does not have a ownership for it.
+ *   SStream class has a ownership for the given Stream instance.
+ *   Like other objects, it must be created in heap (using
+ *   Allocator#newObject method): GC keeps mark bit out of the object.
+ *   Reader detaches the stream from the object passed to read macros.
  */
 class SStream : public Object {
 public:
   explicit SStream(Stream* stream);
   explicit SStream(Stream* stream, Value save);
-  virtual Type getType() const override;
 
-  virtual void output(State*, Stream* o, bool) const override;
+  void output(State*, Stream* o, bool) const;
 
   inline Stream* getStream() const  { return stream_; }
 
 protected:
   ~SStream()  {}
-  virtual void destruct(Allocator* allocator) override;
-  virtual void mark() override;
+  void destruct(Allocator* allocator);
+  void trace();
 
   Stream* stream_;
   Value save_;
 
   friend class Reader;
   friend class State;
+  friend class GcObject;
 };
 
 }  // namespace yalp
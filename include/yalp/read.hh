@@ -37,6 +37,7 @@ private:
   ErrorCode readSpecial(Value* pValue);
   ErrorCode readSharedStructure(Value* pValue);
   ErrorCode readChar(Value* pValue);
+  bool callMacro(Value fn, int argNum, Value* args, Value* pValue);
   void storeShared(int id, Value value);
   void skipSpaces();
   static bool isDelimiter(int c);
@@ -0,0 +1,180 @@
+//=============================================================================
+/// AllocProfiler - Allocation site profiler.
+//=============================================================================
+
+#include "build_env.hh"
+#include "alloc_profiler.hh"
+#include "allocator.hh"
+#include "symbol_manager.hh"
+#include "vm.hh"
+#include "yalp/object.hh"
+#include "yalp/stream.hh"
+
+#include <algorithm>
+#include <stdio.h>  // for snprintf
+
+namespace yalp {
+
+struct AllocProfiler::Site {
+  const Symbol* function;  // NULL for no name.
+  const Symbol* native;  // Native function which allocates, or NULL.
+  int type;  // Allocated object, tells the opcode if `native` is NULL.
+  bool toplevel;  // Not in a function.
+  size_t count;
+  size_t bytes;
+};
+
+AllocProfiler* AllocProfiler::create(State* state) {
+  void* memory = state->alloc(sizeof(AllocProfiler));
+  return new(memory) AllocProfiler(state);
+}
+
+void AllocProfiler::release() {
+  State* state = state_;
+  this->~AllocProfiler();
+  state->free(this);
+}
+
+AllocProfiler::AllocProfiler(State* state)
+  : state_(state), sites_(NULL), siteCount_(0), siteCapacity_(0)
+  , interval_(1), running_(false) {
+}
+
+AllocProfiler::~AllocProfiler() {
+  stop();
+  if (sites_ != NULL)
+    state_->free(sites_);
+}
+
+void AllocProfiler::start(int interval) {
+  stop();
+  siteCount_ = 0;
+  interval_ = interval > 0 ? interval : 1;
+  running_ = true;
+  state_->getAllocator()->setAllocSampleInterval(interval_);
+}
+
+void AllocProfiler::stop() {
+  if (!running_)
+    return;
+  state_->getAllocator()->setAllocSampleInterval(0);
+  running_ = false;
+}
+
+void AllocProfiler::sample(int depth, const CallStack* callStack, int type, size_t bytes) {
+  if (!running_)
+    return;
+
+  // Native function is the leaf, and the function calls it.
+  const Symbol* function = NULL;
+  const Symbol* native = NULL;
+  int functionIndex = depth - 1;
+  if (depth > 0 && callStack[depth - 1].callable->getType() == TT_NATIVEFUNC) {
+    native = callStack[depth - 1].callable->getName();
+    --functionIndex;
+  }
+  bool toplevel = functionIndex < 0;
+  if (!toplevel)
+    function = callStack[functionIndex].callable->getName();
+
+  Site* site = NULL;
+  for (int i = 0; i < siteCount_; ++i) {
+    Site* p = &sites_[i];
+    if (p->function == function && p->native == native && p->type == type &&
+        p->toplevel == toplevel) {
+      site = p;
+      break;
+    }
+  }
+  if (site == NULL) {
+    if (siteCount_ >= siteCapacity_) {
+      int capacity = siteCapacity_ > 0 ? siteCapacity_ * 2 : 64;
+      sites_ = static_cast<Site*>(state_->realloc(sites_, sizeof(Site) * capacity));
+      siteCapacity_ = capacity;
+    }
+    site = &sites_[siteCount_++];
+    site->function = function;
+    site->native = native;
+    site->type = type;
+    site->toplevel = toplevel;
+    site->count = site->bytes = 0;
+  }
+  ++site->count;
+  site->bytes += bytes;
+}
+
+bool AllocProfiler::moreBytes(const Site& a, const Site& b) {
+  if (a.bytes != b.bytes)
+    return a.bytes > b.bytes;
+  return a.count > b.count;
+}
+
+// Sampling only looks up and appends sites, so their order can be changed.
+void AllocProfiler::sortSites() const {
+  std::sort(sites_, sites_ + siteCount_, moreBytes);
+}
+
+const char* AllocProfiler::getFunctionName(const Site* site) const {
+  if (site->toplevel)
+    return "(toplevel)";
+  return site->function != NULL ? site->function->c_str() : "(noname)";
+}
+
+const char* AllocProfiler::getSiteName(const Site* site) const {
+  if (site->native != NULL)
+    return site->native->c_str();
+  switch (site->type) {
+  case TT_CLOSURE:       return "CLOSE";
+  case TT_BOX:           return "BOX";
+  case TT_CONTINUATION:  return "CONTI";
+  default:
+    // Allocated in VM otherwise (e.g. rest parameters), shown with the type.
+    return state_->getTypeSymbol(static_cast<Type>(site->type)).toSymbol(state_)->c_str();
+  }
+}
+
+void AllocProfiler::output(Stream* o) const {
+  sortSites();
+  for (int i = 0; i < siteCount_; ++i) {
+    const Site* site = &sites_[i];
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%lu %lu ",
+             static_cast<unsigned long>(site->bytes * interval_),
+             static_cast<unsigned long>(site->count * interval_));
+    o->write(buffer);
+    o->write(getFunctionName(site));
+    o->write(' ');
+    o->write(getSiteName(site));
+    o->write('\n');
+  }
+}
+
+Value AllocProfiler::getCounts() const {
+  // Allocating objects samples into sites, which can be reallocated, so
+  // sites are copied into a vector before the result is consed.
+  sortSites();
+  int n = siteCount_;
+  int arena = state_->saveArena();
+  Allocator* allocator = state_->getAllocator();
+  Vector* vector = allocator->newObject<Vector>(allocator, n * 4);
+  for (int i = 0; i < n; ++i) {
+    const Site* site = &sites_[i];
+    vector->set(i * 4, state_->intern(getFunctionName(site)));
+    vector->set(i * 4 + 1, state_->intern(getSiteName(site)));
+    vector->set(i * 4 + 2, Value(static_cast<Fixnum>(site->count * interval_)));
+    vector->set(i * 4 + 3, Value(static_cast<Fixnum>(site->bytes * interval_)));
+  }
+
+  Value result = Value::NIL;
+  for (int i = n; --i >= 0; ) {
+    Value counts = state_->cons(vector->get(i * 4 + 2), vector->get(i * 4 + 3));
+    counts = state_->cons(vector->get(i * 4 + 1), counts);
+    counts = state_->cons(vector->get(i * 4), counts);
+    result = state_->cons(counts, result);
+    state_->restoreArenaWith(arena + 1, result);
+  }
+  state_->restoreArenaWith(arena, result);
+  return result;
+}
+
+}  // namespace yalp
@@ -0,0 +1,62 @@
+//=============================================================================
+/// AllocProfiler - Allocation site profiler.
+/*
+ * Allocator samples an object in about every N allocations, and VM
+ * attributes it to the site: the running function, and what allocates in
+ * it, the opcode (CLOSE, BOX, CONTI) or the native function (cons, list,
+ * string...). Counts and bytes are summed for each site, and multiplied by
+ * the interval in report, to estimate all allocations.
+ */
+//=============================================================================
+
+#ifndef _ALLOC_PROFILER_HH_
+#define _ALLOC_PROFILER_HH_
+
+#include "yalp.hh"
+
+namespace yalp {
+
+class CallStack;
+class Symbol;
+
+class AllocProfiler {
+public:
+  static AllocProfiler* create(State* state);
+  void release();
+
+  // Starts sampling, clears previous samples.
+  void start(int interval);
+  void stop();
+  bool isRunning() const  { return running_; }
+
+  // Records a sampled object of the type, allocated in the call stack.
+  void sample(int depth, const CallStack* callStack, int type, size_t bytes);
+
+  // Outputs sites in descending order of bytes: `bytes count function site`.
+  void output(Stream* o) const;
+  // Returns ((function site count . bytes) ...), in descending order of bytes.
+  Value getCounts() const;
+
+private:
+  struct Site;
+
+  AllocProfiler(State* state);
+  ~AllocProfiler();
+
+  static bool moreBytes(const Site& a, const Site& b);
+  // Sorts sites by bytes, in place.
+  void sortSites() const;
+  const char* getFunctionName(const Site* site) const;
+  const char* getSiteName(const Site* site) const;
+
+  State* state_;
+  Site* sites_;
+  int siteCount_;
+  int siteCapacity_;
+  int interval_;
+  bool running_;
+};
+
+}  // namespace yalp
+
+#endif
@@ -5,10 +5,22 @@
 #include "build_env.hh"
 #include "allocator.hh"
 
+#include <algorithm>  // for max
 #include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits.h>  // for INT_MAX
+#include <mutex>
 #include <new>
 #include <stdint.h>  // intptr_t
 #include <stdlib.h>  // for malloc, free
+#include <string.h>  // for memset
+#include <thread>
+
+#ifdef _MSC_VER
+#include <intrin.h>  // for _InterlockedOr
+#endif
 
 #ifndef NDEBUG
 #include <iostream>
@@ -16,19 +28,98 @@
 
 namespace yalp {
 
-const int DEFAULT_NEXT_GC = 20000 * 1000;
+const size_t HEAP_PAGE_SIZE = 8 * 1024;
+const int CHUNK_PAGES = 64;  // Pages are allocated at once.
+const int LARGE_OBJECT = -1;  // Size class for large object.
+const int BITMAP_WORDS = HEAP_PAGE_SIZE / 8 / 32;  // A bit for each 8 bytes.
+// GC work for an allocation in incremental GC, marking must outrun it.
+const int STEP_WORK_RATIO = 4;
+// Bytes of non managed memory counted as an allocation in incremental GC.
+const size_t STEP_DEBT_BYTES = 32;
+// Maximum number of objects which an idle GC worker takes at once.
+const int TAKE_SIZE = 256;
+// Non managed memory has its size before it, to count heap size.
+const size_t ALLOC_HEADER_SIZE = 16;
 
 #define RAW_ALLOC(allocFunc, size)  (allocFunc(NULL, (size)))
 #define RAW_REALLOC(allocFunc, ptr, size)  (allocFunc((ptr), (size)))
 #define RAW_FREE(allocFunc, ptr)  (allocFunc((ptr), 0))
 
+static long nowUsec() {
+  return static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 //=============================================================================
-// GcObject
+// Page
 /*
- * next_: Tagged pointer, which embedded mark bit.
+ * Managed objects are allocated from pages, which are aligned to their size
+ * so the page header is found from the object address. Each page holds
+ * objects in one size class: up to 256 bytes in 8 bytes step, and then
+ * up to 1024 bytes in 64 bytes step. Pages are carved from chunks of
+ * CHUNK_PAGES pages, to amortize alignment padding.
+ * Larger object is allocated alone with its own page header.
+ *
+ * Page header has two bitmaps, a bit for each 8 bytes:
+ *   liveBits: Start of allocated objects.
+ *   markBits: Mark bits of the objects.
+ * So sweep scans bitmaps page by page, without touching live objects.
+ *
+ * Swept objects are linked into free list of their size class, so
+ * allocation pops from it, or bumps a pointer in the current page.
+ * Full GC rebuilds free lists, and releases empty pages.
+ *
+ * Objects are managed in two generations: survivors of GC are old, and
+ * keep their mark bit set ("sticky" mark) until next full GC. So minor GC
+ * marks from roots stops at old objects, and it sweeps only pages which
+ * young objects are allocated into.
+ *
+ * Marking doesn't recurse: marked objects are pushed onto mark stack,
+ * and their children are marked when they are popped (traced). If the
+ * stack can't grow, the object is left untraced and overflow is flagged,
+ * then marked objects in the heap are traced again after the stack gets
+ * empty.
+ *
+ * An old object must not refer a young object which minor GC can't see,
+ * so write barrier (`Object::writeBarrier`) promotes the stored object
+ * by marking it, and its young descendants are marked by next minor GC
+ * which traces the mark stack.
+ *
+ * Full GC runs incrementally, to bound its pause (tri-color marking):
+ *   1. Clears all mark bits, and marks roots: objects on mark stack are
+ *      gray, their children are not marked.
+ *   2. Allocation runs a step at intervals, which traces gray objects up to
+ *      the step size. Write barrier marks an object stored into marked
+ *      one, so a traced (black) object never refers unmarked (white) one.
+ *      New objects are allocated as gray.
+ *   3. Roots are not guarded by write barrier, so when mark stack gets
+ *      empty, marks them again and finishes marking at once.
+ *   4. Steps sweep pages lazily, and rebuild free lists. New objects are
+ *      allocated as black.
+ * Minor GC is not run during the cycle, so objects allocated in it are
+ * promoted. Explicit `collectGarbage` gives up the cycle and runs full GC
+ * at once.
+ *
+ * Full GC at once can use worker threads (`Workers`) to mark and sweep.
  */
 
-static const intptr_t MARKED = 1;
+struct Page {
+  Page* next;  // Next page in use, or next free page.
+  void* raw;   // Allocated memory for large object.
+  Allocator* allocator;  // Owner, for marking in incremental GC.
+  int sizeClass;
+  bool young;  // Has objects allocated after last GC.
+  size_t slotSize;  // Or size of large object.
+  uint32_t liveBits[BITMAP_WORDS];
+  uint32_t markBits[BITMAP_WORDS];
+};
+
+struct Chunk {
+  Chunk* next;
+  void* raw;
+};
+
+static const size_t PAGE_HEADER_SIZE = (sizeof(Page) + 15) & ~15;
 
 template <class T>
 inline intptr_t ptr2int(T p) {
@@ -40,16 +131,307 @@ inline T int2ptr(intptr_t i) {
   return reinterpret_cast<T>(i);
 }
 
-void GcObject::mark() {
-  next_ = int2ptr<GcObject*>(ptr2int(next_) | MARKED);
+inline int getSizeClass(size_t size) {
+  if (size <= 256)
+    return static_cast<int>((size + 7) / 8) - 1;
+  return 32 + static_cast<int>((size - 256 + 63) / 64) - 1;
+}
+
+inline size_t getClassSize(int sizeClass) {
+  if (sizeClass < 32)
+    return (sizeClass + 1) * 8;
+  return 256 + (sizeClass - 31) * 64;
+}
+
+template <class T>
+inline T* alignPage(T* p) {
+  return int2ptr<T*>((ptr2int(p) + HEAP_PAGE_SIZE - 1) & ~(HEAP_PAGE_SIZE - 1));
+}
+
+inline Page* getPage(const void* p) {
+  return int2ptr<Page*>(ptr2int(p) & ~(HEAP_PAGE_SIZE - 1));
+}
+
+inline int getBitIndex(const Page* page, const void* p) {
+  return static_cast<int>((ptr2int(p) - ptr2int(page)) >> 3);
+}
+
+inline bool testBit(const uint32_t* bits, int i) {
+  return (bits[i >> 5] & (1U << (i & 31))) != 0;
+}
+
+inline void setBit(uint32_t* bits, int i) {
+  bits[i >> 5] |= 1U << (i & 31);
+}
+
+inline void clearBit(uint32_t* bits, int i) {
+  bits[i >> 5] &= ~(1U << (i & 31));
+}
+
+inline int countTrailingZeros(uint32_t x) {
+#ifdef __GNUC__
+  return __builtin_ctz(x);
+#else
+  int n = 0;
+  for (; (x & 1) == 0; x >>= 1)
+    ++n;
+  return n;
+#endif
+}
+
+// For parallel marking: other workers might set bits in the same word.
+inline bool testBitAtomic(const uint32_t* bits, int i) {
+#ifdef _MSC_VER
+  return testBit(bits, i);  // Aligned load is atomic.
+#else
+  return (__atomic_load_n(&bits[i >> 5], __ATOMIC_RELAXED) & (1U << (i & 31))) != 0;
+#endif
+}
+
+// Returns false if the bit is set already.
+inline bool trySetBitAtomic(uint32_t* bits, int i) {
+  uint32_t mask = 1U << (i & 31);
+#ifdef _MSC_VER
+  return (_InterlockedOr(reinterpret_cast<volatile long*>(&bits[i >> 5]), mask) & mask) == 0;
+#else
+  return (__atomic_fetch_or(&bits[i >> 5], mask, __ATOMIC_RELAXED) & mask) == 0;
+#endif
+}
+
+inline int getSlotCount(int sizeClass) {
+  return static_cast<int>((HEAP_PAGE_SIZE - PAGE_HEADER_SIZE) / getClassSize(sizeClass));
+}
+
+inline int countBits(const uint32_t* bits) {
+  int n = 0;
+  for (int i = 0; i < BITMAP_WORDS; ++i) {
+    for (uint32_t x = bits[i]; x != 0; x &= x - 1)
+      ++n;
+  }
+  return n;
+}
+
+// Links unused slots in the page, in address order.
+static void linkFreeSlots(Page* page, void** pHead, void** pTail) {
+  size_t classSize = getClassSize(page->sizeClass);
+  int count = getSlotCount(page->sizeClass);
+  void** link = pHead;
+  *pTail = NULL;
+  char* p = reinterpret_cast<char*>(page) + PAGE_HEADER_SIZE;
+  for (int i = 0; i < count; ++i, p += classSize) {
+    if (testBit(page->liveBits, getBitIndex(page, p)))
+      continue;
+    *link = p;
+    link = reinterpret_cast<void**>(p);
+    *pTail = p;
+  }
+  *link = NULL;
 }
 
+//=============================================================================
+// GcObject
+
 bool GcObject::isMarked() const {
-  return (ptr2int(next_) & MARKED) != 0;
+  const Page* page = getPage(this);
+  return testBit(page->markBits, getBitIndex(page, this));
+}
+
+// Mark stack of the thread in parallel marking, NULL otherwise.
+static thread_local MarkStack* workerStack;
+
+void GcObject::mark() {
+  Page* page = getPage(this);
+  int index = getBitIndex(page, this);
+  MarkStack* stack = workerStack;
+  if (stack == NULL) {
+    if (testBit(page->markBits, index))
+      return;
+    setBit(page->markBits, index);
+    stack = &page->allocator->markStack_;
+  } else if (testBitAtomic(page->markBits, index) ||
+             !trySetBitAtomic(page->markBits, index)) {
+    return;
+  }
+  page->allocator->pushMark(stack, this);
+}
+
+//=============================================================================
+// Workers
+/*
+ * Threads for parallel full GC, they wait for a job and the caller runs
+ * it too, as index 0.
+ *
+ * Marking: each worker traces objects on its own mark stack. While some
+ * workers are idle, busy ones move half of their stack into shared pool,
+ * and idle ones take from it. Marking ends when all workers get idle.
+ * Sweeping: pages are distributed with an atomic index, and free lists
+ * are linked in page order by the caller after that.
+ * Destruction of objects frees memory, so calls to allocation function
+ * are serialized with a lock.
+ */
+
+struct Allocator::SweepItem {
+  Page* page;
+  int freed;
+  int live;
+  void* freeHead;  // Free slots in the page.
+  void* freeTail;
+};
+
+// Live objects for each type, counted by a sweep worker.
+struct LiveCounts {
+  size_t objects[NUMBER_OF_TYPES];
+  size_t bytes[NUMBER_OF_TYPES];
+};
+
+struct Allocator::Workers {
+  typedef void (Allocator::*Job)(int index);
+
+  Workers(Allocator* allocator, int threadNum);
+  ~Workers();
+
+  // Runs the job in all workers, and waits them.
+  void run(Job job);
+  void threadMain(int index);
+  // Moves half of the stack into shared pool.
+  void share(MarkStack* stack);
+  // Takes objects from shared pool, or waits until it is filled.
+  // Returns false if marking is done.
+  bool take(MarkStack* stack);
+
+  Allocator* allocator;
+  int threadNum;
+  std::thread* threads;
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  std::condition_variable finished;
+  Job job;
+  int generation;
+  int running;
+  bool quit;
+  bool active;  // Running a job.
+  std::mutex allocMutex;
+
+  // Marking.
+  MarkStack* stacks;  // Index 0 is not used, allocator's one is.
+  MarkStack pool;
+  std::condition_variable poolFilled;
+  std::atomic<int> idleCount;
+  bool markDone;
+
+  // Sweeping.
+  SweepItem* items;
+  int itemCount;
+  std::atomic<int> nextItem;
+  LiveCounts* liveCounts;
+};
+
+Allocator::Workers::Workers(Allocator* allocator, int threadNum)
+  : allocator(allocator), threadNum(threadNum), threads(NULL), job(NULL)
+  , generation(0), running(0), quit(false), active(false)
+  , stacks(NULL), idleCount(0), markDone(false)
+  , items(NULL), itemCount(0), nextItem(0), liveCounts(NULL) {
+  memset(&pool, 0, sizeof(pool));
+  stacks = static_cast<MarkStack*>(allocator->alloc(sizeof(MarkStack) * threadNum));
+  memset(stacks, 0, sizeof(MarkStack) * threadNum);
+  threads = static_cast<std::thread*>(allocator->alloc(sizeof(std::thread) * threadNum));
+  liveCounts = static_cast<LiveCounts*>(allocator->alloc(sizeof(LiveCounts) * threadNum));
+  for (int i = 1; i < threadNum; ++i) {
+    allocator->expandMarkStack(&stacks[i]);
+    new(&threads[i]) std::thread(&Workers::threadMain, this, i);
+  }
+}
+
+Allocator::Workers::~Workers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
+  }
+  wakeup.notify_all();
+  for (int i = 1; i < threadNum; ++i) {
+    threads[i].join();
+    threads[i].~thread();
+    if (stacks[i].items != NULL)
+      allocator->freeRaw(stacks[i].items);
+  }
+  if (pool.items != NULL)
+    allocator->freeRaw(pool.items);
+  allocator->free(liveCounts);
+  allocator->free(threads);
+  allocator->free(stacks);
+}
+
+void Allocator::Workers::run(Job job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->job = job;
+    running = threadNum - 1;
+    active = true;
+    ++generation;
+  }
+  wakeup.notify_all();
+  (allocator->*job)(0);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (running > 0)
+    finished.wait(lock);
+  active = false;
 }
 
-void GcObject::clearMark() {
-  next_ = int2ptr<GcObject*>(ptr2int(next_) & ~MARKED);
+void Allocator::Workers::threadMain(int index) {
+  int done = 0;
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    while (!quit && generation == done)
+      wakeup.wait(lock);
+    if (quit)
+      return;
+    done = generation;
+    Job j = job;
+    lock.unlock();
+    (allocator->*j)(index);
+    lock.lock();
+    if (--running == 0)
+      finished.notify_one();
+  }
+}
+
+void Allocator::Workers::share(MarkStack* stack) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (pool.count > 0)
+    return;  // Not taken yet.
+  int n = stack->count / 2;
+  while (pool.capacity < n) {
+    if (!allocator->expandMarkStack(&pool))
+      return;
+  }
+  stack->count -= n;
+  memcpy(pool.items, &stack->items[stack->count], sizeof(GcObject*) * n);
+  pool.count = n;
+  poolFilled.notify_all();
+}
+
+bool Allocator::Workers::take(MarkStack* stack) {
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    if (pool.count > 0) {
+      // Stack is empty here, and has capacity.
+      int n = std::min(std::min(pool.count, TAKE_SIZE), stack->capacity);
+      pool.count -= n;
+      memcpy(stack->items, &pool.items[pool.count], sizeof(GcObject*) * n);
+      stack->count = n;
+      return true;
+    }
+    if (markDone)
+      return false;
+    if (++idleCount == threadNum) {
+      markDone = true;
+      poolFilled.notify_all();
+      return false;
+    }
+    poolFilled.wait(lock);
+    --idleCount;
+  }
 }
 
 //=============================================================================
@@ -68,13 +450,21 @@ void* defaultAllocFunc(void* p, size_t size) {
 AllocFunc getDefaultAllocFunc()  { return defaultAllocFunc; }
 
 void Allocator::markArenaObjects() {
-  for (int n = arenaIndex_, i = 0; i < n; ++i)
-    arena_[i]->mark();
+  for (int n = arenaIndex_, i = 0; i < n; ++i) {
+    GcObject* gcobj = arena_[i];
+    if (gcobj != constructing_) {
+      gcobj->mark();
+    } else {
+      Page* page = getPage(gcobj);
+      setBit(page->markBits, getBitIndex(page, gcobj));
+    }
+  }
 }
 
-Allocator* Allocator::create(AllocFunc allocFunc, Callback* callback) {
+Allocator* Allocator::create(AllocFunc allocFunc, Callback* callback,
+                             int gcThreadNum) {
   void* memory = RAW_ALLOC(allocFunc, sizeof(Allocator));
-  return new(memory) Allocator(allocFunc, callback);
+  return new(memory) Allocator(allocFunc, callback, gcThreadNum);
 }
 
 void Allocator::release() {
@@ -83,106 +473,759 @@ void Allocator::release() {
   RAW_FREE(allocFunc, this);
 }
 
-Allocator::Allocator(AllocFunc allocFunc, Callback* callback)
+Allocator::Allocator(AllocFunc allocFunc, Callback* callback, int gcThreadNum)
   : allocFunc_(allocFunc), callback_(callback), userdata_(NULL)
-  , objectTop_(NULL), objectCount_(0), arenaIndex_(0), maxArenaIndex_(0)
-  , nextGc_(DEFAULT_NEXT_GC) {}
+  , objectCount_(0), nurseryCount_(0), objectBytes_(0), externalBytes_(0)
+  , pages_(NULL), freePages_(NULL), chunks_(NULL)
+  , arena_(NULL), arenaIndex_(0), arenaCapacity_(0), maxArenaIndex_(0)
+  , nextGc_(GC_MIN_HEAP_SIZE), growthFactor_(GC_GROWTH_FACTOR), heapLimit_(0)
+  , heapBudget_(0), constructing_(NULL)
+  , weakObjects_(NULL), weakCount_(0), weakCapacity_(0)
+  , phase_(IDLE), stepSize_(GC_STEP_SIZE), stepDebt_(0)
+  , workers_(NULL), sweepPages_(NULL)
+  , lastSlotSize_(0), lastFullGcUsec_(nowUsec()), allocatedAtFullGc_(0)
+  , cyclePauseUsec_(0), cycleHeapBytes_(0)
+  , sampleInterval_(0), sampleCountdown_(INT_MAX), sampleRandom_(2463534242u) {
+  memset(pools_, 0, sizeof(pools_));
+  memset(&stats_, 0, sizeof(stats_));
+  memset(&markStack_, 0, sizeof(markStack_));
+  if (gcThreadNum > 1) {
+    void* memory = this->alloc(sizeof(Workers));
+    workers_ = new(memory) Workers(this, gcThreadNum);
+  }
+}
 
 Allocator::~Allocator() {
-  while (objectTop_ != NULL) {
-    GcObject* gcobj = objectTop_;
-    objectTop_ = gcobj->next_;
-    gcobj->destruct(this);
-    this->free(gcobj);
+  if (workers_ != NULL) {
+    workers_->~Workers();
+    this->free(workers_);
+    workers_ = NULL;
+  }
+  abandonCycle();
+  while (pages_ != NULL) {
+    Page* page = pages_;
+    pages_ = page->next;
+    memset(page->markBits, 0, sizeof(page->markBits));
+    sweepPage(page, false);
+    if (page->sizeClass == LARGE_OBJECT)
+      freeRaw(page->raw);
+  }
+  while (chunks_ != NULL) {
+    Chunk* chunk = chunks_;
+    chunks_ = chunk->next;
+    freeRaw(chunk->raw);
+    freeRaw(chunk);
   }
+  if (markStack_.items != NULL)
+    freeRaw(markStack_.items);
+  if (arena_ != NULL)
+    freeRaw(arena_);
+  if (weakObjects_ != NULL)
+    freeRaw(weakObjects_);
 }
 
 void* Allocator::alloc(size_t size) {
-  void* q = RAW_ALLOC(allocFunc_, size);
+  checkBudget(size);
+  char* q = static_cast<char*>(allocRaw(ALLOC_HEADER_SIZE + size));
+  *reinterpret_cast<size_t*>(q) = size;
+  externalBytes_ += size;
+  stats_.totalAllocatedBytes += size;
+  if (phase_ != IDLE)
+    stepDebt_ += static_cast<int>(size / STEP_DEBT_BYTES);
+  return q + ALLOC_HEADER_SIZE;
+}
+
+void* Allocator::realloc(void* p, size_t size) {
+  if (p == NULL)
+    return alloc(size);
+  char* raw = static_cast<char*>(p) - ALLOC_HEADER_SIZE;
+  size_t oldSize = *reinterpret_cast<size_t*>(raw);
+  if (size > oldSize)
+    checkBudget(size - oldSize);
+  void* q = RAW_REALLOC(allocFunc_, raw, ALLOC_HEADER_SIZE + size);
   if (q == NULL) {
     collectGarbage();
-    q = RAW_ALLOC(allocFunc_, size);
+    q = RAW_REALLOC(allocFunc_, raw, ALLOC_HEADER_SIZE + size);
     if (q == NULL)
-      callback_->allocFailed(NULL, size, userdata_);
+      callback_->allocFailed(p, size, userdata_);
   }
-  return q;
+  *static_cast<size_t*>(q) = size;
+  externalBytes_ += size - oldSize;
+  if (size > oldSize) {
+    stats_.totalAllocatedBytes += size - oldSize;
+    if (phase_ != IDLE)
+      stepDebt_ += static_cast<int>((size - oldSize) / STEP_DEBT_BYTES);
+  }
+  return static_cast<char*>(q) + ALLOC_HEADER_SIZE;
 }
 
-void* Allocator::realloc(void* p, size_t size) {
-  void* q = RAW_REALLOC(allocFunc_, p, size);
+void Allocator::free(void* p) {
+  if (p == NULL)
+    return;
+  char* raw = static_cast<char*>(p) - ALLOC_HEADER_SIZE;
+  std::unique_lock<std::mutex> lock;
+  if (workers_ != NULL && workers_->active)  // Destruction in parallel sweep.
+    lock = std::unique_lock<std::mutex>(workers_->allocMutex);
+  externalBytes_ -= *reinterpret_cast<size_t*>(raw);
+  allocFunc_(raw, 0);
+}
+
+void* Allocator::allocRaw(size_t size) {
+  void* q = RAW_ALLOC(allocFunc_, size);
   if (q == NULL) {
     collectGarbage();
-    q = RAW_REALLOC(allocFunc_, p, size);
+    q = RAW_ALLOC(allocFunc_, size);
     if (q == NULL)
       callback_->allocFailed(NULL, size, userdata_);
   }
   return q;
 }
 
-void Allocator::free(void* p) {
-  RAW_FREE(allocFunc_, p);
+void* Allocator::callAllocFunc(void* p, size_t size) {
+  if (workers_ != NULL && workers_->active) {
+    std::lock_guard<std::mutex> lock(workers_->allocMutex);
+    return allocFunc_(p, size);
+  }
+  return allocFunc_(p, size);
 }
 
 void* Allocator::objAlloc(size_t size) {
-  if (objectCount_ >= nextGc_)
-    collectGarbage();
+  if (phase_ != IDLE) {
+    if (++stepDebt_ * STEP_WORK_RATIO >= stepSize_)
+      step();
+  } else if (nurseryCount_ >= NURSERY_SIZE || getHeapBytes() >= nextGc_) {
+    // Large buffers can fill heap with few objects.
+    if (getHeapBytes() < nextGc_)
+      collectNursery();
+    else if (stepSize_ > 0)
+      startCycle();
+    else
+      collectGarbage();
+  }
+  checkBudget(size);
+  // Reserved before allocation, not to leave an object unconstructed.
+  if (arenaIndex_ >= arenaCapacity_)
+    expandArena();
 
-  GcObject* gcobj = static_cast<GcObject*>(this->alloc(size));
-  gcobj->next_ = objectTop_;
-  objectTop_ = gcobj;
-  ++objectCount_;
-  if (arenaIndex_ >= ARENA_SIZE) {
-    assert(!"Arena overflow");
+  GcObject* gcobj = static_cast<GcObject*>(poolAlloc(size));
+  Page* page = getPage(gcobj);
+  int index = getBitIndex(page, gcobj);
+  setBit(page->liveBits, index);
+  objectBytes_ += page->slotSize;
+  lastSlotSize_ = page->slotSize;
+  stats_.totalAllocatedBytes += page->slotSize;
+  if (phase_ == IDLE) {
+    page->young = true;
+    ++nurseryCount_;
   } else {
-    arena_[arenaIndex_++] = gcobj;
-    if (maxArenaIndex_ < arenaIndex_)
-      maxArenaIndex_ = arenaIndex_;
+    setBit(page->markBits, index);
+    if (phase_ == MARKING)
+      pushMark(&markStack_, gcobj);  // Traced after its construction.
+    ++objectCount_;
   }
+  pushArena(gcobj);
   return gcobj;
 }
 
+void* Allocator::poolAlloc(size_t size) {
+  int sizeClass = getSizeClass(size);
+  if (sizeClass >= SIZE_CLASS_NUM)
+    return allocLarge(size);
+
+  Pool& pool = pools_[sizeClass];
+  void* p = pool.freeList;
+  if (p != NULL) {
+    pool.freeList = *static_cast<void**>(p);
+    return p;
+  }
+
+  size_t classSize = getClassSize(sizeClass);
+  if (pool.top + classSize > pool.end) {
+    char* page = reinterpret_cast<char*>(allocPage(sizeClass));
+    pool.top = page + PAGE_HEADER_SIZE;
+    pool.end = page + HEAP_PAGE_SIZE;
+  }
+  p = pool.top;
+  pool.top += classSize;
+  return p;
+}
+
+void* Allocator::allocLarge(size_t size) {
+  void* raw = allocRaw(HEAP_PAGE_SIZE + PAGE_HEADER_SIZE + size);
+  Page* page = alignPage(static_cast<Page*>(raw));
+  memset(page, 0, PAGE_HEADER_SIZE);
+  page->raw = raw;
+  page->allocator = this;
+  page->sizeClass = LARGE_OBJECT;
+  page->slotSize = size;
+  page->next = pages_;
+  pages_ = page;
+  return reinterpret_cast<char*>(page) + PAGE_HEADER_SIZE;
+}
+
+Page* Allocator::allocPage(int sizeClass) {
+  if (freePages_ == NULL) {
+    Chunk* chunk = static_cast<Chunk*>(allocRaw(sizeof(Chunk)));
+    chunk->raw = allocRaw(HEAP_PAGE_SIZE * (CHUNK_PAGES + 1));
+    chunk->next = chunks_;
+    chunks_ = chunk;
+
+    char* p = alignPage(static_cast<char*>(chunk->raw));
+    for (int i = 0; i < CHUNK_PAGES; ++i, p += HEAP_PAGE_SIZE) {
+      Page* page = reinterpret_cast<Page*>(p);
+      page->next = freePages_;
+      freePages_ = page;
+    }
+  }
+
+  Page* page = freePages_;
+  freePages_ = page->next;
+  memset(page, 0, PAGE_HEADER_SIZE);
+  page->allocator = this;
+  page->sizeClass = sizeClass;
+  page->slotSize = getClassSize(sizeClass);
+  page->next = pages_;
+  pages_ = page;
+  return page;
+}
+
+void Allocator::releasePage(Page* page) {
+  if (page->sizeClass == LARGE_OBJECT) {
+    freeRaw(page->raw);
+  } else {
+    page->next = freePages_;
+    freePages_ = page;
+  }
+}
+
 void Allocator::restoreArenaWith(int index, GcObject* gcobj) {
-  assert(index < ARENA_SIZE);
-  arena_[index] = gcobj;
-  arenaIndex_ = index + 1;
+  assert(index <= arenaIndex_);
+  arenaIndex_ = index;
+  pushArena(gcobj);
+}
+
+// Doesn't run GC, objects which are not in arena yet might be alive.
+void Allocator::expandArena() {
+  int capacity = arenaCapacity_ > 0 ? arenaCapacity_ * 2 : ARENA_INITIAL_SIZE;
+  void* p = RAW_REALLOC(allocFunc_, arena_, sizeof(GcObject*) * capacity);
+  if (p == NULL)
+    callback_->allocFailed(arena_, sizeof(GcObject*) * capacity, userdata_);
+  arena_ = static_cast<GcObject**>(p);
+  arenaCapacity_ = capacity;
+}
+
+void Allocator::addWeakObject(GcObject* gcobj) {
+  if (weakCount_ >= weakCapacity_) {
+    int capacity = weakCapacity_ > 0 ? weakCapacity_ * 2 : 16;
+    void* p = RAW_REALLOC(allocFunc_, weakObjects_, sizeof(GcObject*) * capacity);
+    if (p == NULL)
+      callback_->allocFailed(weakObjects_, sizeof(GcObject*) * capacity, userdata_);
+    weakObjects_ = static_cast<GcObject**>(p);
+    weakCapacity_ = capacity;
+  }
+  weakObjects_[weakCount_++] = gcobj;
+}
+
+// Called after marking finished: unmarked weak objects are swept in this
+// GC, so they are just removed from the list.
+void Allocator::clearWeakReferences() {
+  int n = 0;
+  for (int i = 0; i < weakCount_; ++i) {
+    GcObject* gcobj = weakObjects_[i];
+    if (!gcobj->isMarked())
+      continue;
+    gcobj->clearWeak();
+    weakObjects_[n++] = gcobj;
+  }
+  weakCount_ = n;
+}
+
+void Allocator::setGcGrowthFactor(double factor) {
+  growthFactor_ = std::max(factor, 1.0);
+  updateNextGc();
+}
+
+void Allocator::setGcHeapLimit(size_t limit) {
+  heapLimit_ = limit;
+  updateNextGc();
+}
+
+void Allocator::setHeapBudget(size_t budget) {
+  heapBudget_ = budget;
+  updateNextGc();
+}
+
+// Paces next full GC on the live heap size.
+void Allocator::updateNextGc() {
+  size_t heapBytes = getHeapBytes();
+  nextGc_ = std::max(static_cast<size_t>(heapBytes * growthFactor_),
+                     static_cast<size_t>(GC_MIN_HEAP_SIZE));
+  // Incremental GC starts before reaching the budget.
+  size_t limit = heapLimit_;
+  if (heapBudget_ > 0 && (limit == 0 || limit > heapBudget_ / 4 * 3))
+    limit = heapBudget_ / 4 * 3;
+  // Limit can't be kept if live objects nearly exceed it.
+  if (limit > 0 && nextGc_ > limit)
+    nextGc_ = std::max(limit, heapBytes + heapBytes / 4);
+}
+
+void Allocator::checkBudget(size_t size) {
+  if (heapBudget_ == 0 || getHeapBytes() + size <= heapBudget_)
+    return;
+  collectGarbage();
+  if (getHeapBytes() + size > heapBudget_)
+    callback_->allocFailed(NULL, size, userdata_);
+}
+
+void Allocator::discardConstructing() {
+  GcObject* gcobj = constructing_;
+  if (gcobj == NULL)
+    return;
+  constructing_ = NULL;
+  // Neither swept nor reused until its page is rebuilt.
+  Page* page = getPage(gcobj);
+  int index = getBitIndex(page, gcobj);
+  clearBit(page->liveBits, index);
+  clearBit(page->markBits, index);
+  objectBytes_ -= page->slotSize;
+  if (nurseryCount_ > 0 && page->young)
+    --nurseryCount_;
+  else
+    --objectCount_;
+}
+
+void Allocator::setGcStepSize(int size) {
+  stepSize_ = std::max(size, 0);
+  if (stepSize_ == 0 && phase_ != IDLE)
+    collectGarbage();
 }
 
 void Allocator::collectGarbage() {
+  long start = nowUsec();
+  size_t heapBytesBefore = getHeapBytes();
+  abandonCycle();
 #ifndef NDEBUG
   std::cerr << "\n**** Start GC ****\n"
-    "  Before #" << objectCount_ << "\n";
+    "  Before #" << (objectCount_ + nurseryCount_) << ", " << getHeapBytes() << " bytes\n";
 #endif
+  resetMarks();
   markArenaObjects();
   callback_->markRoot(userdata_);
-  sweep();
+  if (workers_ != NULL)
+    markInParallel();
+  markStep(INT_MAX);
+  clearWeakReferences();
+
+  // Free lists are rebuilt in page order.
+  memset(pools_, 0, sizeof(pools_));
+  memset(stats_.liveObjects, 0, sizeof(stats_.liveObjects));
+  memset(stats_.liveBytes, 0, sizeof(stats_.liveBytes));
+  int freed = 0;
+  if (workers_ == NULL || !sweepInParallel(&freed)) {
+    for (Page** pp = &pages_; *pp != NULL; ) {
+      Page* page = *pp;
+      Page* next = page->next;
+      if (!reclaimPage(page, &freed)) {
+        *pp = next;
+        continue;
+      }
+      pp = &page->next;
+    }
+  }
+  objectCount_ += nurseryCount_ - freed;
+  nurseryCount_ = 0;
 #ifndef NDEBUG
-  std::cerr << "  After  #" << objectCount_ << "\n\n";
+  std::cerr << "  After  #" << objectCount_ << ", " << getHeapBytes() << " bytes\n\n";
 #endif
-  nextGc_ = objectCount_ * 2;
+  updateNextGc();
+  long pause = nowUsec() - start;
+  recordPause(pause);
+  finishGc(GcEvent::FULL, pause, heapBytesBefore);
+}
+
+// Minor GC: old objects are treated as live, and survivors are promoted.
+void Allocator::collectNursery() {
+  long start = nowUsec();
+  size_t heapBytesBefore = getHeapBytes();
+  // Objects promoted by write barrier are on mark stack, and traced too.
+  markArenaObjects();
+  callback_->markRoot(userdata_);
+  markStep(INT_MAX);
+  clearWeakReferences();
+
+  int freed = 0;
+  for (Page** pp = &pages_; *pp != NULL; ) {
+    Page* page = *pp;
+    if (!page->young) {
+      pp = &page->next;
+      continue;
+    }
+    page->young = false;
+    int n = sweepPage(page, true);
+    freed += n;
+    objectBytes_ -= n * page->slotSize;
+    if (page->sizeClass == LARGE_OBJECT && !testBit(page->liveBits, PAGE_HEADER_SIZE >> 3)) {
+      *pp = page->next;
+      releasePage(page);
+      continue;
+    }
+    pp = &page->next;
+  }
+  objectCount_ += nurseryCount_ - freed;
+  nurseryCount_ = 0;
+  long pause = nowUsec() - start;
+  recordPause(pause);
+  finishGc(GcEvent::MINOR, pause, heapBytesBefore);
+}
+
+// Starts incremental full GC: marks roots, and the rest is done in steps.
+void Allocator::startCycle() {
+  long start = nowUsec();
+  cycleHeapBytes_ = getHeapBytes();
+  resetMarks();
+  objectCount_ += nurseryCount_;
+  nurseryCount_ = 0;
+  phase_ = MARKING;
+  stepDebt_ = 0;
+  markArenaObjects();
+  callback_->markRoot(userdata_);
+  cyclePauseUsec_ = nowUsec() - start;
+  recordPause(cyclePauseUsec_);
+  ++stats_.stepCount;
+}
+
+void Allocator::step() {
+  long start = nowUsec();
+  // Large buffers leave debt, which is paid in following steps.
+  stepDebt_ = std::max(stepDebt_ - std::max(stepSize_ / STEP_WORK_RATIO, 1), 0);
+  if (phase_ == MARKING) {
+    bool done = markStep(stepSize_);
+    if (done) {
+      markArenaObjects();
+      callback_->markRoot(userdata_);
+      markStep(INT_MAX);
+      clearWeakReferences();
+
+      // Pages are swept from the list, new pages are not.
+      phase_ = SWEEPING;
+      sweepPages_ = pages_;
+      pages_ = NULL;
+      memset(pools_, 0, sizeof(pools_));  // Rebuilt in sweep.
+      memset(stats_.liveObjects, 0, sizeof(stats_.liveObjects));
+      memset(stats_.liveBytes, 0, sizeof(stats_.liveBytes));
+    }
+  } else if (sweepStep(stepSize_)) {
+    phase_ = IDLE;
+    updateNextGc();
+  }
+
+  long pause = nowUsec() - start;
+  recordPause(pause);
+  ++stats_.stepCount;
+  cyclePauseUsec_ += pause;
+  if (phase_ == IDLE)
+    finishGc(GcEvent::INCREMENTAL, cyclePauseUsec_, cycleHeapBytes_);
+}
+
+// Traces objects on mark stack up to the budget, returns true if no one
+// is left. Rescan for overflow is done at once.
+bool Allocator::markStep(int budget) {
+  for (;;) {
+    for (; markStack_.count > 0; --budget) {
+      if (budget <= 0)
+        return false;
+      markStack_.items[--markStack_.count]->trace();
+    }
+    if (!markStack_.overflow)
+      return true;
+    rescanMarkedObjects();
+  }
+}
+
+// Traces all marked objects, to find ones which are dropped from mark
+// stack. Old objects are traced too, but their children are marked.
+void Allocator::rescanMarkedObjects() {
+  markStack_.overflow = false;
+  for (Page* page = pages_; page != NULL; page = page->next) {
+    for (int i = 0; i < BITMAP_WORDS; ++i) {
+      for (uint32_t bits = page->liveBits[i] & page->markBits[i]; bits != 0; bits &= bits - 1) {
+        int index = i * 32 + countTrailingZeros(bits);
+        reinterpret_cast<GcObject*>(reinterpret_cast<char*>(page) + index * 8)->trace();
+      }
+    }
+  }
 }
 
-void Allocator::sweep() {
+// Sweeps pages up to the budget (in object slots), returns true if done.
+bool Allocator::sweepStep(int budget) {
+  int freed = 0;
+  while (sweepPages_ != NULL && budget > 0) {
+    Page* page = sweepPages_;
+    sweepPages_ = page->next;
+    budget -= page->sizeClass != LARGE_OBJECT ? getSlotCount(page->sizeClass) : 1;
+    if (reclaimPage(page, &freed)) {
+      page->next = pages_;
+      pages_ = page;
+    }
+  }
+  objectCount_ -= freed;
+  return sweepPages_ == NULL;
+}
+
+void Allocator::abandonCycle() {
+  if (phase_ == IDLE)
+    return;
+  // Pages which are not swept yet, are swept by following full GC.
+  while (sweepPages_ != NULL) {
+    Page* page = sweepPages_;
+    sweepPages_ = page->next;
+    page->next = pages_;
+    pages_ = page;
+  }
+  phase_ = IDLE;
+}
+
+void Allocator::resetMarks() {
+  for (Page* page = pages_; page != NULL; page = page->next)
+    memset(page->markBits, 0, sizeof(page->markBits));
+  markStack_.count = 0;
+  markStack_.overflow = false;
+}
+
+bool Allocator::expandMarkStack(MarkStack* stack) {
+  int capacity = stack->capacity > 0 ? stack->capacity * 2 : 1024;
+  // Not to run GC while it is marking.
+  void* p = callAllocFunc(stack->items, sizeof(GcObject*) * capacity);
+  if (p == NULL)
+    return false;
+  stack->items = static_cast<GcObject**>(p);
+  stack->capacity = capacity;
+  return true;
+}
+
+// Traces objects on mark stack with workers, overflow is left to caller.
+void Allocator::markInParallel() {
+  // Worker 0 uses allocator's stack, so it must be able to take.
+  if (markStack_.capacity == 0 && !expandMarkStack(&markStack_))
+    return;
+  workers_->idleCount = 0;
+  workers_->markDone = false;
+  workers_->run(&Allocator::markWorker);
+  for (int i = 1; i < workers_->threadNum; ++i) {
+    MarkStack* stack = &workers_->stacks[i];
+    if (stack->overflow)
+      markStack_.overflow = true;
+    stack->overflow = false;
+  }
+}
+
+void Allocator::markWorker(int index) {
+  Workers* workers = workers_;
+  MarkStack* stack = index > 0 ? &workers->stacks[index] : &markStack_;
+  workerStack = stack;
+  do {
+    while (stack->count > 0) {
+      stack->items[--stack->count]->trace();
+      if (stack->count >= 2 && workers->idleCount.load(std::memory_order_relaxed) > 0)
+        workers->share(stack);
+    }
+  } while (workers->take(stack));
+  workerStack = NULL;
+}
+
+// Sweeps all pages with workers, and rebuilds free lists in page order.
+// Returns false if it can't.
+bool Allocator::sweepInParallel(int* pFreed) {
   int n = 0;
-  GcObject* prev = NULL;
-  for (GcObject* gcobj = objectTop_; gcobj != NULL; ) {
-    if (gcobj->isMarked()) {
-      prev = gcobj;
-      gcobj->clearMark();
-      gcobj = gcobj->next_;
-      ++n;
+  for (Page* page = pages_; page != NULL; page = page->next)
+    ++n;
+  if (n == 0)
+    return true;
+  SweepItem* items = static_cast<SweepItem*>(callAllocFunc(NULL, sizeof(SweepItem) * n));
+  if (items == NULL)
+    return false;
+  n = 0;
+  for (Page* page = pages_; page != NULL; page = page->next)
+    items[n++].page = page;
+
+  workers_->items = items;
+  workers_->itemCount = n;
+  workers_->nextItem = 0;
+  memset(workers_->liveCounts, 0, sizeof(LiveCounts) * workers_->threadNum);
+  workers_->run(&Allocator::sweepWorker);
+  for (int i = 0; i < workers_->threadNum; ++i) {
+    const LiveCounts& counts = workers_->liveCounts[i];
+    for (int type = 0; type < NUMBER_OF_TYPES; ++type) {
+      stats_.liveObjects[type] += counts.objects[type];
+      stats_.liveBytes[type] += counts.bytes[type];
+    }
+  }
+
+  Page** tail = &pages_;
+  for (int i = 0; i < n; ++i) {
+    const SweepItem& item = items[i];
+    Page* page = item.page;
+    *pFreed += item.freed;
+    objectBytes_ -= item.freed * page->slotSize;
+    page->young = false;
+    if (item.live == 0) {
+      releasePage(page);
       continue;
     }
+    *tail = page;
+    tail = &page->next;
+    if (item.freeHead != NULL) {
+      Pool& pool = pools_[page->sizeClass];
+      *static_cast<void**>(item.freeTail) = pool.freeList;
+      pool.freeList = item.freeHead;
+    }
+  }
+  *tail = NULL;
+  freeRaw(items);
+  return true;
+}
 
-    GcObject* next = gcobj->next_;
-    if (prev == NULL)
-      objectTop_ = next;
-    else
-      prev->next_ = next;
-    gcobj->destruct(this);
-    this->free(gcobj);
-    gcobj = next;
+void Allocator::sweepWorker(int index) {
+  Workers* workers = workers_;
+  LiveCounts* counts = &workers->liveCounts[index];
+  for (;;) {
+    int i = workers->nextItem++;
+    if (i >= workers->itemCount)
+      break;
+    SweepItem* item = &workers->items[i];
+    Page* page = item->page;
+    item->freed = sweepPage(page, false);
+    item->live = countBits(page->liveBits);
+    item->freeHead = item->freeTail = NULL;
+    if (item->live > 0) {
+      countLiveObjects(page, counts->objects, counts->bytes);
+      if (page->sizeClass != LARGE_OBJECT)
+        linkFreeSlots(page, &item->freeHead, &item->freeTail);
+    }
+  }
+}
+
+bool Allocator::reclaimPage(Page* page, int* pFreed) {
+  int n = sweepPage(page, false);
+  *pFreed += n;
+  objectBytes_ -= n * page->slotSize;
+  page->young = false;
+  if (countBits(page->liveBits) == 0) {
+    releasePage(page);
+    return false;
   }
-  objectCount_ = n;
+  countLiveObjects(page, stats_.liveObjects, stats_.liveBytes);
+  if (page->sizeClass != LARGE_OBJECT)
+    rebuildFreeList(page);
+  return true;
+}
+
+int Allocator::sweepPage(Page* page, bool reuse) {
+  Pool* pool = page->sizeClass != LARGE_OBJECT ? &pools_[page->sizeClass] : NULL;
+  int n = 0;
+  for (int i = 0; i < BITMAP_WORDS; ++i) {
+    uint32_t dead = page->liveBits[i] & ~page->markBits[i];
+    if (dead == 0)
+      continue;
+    page->liveBits[i] &= ~dead;
+    for (; dead != 0; dead &= dead - 1) {
+      int index = i * 32 + countTrailingZeros(dead);
+      GcObject* gcobj = reinterpret_cast<GcObject*>(reinterpret_cast<char*>(page) + index * 8);
+      gcobj->destruct(this);
+      ++n;
+      if (pool == NULL)
+        continue;
+#ifndef NDEBUG
+      // Breaks dangling references.
+      memset(static_cast<void*>(gcobj), 0xcd, getClassSize(page->sizeClass));
+#endif
+      if (reuse) {
+        *reinterpret_cast<void**>(gcobj) = pool->freeList;
+        pool->freeList = gcobj;
+      }
+    }
+  }
+  return n;
+}
+
+void Allocator::rebuildFreeList(Page* page) {
+  // Prepended, to allocate in address order.
+  void* head;
+  void* tail;
+  linkFreeSlots(page, &head, &tail);
+  if (head != NULL) {
+    Pool& pool = pools_[page->sizeClass];
+    *static_cast<void**>(tail) = pool.freeList;
+    pool.freeList = head;
+  }
+}
+
+void Allocator::countLiveObjects(Page* page, size_t* objects, size_t* bytes) {
+  for (int i = 0; i < BITMAP_WORDS; ++i) {
+    for (uint32_t bits = page->liveBits[i]; bits != 0; bits &= bits - 1) {
+      int index = i * 32 + countTrailingZeros(bits);
+      GcObject* gcobj = reinterpret_cast<GcObject*>(reinterpret_cast<char*>(page) + index * 8);
+      ++objects[gcobj->typeTag_];
+      bytes[gcobj->typeTag_] += page->slotSize;
+    }
+  }
+}
+
+void Allocator::setAllocSampleInterval(int interval) {
+  sampleInterval_ = std::max(interval, 0);
+  resetSampleCountdown();
+}
+
+void Allocator::resetSampleCountdown() {
+  if (sampleInterval_ <= 0) {
+    sampleCountdown_ = INT_MAX;
+    return;
+  }
+  // Uniform in [1, 2 * interval - 1] (xorshift), to average the interval.
+  sampleRandom_ ^= sampleRandom_ << 13;
+  sampleRandom_ ^= sampleRandom_ >> 17;
+  sampleRandom_ ^= sampleRandom_ << 5;
+  sampleCountdown_ = 1 + static_cast<int>(sampleRandom_ % (2u * sampleInterval_ - 1));
+}
+
+void Allocator::sampleAllocation(int typeTag, size_t bytes) {
+  resetSampleCountdown();
+  if (sampleInterval_ > 0)
+    callback_->allocSampled(typeTag, bytes, userdata_);
+}
+
+void Allocator::recordPause(long pauseUsec) {
+  stats_.totalPauseUsec += pauseUsec;
+  if (stats_.maxPauseUsec < pauseUsec)
+    stats_.maxPauseUsec = pauseUsec;
+  int bucket = 0;
+  for (long bound = 100; bucket < GcStats::PAUSE_BUCKETS - 1 && pauseUsec >= bound; bound *= 10)
+    ++bucket;
+  ++stats_.pauseHistogram[bucket];
+}
+
+void Allocator::finishGc(GcEvent::Kind kind, long pauseUsec, size_t heapBytesBefore) {
+  if (kind == GcEvent::MINOR) {
+    ++stats_.minorCount;
+  } else {
+    ++stats_.fullCount;
+    lastFullGcUsec_ = nowUsec();
+    allocatedAtFullGc_ = stats_.totalAllocatedBytes;
+  }
+  GcEvent event;
+  event.kind = kind;
+  event.pauseUsec = pauseUsec;
+  event.heapBytesBefore = heapBytesBefore;
+  event.heapBytesAfter = getHeapBytes();
+  callback_->gcFinished(event, userdata_);
+}
+
+void Allocator::getGcStats(GcStats* stats) const {
+  *stats = stats_;
+  stats->heapBytes = getHeapBytes();
+  long elapsed = nowUsec() - lastFullGcUsec_;
+  stats->allocationRate = elapsed > 0 ?
+      (stats_.totalAllocatedBytes - allocatedAtFullGc_) * 1e6 / elapsed : 0;
 }
 
 }  // namespace yalp
@@ -1,6 +1,7 @@
 #ifndef _ALLOCATOR_HH_
 #define _ALLOCATOR_HH_
 
+#include "yalp.hh"
 #include "yalp/gc_object.hh"
 #include <new>
 #include <stddef.h>  // for size_t
@@ -9,19 +10,35 @@ namespace yalp {
 
 typedef void* (*AllocFunc)(void* p, size_t size);
 
+struct Page;
+struct Chunk;
+
+// Stack of marked objects, whose children are not marked yet.
+struct MarkStack {
+  GcObject** items;
+  int count;
+  int capacity;
+  bool overflow;  // Dropped an object, which is found by rescan.
+};
+
 class Allocator {
 public:
   struct Callback {
     virtual void allocFailed(void* p, size_t size, void* userdata) = 0;
     virtual void markRoot(void* userdata) = 0;
+    virtual void gcFinished(const GcEvent& event, void* userdata) = 0;
+    virtual void allocSampled(int typeTag, size_t bytes, void* userdata) = 0;
   };
 
-  static Allocator* create(AllocFunc allocFunc, Callback* callback);
+  // Full GC marks and sweeps with `gcThreadNum` threads, including the
+  // caller's one.
+  static Allocator* create(AllocFunc allocFunc, Callback* callback,
+                           int gcThreadNum = 1);
   void release();
 
   void setUserData(void* userdata)  { userdata_ = userdata; }
 
-  // Allocates non managed memory.
+  // Allocates non managed memory, which is counted in heap size.
   void* alloc(size_t size);
   void* realloc(void* p, size_t size);
   void free(void* p);
@@ -29,41 +46,189 @@ public:
   int saveArena() const  { return arenaIndex_; }
   void restoreArena(int index)  { arenaIndex_ = index; }
   void restoreArenaWith(int index, GcObject* gcobj);
+  void pushArena(GcObject* gcobj) {
+    if (arenaIndex_ >= arenaCapacity_)
+      expandArena();
+    arena_[arenaIndex_++] = gcobj;
+    if (maxArenaIndex_ < arenaIndex_)
+      maxArenaIndex_ = arenaIndex_;
+  }
 
-  // Runs garbage collection.
+  // Runs full garbage collection.
   void collectGarbage();
+  // Sets maximum work (number of objects) of an incremental GC step,
+  // 0 runs full GC at once.
+  void setGcStepSize(int size);
+  // Full GC is triggered when heap size reaches `factor` times of the live
+  // size after last GC, or `limit` (0 for no limit) if it is smaller.
+  void setGcGrowthFactor(double factor);
+  void setGcHeapLimit(size_t limit);
+  // Bytes of managed objects and non managed memory.
+  size_t getHeapBytes() const  { return objectBytes_ + externalBytes_; }
+  // Hard limit of heap size (0 for no limit): allocation over it runs full
+  // GC, and calls `allocFailed` if it is still over.
+  void setHeapBudget(size_t budget);
+  // Gives up the object whose constructor is running, when it can't be
+  // completed (allocation failed in it).
+  void discardConstructing();
+  void getGcStats(GcStats* stats) const;
+  // Calls `allocSampled` for an object in about every `interval`
+  // allocations, 0 to stop.
+  void setAllocSampleInterval(int interval);
+  // Registers an object which refers others weakly: `clearWeak` is called
+  // on it after marking, while it is alive.
+  void addWeakObject(GcObject* gcobj);
 
   // Create new object with managed memory.
   template <typename T, typename... Params>
   T* newObject(Params... parameters) {
-    return new(objAlloc(sizeof(T))) T(parameters...);
+    return newSizedObject<T>(sizeof(T), parameters...);
+  }
+  // Same as above, with space after the object: `size` includes it.
+  template <typename T, typename... Params>
+  T* newSizedObject(size_t size, Params... parameters) {
+    GcObject* outer = constructing_;
+    void* memory = objAlloc(size);
+    size_t slotSize = lastSlotSize_;
+    constructing_ = static_cast<GcObject*>(memory);
+    T* obj = new(memory) T(parameters...);
+    constructing_ = outer;
+    // Counted after construction, which sets the type.
+    int type = static_cast<GcObject*>(obj)->typeTag_;
+    ++stats_.allocatedObjects[type];
+    stats_.allocatedBytes[type] += slotSize;
+    if (--sampleCountdown_ <= 0)
+      sampleAllocation(type, slotSize);
+    return obj;
   }
 
   inline int getMaxArenaIndex() const  { return maxArenaIndex_; }
 
 private:
-  static const int ARENA_SIZE = 50;
+  static const int ARENA_INITIAL_SIZE = 64;
+  // Number of size classes for pooled objects, larger one is allocated alone.
+  static const int SIZE_CLASS_NUM = 44;
+
+  // Objects in same size class.
+  struct Pool {
+    void* freeList;  // Swept objects, linked through their first word.
+    char* top;       // Unused area in the current page.
+    char* end;
+  };
+
+  // Phase of incremental full GC.
+  enum Phase {
+    IDLE,
+    MARKING,
+    SWEEPING,
+  };
 
-  Allocator(AllocFunc allocFunc, Callback* callback);
+  struct Workers;
+  struct SweepItem;
+
+  Allocator(AllocFunc allocFunc, Callback* callback, int gcThreadNum);
   ~Allocator();
 
   inline void markArenaObjects();
-  void sweep();
+  // For memory not counted in heap size: pages and GC's own.
+  void* allocRaw(size_t size);
+  void freeRaw(void* p)  { callAllocFunc(p, 0); }
+  void updateNextGc();
+  void checkBudget(size_t size);
+  void expandArena();
+  // Clears weak references of live weak objects, and forgets dead ones.
+  void clearWeakReferences();
+  void collectNursery();
+  void startCycle();
+  void step();
+  bool markStep(int budget);
+  bool sweepStep(int budget);
+  void abandonCycle();
+  void resetMarks();
+  void pushMark(MarkStack* stack, GcObject* gcobj) {
+    if (stack->count < stack->capacity || expandMarkStack(stack))
+      stack->items[stack->count++] = gcobj;
+    else
+      stack->overflow = true;
+  }
+  bool expandMarkStack(MarkStack* stack);
+  void rescanMarkedObjects();
+  // Calls allocation function, which might be called from GC workers.
+  void* callAllocFunc(void* p, size_t size);
+  // Parallel full GC.
+  void markInParallel();
+  bool sweepInParallel(int* pFreed);
+  void markWorker(int index);
+  void sweepWorker(int index);
+  // Sweeps the page in full GC, and releases it if it gets empty.
+  // Returns false if released.
+  bool reclaimPage(Page* page, int* pFreed);
+  // Destructs unmarked objects in the page, returns the number of them.
+  int sweepPage(Page* page, bool reuse);
+  void rebuildFreeList(Page* page);
+  void releasePage(Page* page);
+  // Adds live objects in the page to the counts, for each type.
+  void countLiveObjects(Page* page, size_t* objects, size_t* bytes);
+  void resetSampleCountdown();
+  void sampleAllocation(int typeTag, size_t bytes);
+  void recordPause(long pauseUsec);
+  // Counts the GC, and calls back.
+  void finishGc(GcEvent::Kind kind, long pauseUsec, size_t heapBytesBefore);
 
   // Allocates managed memory.
   void* objAlloc(size_t size);
+  void* poolAlloc(size_t size);
+  void* allocLarge(size_t size);
+  Page* allocPage(int sizeClass);
 
   AllocFunc allocFunc_;
   Callback* callback_;
   void* userdata_;
 
-  GcObject* objectTop_;
+  // Old generation: survivors of GC, they keep mark bit until full GC.
   int objectCount_;
+  // Young generation: objects allocated after last GC.
+  int nurseryCount_;
+  size_t objectBytes_;  // Slots of allocated objects.
+  size_t externalBytes_;
+
+  Pool pools_[SIZE_CLASS_NUM];
+  Page* pages_;  // Pages in use, including large objects.
+  Page* freePages_;
+  Chunk* chunks_;
 
-  GcObject* arena_[ARENA_SIZE];
+  GcObject** arena_;  // Grows, never shrinks.
   int arenaIndex_;
+  int arenaCapacity_;
   int maxArenaIndex_;
-  int nextGc_;
+  size_t nextGc_;  // Heap size which triggers full GC.
+  double growthFactor_;
+  size_t heapLimit_;
+  size_t heapBudget_;
+  GcObject* constructing_;  // Not traced, its fields are not set yet.
+  GcObject** weakObjects_;
+  int weakCount_;
+  int weakCapacity_;
+
+  Phase phase_;
+  int stepSize_;
+  int stepDebt_;  // Allocations since last step.
+  MarkStack markStack_;
+  Workers* workers_;  // NULL if full GC runs in single thread.
+  Page* sweepPages_;  // Pages not swept yet in this cycle.
+
+  GcStats stats_;  // Heap size and allocation rate are calculated.
+  size_t lastSlotSize_;  // Of the object allocated last.
+  long lastFullGcUsec_;
+  size_t allocatedAtFullGc_;  // Total allocated bytes at the time.
+  long cyclePauseUsec_;  // Sum of steps in current incremental cycle.
+  size_t cycleHeapBytes_;  // Heap size at start of the cycle.
+
+  int sampleInterval_;
+  int sampleCountdown_;  // Allocations until next sample.
+  unsigned int sampleRandom_;
+
+  friend class GcObject;
 };
 
 AllocFunc getDefaultAllocFunc();
@@ -40,8 +40,17 @@ static Value s_macroexpand_1(State* state) {
   return state->tailcall(closure, argNum, argsArray);
 }
 
+// Global variable table holds cells, so returns snapshot of their values.
+// It is read-only, because modifying it doesn't change global variables.
 static Value s_globalVariableTable(State* state) {
-  return Value(state->getGlobalVariableTable());
+  SHashTable* result = state->createHashTable(false);
+  for (auto kv : *state->getGlobalVariableTable()->getHashTable()) {
+    const GlobalCell* cell = static_cast<GlobalCell*>(kv.value.toObject());
+    if (cell->isBound())
+      result->put(kv.key, cell->get());
+  }
+  result->setReadOnly();
+  return Value(result);
 }
 
 static Value s_type(State* state) {
@@ -514,18 +523,26 @@ static Value s_error(State* state) {
   return state->multiValues();
 }
 
+// (table [compare] [weakness]): options are given in any order.
 static Value s_table(State* state) {
   bool equal = true;
-  if (state->getArgNum() > 0) {
-    Value type = state->getArg(0);
+  State::Weakness weakness = State::NOT_WEAK;
+  for (int n = state->getArgNum(), i = 0; i < n; ++i) {
+    Value type = state->getArg(i);
     if (type.eq(state->intern("eq?")))
       equal = false;
     else if (type.eq(state->intern("equal?")))
       equal = true;
+    else if (type.eq(state->intern("weak-key")))
+      weakness = State::WEAK_KEY;
+    else if (type.eq(state->intern("weak-value")))
+      weakness = State::WEAK_VALUE;
+    else if (type.eq(state->intern("weak-key-value")))
+      weakness = State::WEAK_KEY_VALUE;
     else
-      state->runtimeError("Illegal compare type `%@`", &type);
+      state->runtimeError("Illegal table option `%@`", &type);
   }
-  return Value(state->createHashTable(equal));
+  return Value(state->createHashTable(equal, weakness));
 }
 
 static Value s_tableGet(State* state) {
@@ -545,7 +562,10 @@ static Value s_tablePut(State* state) {
   Value key = state->getArg(1);
   Value value = state->getArg(2);
   state->checkType(h, TT_HASH_TABLE);
-  static_cast<SHashTable*>(h.toObject())->put(key, value);
+  SHashTable* table = static_cast<SHashTable*>(h.toObject());
+  if (table->isReadOnly())
+    state->runtimeError("Cannot modify read-only table");
+  table->put(key, value);
   return value;
 }
 
@@ -561,16 +581,39 @@ static Value s_tableDelete(State* state) {
   Value h = state->getArg(0);
   Value key = state->getArg(1);
   state->checkType(h, TT_HASH_TABLE);
-  return state->boolean(static_cast<SHashTable*>(h.toObject())->remove(key));
+  SHashTable* table = static_cast<SHashTable*>(h.toObject());
+  if (table->isReadOnly())
+    state->runtimeError("Cannot modify read-only table");
+  return state->boolean(table->remove(key));
 }
 
 static Value s_tableKeys(State* state) {
   Value h = state->getArg(0);
   state->checkType(h, TT_HASH_TABLE);
 
-  const SHashTable::TableType* ht = static_cast<SHashTable*>(h.toObject())->getHashTable();
+  SHashTable* table = static_cast<SHashTable*>(h.toObject());
+  const SHashTable::TableType* ht = table->getHashTable();
   Value result = Value::NIL;
   int arena = state->saveArena();
+  if (table->getWeakness() != State::NOT_WEAK) {
+    // GC while consing removes entries from weak table, so keys are held
+    // in a vector (kept in arena) first. Allocating the vector can run GC
+    // too, so the table might have less entries than its size.
+    Allocator* allocator = state->getAllocator();
+    Vector* keys = allocator->newObject<Vector>(allocator, ht->getEntryCount());
+    int n = 0;
+    for (auto kv : *ht) {
+      if (n >= keys->size())
+        break;
+      keys->set(n++, kv.key);
+    }
+    for (int i = 0; i < n; ++i) {
+      result = state->cons(keys->get(i), result);
+      state->restoreArenaWith(arena + 1, result);
+    }
+    state->restoreArenaWith(arena, result);
+    return result;
+  }
   for (auto kv : *ht) {
     result = state->cons(kv.key, result);
     state->restoreArenaWith(arena, result);
@@ -578,6 +621,16 @@ static Value s_tableKeys(State* state) {
   return result;
 }
 
+static Value s_weakRef(State* state) {
+  return state->createWeakRef(state->getArg(0));
+}
+
+static Value s_weakRefGet(State* state) {
+  Value w = state->getArg(0);
+  state->checkType(w, TT_WEAK_REF);
+  return static_cast<WeakRef*>(w.toObject())->get();
+}
+
 static Value s_makeVector(State* state) {
   Value ssize = state->getArg(0);
   state->checkType(ssize, TT_FIXNUM);
@@ -918,12 +971,14 @@ void installBasicFunctions(State* state) {
     { "load-binary", s_loadBinary, 1 },
     { "error", s_error, 1, -1 },
 
-    { "table", s_table, 0, 1 },
+    { "table", s_table, 0, 2 },
     { "table-get", s_tableGet, 2, 3 },
     { "table-put!", s_tablePut, 3 },
     { "table-exists?", s_tableExists, 2 },
     { "table-delete!", s_tableDelete, 2 },
     { "table-keys", s_tableKeys, 1 },
+    { "weak-ref", s_weakRef, 1 },
+    { "weak-ref-get", s_weakRefGet, 1 },
 
     { "make-vector", s_makeVector, 1, 2 },
     { "vector", s_vector, 0, -1 },
@@ -3,241 +3,265 @@ namespace yalp {
 extern const char bootBinaryData[];
 const char bootBinaryData[] = 
 "(11 11 10)\n"
-"(3 (9 2 0 (26 1 29 6 -2 . #0=(3 (5 (#\\nl nil) 0 3 (1 0 0 2 read-char 4 1) 0 2 member 4 2) 7 (11 11 17) 19 1 0 . #0#)) 0 5 #\\; 0 2 set-macro-character 4 2) 10)\n"
-"(3 (9 3 0 (26 3 29 6 -2 5 1 6 -3 . #0=(3 (1 0 0 2 read-char 4 1) 6 -4 5 #\\# 0 1 -4 38 7 (5 #\\| 0 3 (1 0 0 2 read-char 4 1) 38 7 (5 1 0 1 -3 0 32 2 0 19 1 1 . #0#) 1 -3 0 19 1 1 . #0#) 5 #\\| 0 1 -4 38 7 (5 #\\# 0 3 (1 0 0 2 read-char 4 1) 38 7 (5 1 0 1 -3 0 41 2 7 (5 1 0 1 -3 0 33 2 0 19 1 1 . #0#) 11 . #1=(11 17)) 1 -3 0 19 1 1 . #0#) 29 0 1 -4 38 7 (3 (5 \"Block comment not closed\" 0 2 error 4 1) . #1#) 1 -3 0 19 1 1 . #0#)) 0 5 #\\| 0 5 #\\# 0 2 set-dispatch-macro-character 4 3) 10)\n"
-"(3 (9 2 0 (3 (1 0 0 2 read 4 1) 0 5 quote 0 2 list 8 2) 0 5 #\\' 0 2 set-macro-character 4 2) 10)\n"
-"(3 (9 2 0 (3 (1 0 0 5 #\\] 0 2 read-delimited-list 4 2) 0 5 (_) 0 5 ^ 0 2 list 8 3) 0 5 #\\[ 0 2 set-macro-character 4 2) 10)\n"
-"(3 (9 3 0 (5 16 0 1 0 0 2 read-num-literal 8 2) 0 5 #\\x 0 5 #\\# 0 2 set-dispatch-macro-character 4 3) 10)\n"
-"(3 (9 3 0 (5 2 0 1 0 0 2 read-num-literal 8 2) 0 5 #\\b 0 5 #\\# 0 2 set-dispatch-macro-character 4 3) 10)\n"
-"(3 (9 3 0 (3 (1 0 0 5 #\\) 0 2 read-delimited-list 4 2) 0 2 list->vector 8 1) 0 5 #\\( 0 5 #\\# 0 2 set-dispatch-macro-character 4 3) 10)\n"
-"(3 (9 3 0 (3 (1 0 0 2 read 4 1) 0 2 eval 8 1) 0 5 #\\. 0 5 #\\# 0 2 set-dispatch-macro-character 4 3) 10)\n"
-"(9 1 0 (26 1 . #0=(3 (1 0 0 2 macroexpand-1 4 1) 6 -2 3 (1 0 0 1 -2 0 2 equal? 4 2) 7 (1 0 17) 1 -2 0 19 0 1 . #0#)) 16 macroexpand 10)\n"
-"(25 defun (2 -1) 0 (3 (3 (3 (1 2 0 5 (return) 0 5 ^ 0 2 list* 4 3) 0 5 call/cc 0 2 list 4 2) 0 1 1 0 5 ^ 0 2 list 4 3) 0 1 0 0 5 def 0 2 list 8 3) 10)\n"
-"(9 1 0 (1 0 7 (29 . #0=(17)) 5 t . #0#) 16 not 10)\n"
-"(9 1 0 (1 0 7 (29 . #0=(17)) 5 t . #0#) 16 null? 10)\n"
+"(3 (9 2 0 (26 1 29 6 -2 . #0=(3 (44 (#\\nl nil) 3 (43 0 45 read-char 1) 0 45 member 2) 7 (11 11 17) 19 1 0 . #0#)) 0 44 #\\; 45 set-macro-character 2) 10)\n"
+"(3 (9 3 0 (26 3 29 6 -2 5 1 6 -3 . #0=(3 (43 0 45 read-char 1) 6 -4 44 #\\# 1 -4 38 7 (44 #\\| 3 (43 0 45 read-char 1) 38 7 (44 1 43 -3 32 2 0 19 1 1 . #0#) 43 -3 19 1 1 . #0#) 44 #\\| 1 -4 38 7 (44 #\\# 3 (43 0 45 read-char 1) 38 7 (44 1 43 -3 41 2 7 (44 1 43 -3 33 2 0 19 1 1 . #0#) 11 . #1=(11 17)) 43 -3 19 1 1 . #0#) 29 0 1 -4 38 7 (3 (44 \"Block comment not closed\" 45 error 1) . #1#) 43 -3 19 1 1 . #0#)) 0 44 #\\| 44 #\\# 45 set-dispatch-macro-character 3) 10)\n"
+"(3 (9 2 0 (3 (43 0 45 read 1) 0 44 quote 2 list 8 2) 0 44 #\\' 45 set-macro-character 2) 10)\n"
+"(3 (9 2 0 (3 (43 0 44 #\\] 45 read-delimited-list 2) 0 44 (_) 44 ^ 2 list 8 3) 0 44 #\\[ 45 set-macro-character 2) 10)\n"
+"(3 (9 3 0 (44 16 43 0 2 read-num-literal 8 2) 0 44 #\\x 44 #\\# 45 set-dispatch-macro-character 3) 10)\n"
+"(3 (9 3 0 (44 2 43 0 2 read-num-literal 8 2) 0 44 #\\b 44 #\\# 45 set-dispatch-macro-character 3) 10)\n"
+"(3 (9 3 0 (3 (43 0 44 #\\) 45 read-delimited-list 2) 0 2 list->vector 8 1) 0 44 #\\( 44 #\\# 45 set-dispatch-macro-character 3) 10)\n"
+"(3 (9 3 0 (3 (43 0 45 read 1) 0 2 eval 8 1) 0 44 #\\. 44 #\\# 45 set-dispatch-macro-character 3) 10)\n"
+"(9 1 0 (26 1 . #0=(3 (43 0 45 macroexpand-1 1) 6 -2 3 (43 0 43 -2 45 equal? 2) 7 (1 0 17) 43 -2 19 0 1 . #0#)) 16 macroexpand 10)\n"
+"(25 defun (2 -1) 0 (3 (3 (3 (43 2 44 (return) 44 ^ 45 list* 3) 0 44 call/cc 45 list 2) 0 43 1 44 ^ 45 list 3) 0 43 0 44 def 2 list 8 3) 10)\n"
+"(9 1 0 (46 0 (29 . #0=(17)) 5 t . #0#) 16 not 10)\n"
+"(9 1 0 (46 0 (29 . #0=(17)) 5 t . #0#) 16 null? 10)\n"
 "(9 1 0 (1 0 30 30 17) 16 caar 9 1 0 (1 0 30 31 17) 16 cdar 9 1 0 (1 0 31 30 17) 16 cadr 9 1 0 (1 0 31 31 17) 16 cddr 9 1 0 (1 0 30 31 30 17) 16 cadar 9 1 0 (1 0 31 31 30 17) 16 caddr 9 1 0 (1 0 31 31 31 17) 16 cdddr 9 1 0 (1 0 31 31 31 30 17) 16 cadddr 9 1 0 (1 0 31 31 31 31 17) 16 cddddr 9 1 0 (1 0 31 31 31 31 30 17) 16 caddddr 9 1 0 (1 0 31 31 31 31 31 17) 16 cdddddr 10)\n"
-"(9 1 0 (5 int 0 3 (1 0 0 2 type 4 1) 38 17) 16 int? 9 1 0 (5 pair 0 3 (1 0 0 2 type 4 1) 38 17) 16 pair? 9 1 0 (5 symbol 0 3 (1 0 0 2 type 4 1) 38 17) 16 symbol? 9 1 0 (5 string 0 3 (1 0 0 2 type 4 1) 38 17) 16 string? 9 1 0 (5 flonum 0 3 (1 0 0 2 type 4 1) 38 17) 16 flonum? 9 1 0 (5 char 0 3 (1 0 0 2 type 4 1) 38 17) 16 char? 9 1 0 (5 vector 0 3 (1 0 0 2 type 4 1) 38 17) 16 vector? 9 1 0 (5 table 0 3 (1 0 0 2 type 4 1) 38 17) 16 table? 10)\n"
-"(9 (2 -1) 0 (26 3 1 2 7 (29 6 -2 3 (1 2 0 1 1 0 2 cons 4 2) 6 -3 . #1=(3 (1 -3 0 2 null? 0 2 some? 4 2) 7 (29 . #0=(17)) 3 (3 (1 -3 0 2 car 0 2 map 4 2) 0 1 0 0 2 apply 4 2) 6 -4 7 (1 -4 . #0#) 3 (1 -3 0 2 cdr 0 2 map 4 2) 0 19 1 1 . #1#)) 29 6 -2 1 1 6 -3 . #2=(7 (3 (1 -3 30 0 1 0 4 1) 6 -4 7 (1 -4 0 1 -3 0 27 2 . #0#) 1 -3 31 0 19 1 1 1 -3 . #2#) 29 0 29 0 27 2 . #0#)) 16 some? 10)\n"
-"(9 (2 -1) 0 (26 2 1 2 7 (29 6 -2 3 (1 2 0 1 1 0 2 cons 4 2) 6 -3 . #0=(3 (1 -3 0 2 null? 0 2 some? 4 2) 7 (5 t . #1=(17)) 3 (3 (1 -3 0 2 car 0 2 map 4 2) 0 1 0 0 2 apply 4 2) 7 (3 (1 -3 0 2 cdr 0 2 map 4 2) 0 19 1 1 . #0#) 29 . #1#)) 29 6 -2 1 1 6 -3 . #2=(7 (3 (1 -3 30 0 1 0 4 1) 7 (1 -3 31 0 19 1 1 1 -3 . #2#) 29 . #1#) 5 t . #1#)) 16 every? 10)\n"
-"(9 (2 -1) 0 (26 4 1 2 7 (29 6 -2 29 6 -4 3 (1 2 0 1 1 0 2 cons 4 2) 6 -3 . #0=(3 (1 -3 0 2 null? 0 2 some? 4 2) 7 (1 -4 0 2 reverse! 8 1) 3 (1 -4 0 3 (3 (1 -3 0 2 car 0 2 map 4 2) 0 1 0 0 2 apply 4 2) 0 2 cons 4 2) 0 3 (1 -3 0 2 cdr 0 2 map 4 2) 0 19 1 2 . #0#)) 29 6 -2 29 6 -4 1 1 6 -3 . #1=(3 (1 -3 0 2 pair? 4 1) 7 (3 (1 -4 0 3 (1 -3 30 0 1 0 4 1) 0 2 cons 4 2) 0 1 -3 31 0 19 1 2 . #1#) 3 (1 -4 0 2 reverse! 4 1) 6 -5 1 -3 7 (1 -4 7 (3 (3 (1 -3 0 1 0 4 1) 0 1 -4 0 2 set-cdr! 4 2) 1 -5 . #2=(17)) 1 -3 0 1 0 8 1) 1 -5 . #2#)) 16 map 10)\n"
-"(25 do (0 -1) 0 (3 (1 0 0 29 0 5 ^ 0 2 list* 4 3) 0 2 list 8 1) 10)\n"
-"(25 when (1 -1) 0 (3 (1 1 0 5 do 0 2 list* 4 2) 0 1 0 0 5 if 0 2 list 8 3) 10)\n"
-"(25 unless (1 -1) 0 (3 (1 1 0 5 do 0 2 list* 4 2) 0 5 (do) 0 1 0 0 5 if 0 2 list 8 4) 10)\n"
-"(25 set! (2 -1) 0 (1 2 7 (3 (1 2 0 5 set! 0 2 list* 4 2) 0 3 (1 1 0 1 0 0 5 set! 0 2 list 4 3) 0 5 do 0 2 list 8 3) 1 1 0 1 0 0 5 set! 0 2 list 8 3) 10)\n"
-"(25 and (0 -1) 0 (1 0 7 (1 0 31 7 (5 ('nil) 0 3 (1 0 31 0 5 and 0 2 list* 4 2) 0 1 0 30 0 5 if 0 2 list* 8 4) 1 0 30 . #0=(17)) 5 t . #0#) 10)\n"
-"(25 let1 (2 -1) 0 (1 1 0 3 (1 2 0 3 (1 0 0 2 list 4 1) 0 5 ^ 0 2 list* 4 3) 0 2 list 8 2) 10)\n"
-"(25 let (1 -1) 0 (26 2 3 (1 0 0 2 symbol? 4 1) 7 (1 0 7 (1 1 31 6 -3 1 1 30 6 -2 3 (3 (1 -2 0 2 cadr 0 2 map 4 2) 0 1 0 0 2 list* 4 2) 0 3 (3 (1 -3 0 3 (1 -2 0 2 car 0 2 map 4 2) 0 5 ^ 0 2 list* 4 3) 0 1 0 0 5 set! 0 2 list 4 3) 0 29 0 1 0 0 5 let1 0 2 list 8 5) 3 . #1=((1 0 0 9 1 0 (26 1 3 (1 0 0 2 pair? 4 1) 7 (3 (1 0 31 0 2 single? 4 1) 6 -2 7 (11 . #0=(1 0 31 30 17)) 3 (1 0 0 5 \"malformed let: %@\" 0 2 compile-error 4 2) . #0#) 11 . #0#) 0 2 map 4 2) 0 3 (1 1 0 3 (1 0 0 2 car 0 2 map 4 2) 0 5 ^ 0 2 list* 4 3) 0 2 list* 8 2)) 3 . #1#) 10)\n"
-"(25 let* (1 -1) 0 (1 0 7 (3 (3 (3 (1 1 0 1 0 31 0 5 let* 0 2 list* 4 3) 0 2 list 4 1) 0 1 0 30 0 2 append 4 2) 0 5 let1 0 2 list* 8 2) 1 1 0 5 do 0 2 list* 8 2) 10)\n"
-"(25 alet (1 -1) 0 (1 1 0 1 0 0 5 loop 0 5 let 0 2 list* 8 4) 10)\n"
-"(9 2 0 (26 4 1 0 7 (1 0 31 6 -3 1 0 30 6 -2 31 6 -5 1 -2 30 6 -4 5 t 0 1 -4 38 7 (1 -3 7 (5 \"else clause must comes at last in cond\" 0 2 compile-error 8 1) 1 -5 0 5 do 0 2 list* 8 2) 1 -3 0 1 -5 0 1 -4 0 1 1 8 3) 29 17) 16 cond-template 10)\n"
-"(25 cond (0 -1) 0 (9 3 0 (3 (1 2 0 5 cond 0 2 list* 4 2) 0 3 (1 1 0 5 do 0 2 list* 4 2) 0 1 0 0 5 if 0 2 list 8 4) 0 1 0 0 2 cond-template 8 2) 10)\n"
-"(25 acond (0 -1) 0 (9 3 0 (26 1 3 (2 gensym 4 0) 6 -2 3 (3 (1 2 0 5 acond 0 2 list* 4 2) 0 3 (1 1 0 1 -2 0 5 it 0 5 let1 0 2 list* 4 4) 0 1 -2 0 5 if 0 2 list 4 4) 0 1 0 0 1 -2 0 5 let1 0 2 list 8 4) 0 1 0 0 2 cond-template 8 2) 10)\n"
-"(25 aif (1 -1) 0 (3 (1 1 0 5 it 0 5 if 0 2 list* 4 3) 0 1 0 0 5 it 0 5 let1 0 2 list 8 4) 10)\n"
-"(25 awhen (1 -1) 0 (3 (1 1 0 5 do 0 2 list* 4 2) 0 1 0 0 5 aif 0 2 list 8 3) 10)\n"
-"(25 let-gensym (1 -1) 0 (3 (1 0 0 2 pair? 4 1) 7 (1 1 0 3 (1 0 0 9 1 0 (5 (gensym) 0 1 0 0 2 list 8 2) 0 2 map 4 2) 0 5 let 0 2 list* 8 3) 1 1 0 5 (gensym) 0 1 0 0 5 let1 0 2 list* 8 4) 10)\n"
-"(25 while (1 -1) 0 (26 1 3 (2 gensym 4 0) 6 -2 3 (3 (3 (3 (1 -2 0 2 list 4 1) 0 2 list 4 1) 0 1 1 0 2 append 4 2) 0 1 0 0 5 when 0 2 list* 4 3) 0 29 0 1 -2 0 5 let 0 2 list 8 4) 10)\n"
-"(25 awhile (1 -1) 0 (26 1 3 (2 gensym 4 0) 6 -2 3 (3 (3 (3 (1 -2 0 2 list 4 1) 0 2 list 4 1) 0 1 1 0 2 append 4 2) 0 1 0 0 5 awhen 0 2 list* 4 3) 0 29 0 1 -2 0 5 let 0 2 list 8 4) 10)\n"
-"(25 until (1 -1) 0 (26 1 3 (2 gensym 4 0) 6 -2 3 (3 (3 (3 (1 -2 0 2 list 4 1) 0 2 list 4 1) 0 1 1 0 2 append 4 2) 0 1 0 0 5 unless 0 2 list* 4 3) 0 29 0 1 -2 0 5 let 0 2 list 8 4) 10)\n"
-"(25 or (0 -1) 0 (26 1 1 0 7 (3 (2 gensym 4 0) 6 -2 3 (3 (1 0 31 0 5 or 0 2 list* 4 2) 0 1 -2 0 1 -2 0 5 if 0 2 list 4 4) 0 1 0 30 0 1 -2 0 5 let1 0 2 list 8 4) 29 17) 10)\n"
-"(25 case (1 -1) 0 (26 1 3 (2 gensym 4 0) 6 -2 3 (3 (1 1 0 1 -2 0 9 1 1 (26 2 1 0 31 6 -3 1 0 30 6 -2 5 t 0 1 -2 38 7 (1 0 17) 3 (1 -2 0 2 pair? 4 1) 7 (1 -3 0 3 (3 (1 -2 0 5 quote 0 2 list 4 2) 0 12 0 0 5 member 0 2 list 4 3) 0 2 list* 8 2) 1 -3 0 3 (3 (1 -2 0 5 quote 0 2 list 4 2) 0 12 0 0 5 eq? 0 2 list 4 3) 0 2 list* 8 2) 0 2 map 4 2) 0 5 cond 0 2 list* 4 2) 0 1 0 0 1 -2 0 5 let1 0 2 list 8 4) 10)\n"
-"(25 dolist (1 -1) 0 (26 4 1 0 31 30 6 -3 1 0 30 6 -2 3 (2 gensym 4 0) 6 -5 3 (2 gensym 4 0) 6 -4 3 (3 (3 (3 (3 (3 (1 -4 0 5 cdr 0 2 list 4 2) 0 1 -5 0 2 list 4 2) 0 2 list 4 1) 0 1 1 0 2 append 4 2) 0 3 (1 -4 0 5 car 0 2 list 4 2) 0 1 -2 0 5 let1 0 2 list* 4 4) 0 3 (1 -4 0 5 pair? 0 2 list 4 2) 0 5 when 0 2 list 4 3) 0 3 (3 (1 -3 0 1 -4 0 2 list 4 2) 0 2 list 4 1) 0 1 -5 0 5 let 0 2 list 8 4) 10)\n"
-"(25 for0-n (2 -1) 0 (26 2 3 (2 gensym 4 0) 6 -3 3 (2 gensym 4 0) 6 -2 3 (3 (3 (3 (3 (3 (5 (1) 0 1 0 0 5 + 0 2 list* 4 3) 0 1 -3 0 2 list 4 2) 0 2 list 4 1) 0 1 2 0 2 append 4 2) 0 3 (1 -2 0 1 0 0 5 < 0 2 list 4 3) 0 5 when 0 2 list* 4 3) 0 3 (3 (5 (0) 0 1 0 0 2 list* 4 2) 0 2 list 4 1) 0 1 -3 0 5 let 0 2 list 4 4) 0 1 1 0 1 -2 0 5 let1 0 2 list 8 4) 10)\n"
-"(9 1 0 (26 4 3 (1 0 0 2 type 4 1) 6 -2 5 pair 0 1 -2 38 7 (29 6 -3 5 0 6 -5 1 0 6 -4 . #0=(3 (1 -4 0 2 pair? 4 1) 7 (5 1 0 1 -5 0 32 2 0 1 -4 31 0 19 2 2 . #0#) 1 -5 . #1=(17))) 5 string 0 1 -2 38 7 (1 0 0 2 string-length 8 1) 5 vector 0 1 -2 38 7 (1 0 0 2 vector-length 8 1) 5 0 . #1#) 16 length 10)\n"
-"(9 1 0 #0=(3 (1 0 31 0 2 pair? 4 1) 7 (1 0 31 0 19 0 1 . #0#) 1 0 17) 16 last 10)\n"
-"(9 1 0 (26 3 29 6 -2 29 6 -4 1 0 6 -3 . #0=(3 (1 -3 0 2 pair? 4 1) 7 (3 (1 -4 0 1 -3 30 0 2 cons 4 2) 0 1 -3 31 0 19 1 2 . #0#) 1 -4 17)) 16 reverse 10)\n"
-"(9 2 0 (26 4 29 6 -2 29 6 -4 1 1 6 -3 . #0=(3 (1 -3 0 2 pair? 4 1) 7 (3 (1 -4 0 3 (1 -3 0 1 0 4 1) 0 2 cons 4 2) 0 1 -3 31 0 19 1 2 . #0#) 3 (1 -4 0 2 reverse! 4 1) 6 -5 1 -3 7 (1 -4 7 (3 (3 (1 -3 0 1 0 4 1) 0 1 -4 0 2 set-cdr! 4 2) 1 -5 . #1=(17)) 1 -3 0 1 0 8 1) 1 -5 . #1#)) 16 maplist 10)\n"
-"(9 2 0 (1 1 0 1 0 0 9 1 1 (1 0 0 12 0 38 17) 0 2 some? 8 2) 16 member 10)\n"
-"(9 2 0 #0=(1 1 7 (1 0 0 1 1 30 30 38 7 (1 1 30 . #1=(17)) 1 1 31 0 1 0 0 19 0 2 . #0#) 29 . #1#) 16 assoc 10)\n"
-"(9 3 0 (1 2 0 3 (1 1 0 1 0 0 2 cons 4 2) 0 2 cons 8 2) 16 acons 10)\n"
-"(9 2 0 (26 1 . #0=(1 0 7 (1 0 30 6 -2 3 (1 1 0 1 -2 0 2 member 4 2) 7 (1 1 . #1=(0 1 0 31 0 19 0 2 . #0#)) 3 (1 1 0 1 -2 0 2 cons 4 2) . #1#) 1 1 17)) 16 union 10)\n"
-"(9 2 0 #0=(1 0 7 (3 (1 1 0 1 0 30 0 2 member 4 2) 7 (3 (1 1 0 1 0 31 0 2 intersection 4 2) 0 1 0 30 0 2 cons 8 2) 1 1 0 1 0 31 0 19 0 2 . #0#) 29 17) 16 intersection 10)\n"
-"(9 1 0 (26 1 3 (1 0 0 2 pair? 4 1) 7 (1 0 31 6 -2 7 (29 . #0=(17)) 5 t . #0#) 29 . #0#) 16 single? 10)\n"
-"(9 2 0 (26 1 3 (1 0 0 2 reverse! 4 1) 6 -2 3 (1 1 0 1 0 0 2 set-cdr! 4 2) 1 -2 17) 16 nreconc 10)\n"
-"(9 (1 -1) 0 (26 1 1 1 7 (1 1 30 . #0=(6 -2 3 (1 -2 0 3 (1 0 0 2 create-ss-table 4 1) 0 1 0 0 2 write/ss-print 4 3) 1 0 17)) 2 *stdout* . #0#) 16 write/ss 10)\n"
-"(5 0 0 26 1 3 (2 gensym 4 0) 6 -2 0 9 1 1 (26 3 9 3 0 (26 1 3 (1 1 0 1 0 0 2 table-get 4 2) 7 (11 17) 3 (1 2 0 1 0 0 2 table-get 4 2) 6 -2 3 (1 -2 0 1 1 0 1 0 0 2 table-put! 4 3) 1 -2 0 5 1 0 32 2 0 1 2 0 1 0 0 2 table-put! 8 3) 6 -3 3 (5 eq? 0 2 table 4 1) 6 -2 3 (5 0 0 12 0 0 1 -2 0 2 table-put! 4 3) 29 6 -4 20 -4 1 -2 0 1 -4 0 1 -3 0 12 0 0 9 1 4 (26 4 . #0=(3 (1 0 0 2 type 4 1) 6 -2 3 (5 (pair vector) 0 1 -2 0 2 member 4 2) 7 (3 (1 0 0 12 3 0 2 table-exists? 4 2) 7 (12 0 0 1 0 0 12 3 0 12 1 8 3) 3 (29 0 1 0 0 12 3 0 2 table-put! 4 3) 5 pair 0 1 -2 38 7 (3 (1 0 30 0 12 2 21 4 1) 1 0 31 0 19 0 1 . #0#) 5 vector 0 1 -2 38 7 (3 (1 0 0 2 length 4 1) 6 -3 29 6 -4 5 0 6 -5 . #1=(1 -3 0 1 -5 0 39 2 7 (3 (3 (1 -5 0 1 0 0 2 vector-get 4 2) 0 12 2 21 4 1) 5 1 0 1 -5 0 32 2 0 19 3 1 . #1#) 11 . #2=(17))) 29 . #2#) 11 . #2#)) 13 -4 3 (1 0 0 1 -4 21 4 1) 1 -2 17) 16 create-ss-table 26 -2 10)\n"
-"(9 3 0 (26 9 3 (1 0 0 1 1 0 2 table-get 4 2) 6 -2 7 (5 0 0 1 -2 0 39 2 7 (1 -2 0 5 -1 0 33 2 0 5 \"#%@#\" 0 1 2 0 2 format 8 3) 1 . #7=(-2 7 (3 (1 -2 0 5 \"#%@=\" 0 1 2 0 2 format 4 3) 3 (1 -2 0 5 -1 0 33 2 0 1 0 0 1 1 0 2 table-put! 4 3) . #6=(3 (1 0 0 2 type 4 1) 6 -3 5 pair 0 1 -3 38 7 (3 (1 0 31 0 2 single? 4 1) 7 (3 (1 0 31 0 1 1 0 2 table-get 4 2) 6 -4 7 (29 . #4=(6 -4 7 (3 (1 2 0 1 -4 31 0 2 display 4 2) 1 2 0 1 0 31 30 0 2 write 8 2) 29 6 -5 1 0 6 -7 5 \"(\" 6 -6 . #1=(1 -7 7 (3 (1 2 0 1 -6 0 2 display 4 2) 3 (1 2 0 1 1 0 1 -7 30 0 2 write/ss-print 4 3) 1 -7 31 6 -8 7 (3 (1 -8 0 2 pair? 4 1) 6 -9 7 (29 . #2=(6 -9 7 #0=(3 (1 2 0 5 \" . \" 0 2 display 4 2) 3 (1 2 0 1 1 0 1 -8 0 2 write/ss-print 4 3) . #3=(1 2 0 5 \")\" 0 2 display 8 2)) 3 (1 -8 0 1 1 0 2 table-get 4 2) 6 -10 7 #0# 1 -8 0 5 \" \" 0 19 4 2 . #1#)) 5 t . #2#) 29 . #2#) 11 . #3#))) 3 (5 ((quote . \"'\") (quasiquote . \"`\") (unquote . \",\") (unquote-splicing . \",@\")) 0 1 0 30 0 2 assoc 4 2) . #4#) 29 . #4#) 5 vector 0 1 -3 38 7 (3 (1 0 0 2 vector-length 4 1) 6 -4 29 6 -5 5 0 6 -7 5 \"#(\" 6 -6 . #5=(1 -4 0 1 -7 0 39 2 7 (3 (1 2 0 1 -6 0 2 display 4 2) 3 (1 2 0 1 1 0 3 (1 -7 0 1 0 0 2 vector-get 4 2) 0 2 write/ss-print 4 3) 5 1 0 1 -7 0 32 2 0 5 \" \" 0 19 4 2 . #5#) 11 1 2 0 5 \")\" 0 2 display 8 2)) 1 2 0 1 0 0 2 write 8 2)) 11 . #6#)) 1 . #7#) 16 write/ss-print 10)\n"
-"(9 2 0 (26 4 29 6 -2 1 1 6 -5 29 6 -4 1 0 6 -3 . #0=(1 -5 7 (5 0 0 1 -3 0 41 2 7 (1 -5 31 0 3 (1 -4 0 1 -5 30 0 2 cons 4 2) 0 5 1 0 1 -3 0 33 2 0 19 1 3 . #0#) 1 . #1=(-4 0 2 reverse! 8 1)) 1 . #1#)) 16 take 10)\n"
-"(9 2 0 #0=(1 1 7 (5 0 0 1 0 0 41 2 7 (1 1 31 0 5 1 0 1 0 0 33 2 0 19 0 2 . #0#) 1 1 . #1=(17)) 11 . #1#) 16 drop 10)\n"
-"(9 2 0 (3 (1 0 0 1 1 0 2 drop 4 2) 30 17) 16 elt 10)\n"
-"(9 2 0 (26 3 29 6 -2 5 0 6 -4 1 1 6 -3 . #0=(7 (3 (1 -3 30 0 1 0 4 1) 7 (1 -4 . #1=(17)) 5 1 0 1 -4 0 32 2 0 1 -3 31 0 19 1 2 1 -3 . #0#) 29 . #1#)) 16 position-if 10)\n"
-"(9 2 0 (1 1 0 1 0 0 9 1 1 (12 0 0 1 0 38 17) 0 2 position-if 8 2) 16 position 10)\n"
-"(9 1 0 (26 2 1 0 7 (29 . #2=(6 -2 7 (1 -2 . #0=(17)) 3 (1 0 0 2 pair? 4 1) 7 (3 (1 0 0 2 last 4 1) 31 6 -3 7 (29 . #1=(6 -3 7 (1 -3 . #0#) 29 . #0#)) 5 t . #1#) 29 . #1#)) 5 t . #2#) 16 list? 10)\n"
-"(9 (0 -1) 0 (26 4 29 6 -2 1 0 30 6 -4 1 0 31 6 -3 . #0=(7 (1 -3 30 6 -5 1 -4 0 1 -5 0 39 2 7 (1 -5 . #1=(0 1 -3 31 0 19 1 2 1 -3 . #0#)) 1 -4 . #1#) 1 -4 17)) 16 min 10)\n"
-"(9 2 0 (3 (1 1 30 0 1 0 0 2 set-car! 4 2) 1 1 31 0 1 0 0 2 set-cdr! 8 2) 16 copy-pair! 10)\n"
-"(9 2 0 (26 3 3 (3 (1 1 0 2 vector-length 4 1) 0 3 (1 0 0 2 vector-length 4 1) 0 2 min 4 2) 6 -2 29 6 -3 5 0 6 -4 . #0=(1 -2 0 1 -4 0 39 2 7 (3 (3 (1 -4 0 1 1 0 2 vector-get 4 2) 0 1 -4 0 1 0 0 2 vector-set! 4 3) 5 1 0 1 -4 0 32 2 0 19 2 1 . #0#) 11 17)) 16 copy-vector! 10)\n"
-"(9 2 0 (26 3 29 6 -2 29 6 -4 1 1 6 -3 . #0=(7 (3 (1 -3 30 0 1 0 4 1) 7 (1 -4 . #1=(0 1 -3 31 0 19 1 2 1 -3 . #0#)) 3 (1 -4 0 1 -3 30 0 2 cons 4 2) . #1#) 1 -4 0 2 reverse! 8 1)) 16 remove-if 10)\n"
-"(9 2 0 (1 1 0 1 0 0 9 1 1 (26 1 3 (1 0 0 12 0 4 1) 6 -2 7 (29 . #0=(17)) 5 t . #0#) 0 2 remove-if 8 2) 16 remove-if-not 10)\n"
-"(9 1 0 (3 (1 0 0 2 pair? 4 1) 7 (3 (1 0 31 0 2 copy-list 4 1) 0 3 (1 0 30 0 2 copy-list 4 1) 0 2 cons 8 2) 1 0 17) 16 copy-list 10)\n"
-"(9 2 0 (26 1 5 0 0 3 (1 1 0 1 0 0 2 logand 4 2) 38 6 -2 7 (29 . #0=(17)) 5 t . #0#) 16 bit? 10)\n"
-"(9 1 0 (26 5 3 (1 0 0 2 length 4 1) 6 -2 3 (1 -2 0 2 make-vector 4 1) 6 -3 29 6 -4 1 0 6 -6 5 0 6 -5 . #0=(1 -2 0 1 -5 0 39 2 7 (3 (1 -6 30 0 1 -5 0 1 -3 0 2 vector-set! 4 3) 1 -6 31 0 5 1 0 1 -5 0 32 2 0 19 3 2 . #0#) 1 -3 17)) 16 list->vector 10)\n"
-"(9 1 0 (5 (#\\space #\\tab #\\nl nil #\\( #\\) #\\[ #\\] #\\{ #\\} #\\; #\\,) 0 1 0 0 2 member 8 2) 16 delimiter? 10)\n"
-"(9 1 0 (26 1 3 (1 0 0 2 int 4 1) 6 -2 5 122 0 1 -2 0 5 97 0 40 3 7 (5 -32 0 1 -2 0 32 2 0 2 char 8 1) 1 0 17) 16 upcase 10)\n"
-"(9 1 0 (26 1 3 (3 (1 0 0 2 upcase 4 1) 0 2 int 4 1) 6 -2 5 57 0 1 -2 0 5 48 0 40 3 7 (5 48 0 1 -2 0 33 2 . #0=(17)) 5 90 0 1 -2 0 5 65 0 40 3 7 (5 55 0 1 -2 0 33 2 . #0#) 29 . #0#) 16 numeral-char? 10)\n"
-"(9 2 0 (26 4 29 6 -2 3 (1 0 0 2 read-char 4 1) 6 -4 5 0 6 -3 . #0=(3 (1 -4 0 2 delimiter? 4 1) 7 (3 (1 0 0 1 -4 0 2 unread-char 4 2) 1 -3 17) 5 #\\_ 0 1 -4 38 7 (3 (1 0 0 2 read-char 4 1) 0 1 -3 0 19 1 2 . #0#) 3 (1 -4 0 2 numeral-char? 4 1) 6 -5 7 (1 1 0 1 -5 0 39 2 7 (11 . #1=(3 (1 0 0 2 read-char 4 1) 0 1 -5 0 1 1 0 1 -3 0 35 2 0 32 2 0 19 1 2 . #0#)) 3 . #2=((1 -4 0 5 \"Illegal char for number literal [%@]\" 0 2 error 4 2) . #1#)) 3 . #2#)) 16 read-num-literal 10)\n"
-"(25 with-open-file (1 -1) 0 (26 2 1 0 31 30 6 -3 1 0 30 6 -2 3 (3 (3 (5 (result) 0 3 (1 -2 0 5 close 0 2 list 4 2) 0 2 list* 4 2) 0 1 1 0 2 append 4 2) 0 5 result 0 5 let1 0 2 list* 4 3) 0 3 (1 -3 0 5 open 0 2 list 4 2) 0 1 -2 0 5 let1 0 2 list 8 4) 10)\n"
-"(9 1 0 (26 3 29 6 -2 29 6 -3 . #0=(3 (1 0 0 2 read 4 1) 6 -4 7 (3 (1 -3 0 1 -4 0 2 cons 4 2) 0 19 1 1 . #0#) 1 -3 0 2 reverse! 8 1)) 16 stream->list 10)\n"
-"(3 (2 gensym 4 0) 16 *bq-clobberable* 10)\n"
-"(3 (29 0 5 quote 0 2 list 4 2) 16 *bq-quote-nil* 10)\n"
-"(3 (9 2 0 (3 (1 0 0 2 read 4 1) 0 5 quasiquote 0 2 list 8 2) 0 5 #\\` 0 2 set-macro-character 4 2) 10)\n"
-"(3 (9 2 0 (26 1 3 (1 0 0 2 read-char 4 1) 6 -2 5 #\\@ 0 1 -2 38 7 (3 (1 0 0 2 read 4 1) 0 5 unquote-splicing 0 2 list 8 2) 5 #\\. 0 1 -2 38 7 (3 (1 0 0 2 read 4 1) 0 5 unquote-dot 0 2 list 8 2) 3 (1 0 0 1 -2 0 2 unread-char 4 2) 3 (1 0 0 2 read 4 1) 0 5 unquote 0 2 list 8 2) 0 5 #\\, 0 2 set-macro-character 4 2) 10)\n"
-"(25 quasiquote 1 0 (1 0 0 2 bq-completely-process 8 1) 10)\n"
-"(9 1 0 (3 (1 0 0 2 bq-process 4 1) 0 2 bq-simplify 8 1) 16 bq-completely-process 10)\n"
-"(9 1 0 (26 4 . #0=(3 (1 0 0 2 pair? 4 1) 6 -2 7 (5 quasiquote 0 1 0 30 38 7 (3 (1 0 31 30 0 2 bq-completely-process 4 1) 0 19 0 1 . #0#) 5 unquote 0 1 0 30 38 7 (1 0 31 30 17) 5 unquote-splicing 0 1 0 30 38 7 (1 0 31 30 0 5 \",@~S after `\" 0 2 error 8 2) 5 unquote-dot 0 1 0 30 38 7 (1 0 31 30 0 5 \",.~S after `\" 0 2 error 8 2) 29 6 -2 29 6 -4 1 0 6 -3 . #2=(3 (1 -3 0 2 pair? 4 1) 6 -5 7 (5 unquote 0 1 -3 30 38 7 (1 -3 31 31 6 -5 7 (3 (1 -3 0 5 \"Malformed ,~S\" 0 2 error 4 2) . #1=(3 (3 (1 -3 31 30 0 2 list 4 1) 0 1 -4 0 2 nreconc 4 2) 0 5 append 0 2 cons 8 2)) 11 . #1#) 5 unquote-splicing 0 1 -3 30 38 7 (3 (1 -3 0 5 \"Dotted ,@~S\" 0 2 error 4 2) . #4=(5 unquote-dot 0 1 -3 30 38 7 (3 (1 -3 0 5 \"Dotted ,.~S\" 0 2 error 4 2) . #3=(3 (1 -4 0 3 (1 -3 30 0 2 bracket 4 1) 0 2 cons 4 2) 0 1 -3 31 0 19 1 2 . #2#)) 11 . #3#)) 11 . #4#) 3 (3 (3 (1 -3 0 5 quote 0 2 list 4 2) 0 2 list 4 1) 0 1 -4 0 2 nreconc 4 2) 0 5 append 0 2 cons 8 2)) 1 0 0 5 quote 0 2 list 8 2)) 16 bq-process 10)\n"
-"(9 1 0 (26 1 3 (1 0 0 2 pair? 4 1) 6 -2 7 (5 unquote 0 1 0 30 38 7 (1 0 31 30 0 5 list 0 2 list 8 2) 5 unquote-splicing 0 1 0 30 38 7 (1 0 31 30 17) 5 unquote-dot 0 1 0 30 38 7 (1 0 31 30 0 2 *bq-clobberable* 0 2 list 8 2) 3 (1 0 0 2 bq-process 4 1) 0 5 list 0 2 list 8 2) 3 (1 0 0 2 bq-process 4 1) 0 5 list 0 2 list 8 2) 16 bracket 10)\n"
-"(9 2 0 (26 2 3 (1 1 0 2 pair? 4 1) 6 -2 7 (3 (1 1 31 0 1 0 0 2 maptree 4 2) 6 -3 3 (1 1 30 0 1 0 4 1) 6 -2 3 (1 1 30 0 1 -2 0 2 equal? 4 2) 7 (3 (1 1 31 0 1 -3 0 2 equal? 4 2) 7 (1 1 17) 1 . #0=(-3 0 1 -2 0 2 cons 8 2)) 1 . #0#) 1 1 0 1 0 8 1) 16 maptree 10)\n"
-"(9 1 0 (26 2 3 (1 0 0 2 pair? 4 1) 7 (5 unquote-splicing 0 1 0 30 38 6 -2 7 (1 -2 . #0=(17)) 5 unquote-dot 0 1 0 30 38 6 -3 7 (1 -3 . #0#) 29 . #0#) 29 . #0#) 16 bq-splicing-frob 10)\n"
-"(9 1 0 (26 3 3 (1 0 0 2 pair? 4 1) 7 (5 unquote 0 1 0 30 38 6 -2 7 (1 -2 . #0=(17)) 5 unquote-splicing 0 1 0 30 38 6 -3 7 (1 -3 . #0#) 5 unquote-dot 0 1 0 30 38 6 -4 7 (1 -4 . #0#) 29 . #0#) 29 . #0#) 16 bq-frob 10)\n"
-"(9 1 0 (26 2 3 (1 0 0 2 pair? 4 1) 7 (5 quote 0 1 0 30 38 7 (1 0 . #0=(6 -2 5 append 0 1 -2 30 38 6 -3 7 (1 -2 0 2 bq-simplify-args 8 1) 1 -2 . #1=(17))) 3 (1 0 0 2 bq-simplify 0 2 maptree 4 2) . #0#) 1 0 . #1#) 16 bq-simplify 10)\n"
-"(9 1 0 (26 4 29 6 -2 29 6 -4 3 (1 0 31 0 2 reverse 4 1) 6 -3 . #0=(7 (3 (1 -3 30 0 2 pair? 4 1) 6 -5 7 (5 list 0 1 -3 30 30 38 7 (3 (1 -3 30 31 0 2 bq-splicing-frob 0 2 some? 4 2) 6 -5 7 (5 . #4=(list* 0 1 -3 30 30 38 7 (3 (1 -3 30 31 0 2 bq-splicing-frob 0 2 some? 4 2) 6 -5 7 (5 . #3=(quote 0 1 -3 30 30 38 7 (3 (1 -3 30 31 30 0 2 pair? 4 1) 7 (3 (1 -3 30 31 30 0 2 bq-frob 4 1) 6 -5 7 (2 . #2=(*bq-clobberable* 0 1 -3 30 30 38 7 (3 (1 -4 0 1 -3 30 31 30 0 5 append! 0 2 bq-attach-append 4 3) . #1=(0 1 -3 31 0 19 1 2 1 -3 . #0#)) 3 (1 -4 0 1 -3 30 0 5 append 0 2 bq-attach-append 4 3) . #1#)) 3 (1 -3 0 2 cddar 4 1) 6 -5 7 (2 . #2#) 3 (1 -4 0 3 (3 (3 (1 -3 0 2 caadar 4 1) 0 5 quote 0 2 list 4 2) 0 2 list 4 1) 0 2 bq-attach-conses 4 2) . #1#) 2 . #2#) 2 . #2#)) 3 (3 (1 -4 0 3 (1 -3 30 0 2 last 4 1) 30 0 5 append 0 2 bq-attach-append 4 3) 0 3 (3 (1 -3 30 31 0 2 reverse 4 1) 31 0 2 reverse 4 1) 0 2 bq-attach-conses 4 2) . #1#) 5 . #3#)) 3 (1 -4 0 1 -3 30 31 0 2 bq-attach-conses 4 2) . #1#) 5 . #4#) 3 (1 -4 0 1 -3 30 0 5 append 0 2 bq-attach-append 4 3) . #1#) 1 -4 17)) 16 bq-simplify-args 10)\n"
-"(9 1 0 (26 2 1 0 7 (29 . #2=(6 -2 7 (1 -2 . #0=(17)) 3 (1 0 0 2 pair? 4 1) 7 (5 quote 0 1 0 30 38 . #1=(6 -3 7 (1 -3 . #0#) 29 . #0#)) 29 . #1#)) 5 t . #2#) 16 null-or-quoted 10)\n"
-"(9 3 0 (26 2 3 (1 1 0 2 null-or-quoted 4 1) 7 (3 (1 2 0 2 null-or-quoted 4 1) 7 (3 (1 2 31 30 0 1 1 31 30 0 2 append 4 2) 0 5 quote 0 2 list 8 2) 1 . #3=(2 7 (29 . #2=(6 -2 7 #0=(3 (1 1 0 2 bq-splicing-frob 4 1) 7 (1 1 0 1 0 0 2 list 8 2) 1 1 17) 3 (2 *bq-quote-nil* 0 1 2 0 2 equal? 4 2) 6 -3 7 #0# 3 (1 2 0 2 pair? 4 1) 7 (1 0 0 1 2 30 38 7 (1 2 31 0 1 1 0 1 2 30 0 2 list* 8 3) 1 . #1=(2 0 1 1 0 1 0 0 2 list 8 3)) 1 . #1#)) 5 t . #2#)) 1 . #3#) 16 bq-attach-append 10)\n"
-"(9 2 0 (26 2 3 (1 0 0 2 null-or-quoted 0 2 every? 4 2) 7 (3 (1 1 0 2 null-or-quoted 4 1) 7 (3 (1 1 31 30 0 3 (1 0 0 2 cadr 0 2 map 4 2) 0 2 append 4 2) 0 5 quote 0 2 list 8 2) 1 . #4=(1 7 (29 . #3=(6 -2 7 #0=(1 0 0 5 list 0 2 cons 8 2) 3 (2 *bq-quote-nil* 0 1 1 0 2 equal? 4 2) 6 -3 7 #0# 3 (1 1 0 2 pair? 4 1) 7 (5 list 0 1 1 30 38 6 -2 7 #1=(3 (1 1 31 0 1 0 0 2 append 4 2) 0 1 1 30 0 2 cons 8 2) 5 list* 0 1 1 30 38 6 -3 7 #1# 3 . #2=((3 (1 1 0 2 list 4 1) 0 1 0 0 2 append 4 2) 0 5 list* 0 2 cons 8 2)) 3 . #2#)) 5 t . #3#)) 1 . #4#) 16 bq-attach-conses 10)\n"
-"(9 (0 -1) 0 (3 (2 *stderr* 0 1 0 0 2 write/ss 4 2) 2 *stderr* 0 5 \"\\n\" 0 2 display 8 2) 16 debug/ss 10)\n"
-"(5 0 0 26 1 3 (2 table 4 0) 6 -2 0 9 2 1 (1 1 0 1 0 0 12 0 0 2 table-put! 8 3) 16 register-setf-expander 1 -2 0 9 1 1 (26 1 3 (1 0 0 2 symbol? 4 1) 7 (3 (2 gensym 4 0) 6 -2 1 0 0 3 (1 -2 0 1 0 0 5 set! 0 2 list 4 3) 0 3 (1 -2 0 2 list 4 1) 0 29 0 29 0 27 5 17) 3 (1 0 0 2 pair? 4 1) 7 (3 (1 0 30 0 12 0 0 2 table-get 4 2) . #0=(6 -2 7 (1 0 0 1 -2 8 1) 1 0 0 5 \"not registered setf expander for `%@`\" 0 2 error 8 2)) 29 . #0#) 16 get-setf-expansion 26 -2 10)\n"
-"(9 2 0 (26 1 3 (1 0 0 2 pair? 4 1) 7 (3 (1 1 0 1 0 31 0 2 replace-tree 4 2) 0 3 (1 1 0 1 0 30 0 2 replace-tree 4 2) 0 2 cons 8 2) 3 (1 1 0 1 0 0 2 assoc 4 2) 6 -2 7 (1 -2 31 . #0=(17)) 1 0 . #0#) 16 replace-tree 10)\n"
-"(25 setf 2 0 (26 5 3 (1 0 0 2 get-setf-expansion 4 1) 28 -2 5 3 (3 (1 -3 0 1 -2 0 2 cons 0 2 map 4 3) 0 3 (1 1 0 1 -4 30 0 2 cons 4 2) 0 2 cons 4 2) 0 1 -5 0 2 replace-tree 8 2) 10)\n"
-"(3 (9 1 0 (26 2 3 (2 gensym 4 0) 6 -3 3 (2 gensym 4 0) 6 -2 3 (1 -2 0 5 car 0 2 list 4 2) 0 3 (1 -3 0 1 -2 0 5 set-car! 0 2 list 4 3) 0 3 (1 -3 0 2 list 4 1) 0 3 (1 0 31 30 0 2 list 4 1) 0 3 (1 -2 0 2 list 4 1) 0 27 5 17) 0 5 car 0 2 register-setf-expander 4 2) 10)\n"
-"(3 (9 1 0 (26 2 3 (2 gensym 4 0) 6 -3 3 (2 gensym 4 0) 6 -2 3 (1 -2 0 5 cdr 0 2 list 4 2) 0 3 (1 -3 0 1 -2 0 5 set-cdr! 0 2 list 4 3) 0 3 (1 -3 0 2 list 4 1) 0 3 (1 0 31 30 0 2 list 4 1) 0 3 (1 -2 0 2 list 4 1) 0 27 5 17) 0 5 cdr 0 2 register-setf-expander 4 2) 10)\n"
-"(3 (9 1 0 (26 3 3 (2 gensym 4 0) 6 -4 3 (2 gensym 4 0) 6 -3 3 (2 gensym 4 0) 6 -2 3 (1 -3 0 1 -2 0 5 table-get 0 2 list 4 3) 0 3 (1 -4 0 1 -3 0 1 -2 0 5 table-put! 0 2 list 4 4) 0 3 (1 -4 0 2 list 4 1) 0 3 (1 0 31 31 30 0 1 0 31 30 0 2 list 4 2) 0 3 (1 -3 0 1 -2 0 2 list 4 2) 0 27 5 17) 0 5 table-get 0 2 register-setf-expander 4 2) 10)\n"
-"(3 (9 1 0 (26 3 3 (2 gensym 4 0) 6 -4 3 (2 gensym 4 0) 6 -3 3 (2 gensym 4 0) 6 -2 3 (1 -3 0 1 -2 0 5 vector-get 0 2 list 4 3) 0 3 (1 -4 0 1 -3 0 1 -2 0 5 vector-set! 0 2 list 4 4) 0 3 (1 -4 0 2 list 4 1) 0 3 (1 0 31 31 30 0 1 0 31 30 0 2 list 4 2) 0 3 (1 -3 0 1 -2 0 2 list 4 2) 0 27 5 17) 0 5 vector-get 0 2 register-setf-expander 4 2) 10)\n"
-"(25 inc! (1 -1) 0 (26 6 1 1 7 (1 1 30 . #0=(6 -2 3 (1 0 0 2 get-setf-expansion 4 1) 28 -3 5 3 (3 (3 (1 -2 0 1 -7 0 5 + 0 1 -5 30 0 2 list 4 4) 0 2 list 4 1) 0 1 -6 0 2 replace-tree 4 2) 0 3 (1 -4 0 1 -3 0 2 list 0 2 map 4 3) 0 5 let 0 2 list 8 3)) 5 1 . #0#) 10)\n"
-"(25 dec! (1 -1) 0 (26 1 1 1 7 (1 1 30 . #0=(6 -2 3 (1 -2 0 5 - 0 2 list 4 2) 0 1 0 0 5 inc! 0 2 list 8 3)) 5 1 . #0#) 10)\n"
-"(25 push! 2 0 (26 5 3 (1 1 0 2 get-setf-expansion 4 1) 28 -2 5 3 (3 (3 (1 -6 0 1 0 0 5 cons 0 1 -4 30 0 2 list 4 4) 0 2 list 4 1) 0 1 -5 0 2 replace-tree 4 2) 0 3 (1 -3 0 1 -2 0 2 list 0 2 map 4 3) 0 5 let 0 2 list 8 3) 10)\n"
-"(25 pop! 1 0 (26 7 3 (1 0 0 2 get-setf-expansion 4 1) 28 -2 5 3 (2 gensym 4 0) 6 -8 1 -4 30 6 -7 3 (3 (1 -8 0 5 car 0 2 list 4 2) 0 3 (3 (3 (1 -8 0 5 cdr 0 1 -7 0 2 list 4 3) 0 2 list 4 1) 0 1 -5 0 2 replace-tree 4 2) 0 3 (3 (1 -6 0 1 -8 0 2 list 4 2) 0 2 list 4 1) 0 5 let 0 2 list 4 4) 0 3 (1 -3 0 1 -2 0 2 list 0 2 map 4 3) 0 5 let 0 2 list 8 3) 10)\n"
-"(9 2 0 (5 0 0 1 1 0 29 0 5 t 0 29 0 3 (1 0 0 9 1 0 (1 0 0 5 0 0 3 (2 gensym 4 0) 0 2 var-info 8 3) 0 2 map 4 2) 0 2 vector 8 6) 16 create-scope 10)\n"
-"(9 2 0 (1 1 0 29 0 3 (1 0 0 9 1 0 (1 0 0 5 0 0 3 (2 gensym 4 0) 0 2 var-info 8 3) 0 2 map 4 2) 0 2 expand-scope2 8 3) 16 expand-scope 10)\n"
-"(9 3 0 (5 0 0 1 2 0 1 1 0 29 0 29 0 1 0 0 2 vector 8 6) 16 expand-scope2 10)\n"
-"(9 1 0 (5 0 0 1 0 0 2 vector-get 8 2) 16 scope-local-infos 10)\n"
-"(9 1 0 (5 1 0 1 0 0 2 vector-get 8 2) 16 scope-frees 10)\n"
-"(9 1 0 (5 2 0 1 0 0 2 vector-get 8 2) 16 scope-block-top? 10)\n"
-"(9 1 0 (5 3 0 1 0 0 2 vector-get 8 2) 16 scope-sets 10)\n"
-"(9 1 0 (5 4 0 1 0 0 2 vector-get 8 2) 16 scope-outer-scope 10)\n"
-"(9 1 0 (5 5 0 1 0 0 2 vector-get 8 2) 16 scope-work-size 10)\n"
-"(9 2 0 (1 1 0 5 1 0 1 0 0 2 vector-set! 8 3) 16 scope-frees-set! 10)\n"
-"(9 2 0 (1 1 0 5 3 0 1 0 0 2 vector-set! 8 3) 16 scope-sets-set! 10)\n"
-"(9 2 0 (1 1 0 5 5 0 1 0 0 2 vector-set! 8 3) 16 scope-work-size-set! 10)\n"
-"(9 2 0 (1 1 0 5 4 0 1 0 0 2 vector-set! 8 3) 16 scope-outer-scope-set! 10)\n"
-"(9 1 0 (26 3 29 6 -2 5 0 6 -4 3 (1 0 0 2 scope-outer-scope 4 1) 6 -3 . #0=(3 (1 -3 0 2 scope-block-top? 4 1) 7 (1 -4 17) 3 (3 (1 -3 0 2 scope-local-infos 4 1) 0 2 length 4 1) 0 1 -4 0 32 2 0 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 2 . #0#)) 16 scope-upper-work-size 10)\n"
-"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #0=(7 (3 (3 (1 -3 0 2 scope-local-infos 4 1) 0 1 1 0 9 1 1 (12 0 0 3 (1 0 0 2 var-info-orig-name-get 4 1) 38 17) 0 2 some? 4 2) 6 -4 7 (1 -4 30 0 2 var-info-name-get 8 1) 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 1 1 -3 . #0#) 11 17)) 16 alpha-conversion 10)\n"
-"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #1=(3 (1 1 0 1 -3 0 2 scope-local-only-has? 4 2) 6 -4 7 (3 (1 -3 0 2 scope-block-top? 4 1) 7 (1 -4 . #0=(17)) 3 (1 -3 0 2 scope-upper-work-size 4 1) 0 1 -4 0 32 2 0 5 -2 0 33 2 . #0#) 3 (1 -3 0 2 scope-block-top? 4 1) 7 (11 . #0#) 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 1 . #1#)) 16 scope-local-has? 10)\n"
-"(9 2 0 (3 (1 0 0 2 scope-local-infos 4 1) 0 1 1 0 9 1 1 (12 0 0 3 (1 0 0 2 var-info-name-get 4 1) 38 17) 0 2 position-if 8 2) 16 scope-local-only-has? 10)\n"
-"(9 1 0 (26 1 3 (1 0 0 2 scope-local-infos 4 1) 6 -2 7 (3 (1 -2 30 0 2 var-info-name-get 4 1) 0 1 0 0 2 scope-local-has? 8 2) 5 0 17) 16 get-scope-local-offset 10)\n"
-"(9 1 0 (26 2 29 6 -2 1 0 6 -3 . #0=(3 (1 -3 0 2 scope-block-top? 4 1) 7 (1 -3 17) 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 1 . #0#)) 16 scope-block-top-get 10)\n"
-"(9 1 0 (3 (3 (1 0 0 2 scope-block-top-get 4 1) 0 2 scope-outer-scope 4 1) 0 2 scope-block-top-get 8 1) 16 scope-upper-block-top-get 10)\n"
-"(9 2 0 (3 (1 1 0 2 scope-block-top-get 4 1) 0 3 (1 0 0 2 scope-block-top-get 4 1) 38 17) 16 same-scope-block? 10)\n"
-"(9 2 0 (3 (3 (1 0 0 2 scope-block-top-get 4 1) 0 2 scope-frees 4 1) 0 1 1 0 2 position 8 2) 16 scope-frees-has? 10)\n"
-"(9 2 0 (26 3 29 6 -2 3 (1 0 0 2 scope-block-top-get 4 1) 6 -3 . #0=(3 (1 -3 0 2 scope-outer-scope 4 1) 6 -4 7 (3 (1 1 0 1 -4 0 2 scope-local-only-has? 4 2) 7 (1 -4 . #1=(17)) 1 -4 0 19 1 1 . #0#) 29 . #1#)) 16 scope-upper-vars-has? 10)\n"
-"(9 2 0 (26 1 3 (1 0 0 2 scope-frees 4 1) 6 -2 3 (1 -2 0 1 1 0 2 member 4 2) 7 (3 (1 -2 0 1 1 0 9 1 1 (1 0 0 12 0 38 17) 0 2 remove-if 4 2) 0 1 0 0 2 scope-frees-set! 8 2) 11 17) 16 scope-frees-remove! 10)\n"
-"(9 1 0 (26 4 29 6 -2 5 0 6 -4 1 0 6 -3 . #0=(3 (3 (1 -3 0 2 scope-local-infos 4 1) 0 2 length 4 1) 0 1 -4 0 32 2 6 -5 3 (1 -3 0 2 scope-block-top? 4 1) 7 (1 -5 17) 1 -5 0 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 2 . #0#)) 16 scope-local-count 10)\n"
-"(9 3 0 (1 2 0 1 1 0 1 0 0 2 vector 8 3) 16 var-info 10)\n"
-"(9 1 0 (5 0 0 1 0 0 2 vector-get 8 2) 16 var-info-name-get 10)\n"
-"(9 1 0 (5 1 0 1 0 0 2 vector-get 8 2) 16 var-info-flag-get 10)\n"
-"(9 1 0 (5 2 0 1 0 0 2 vector-get 8 2) 16 var-info-orig-name-get 10)\n"
-"(9 2 0 (1 1 0 5 1 0 1 0 0 2 vector-set! 8 3) 16 var-info-flag-set! 10)\n"
-"(9 2 0 (26 2 3 (1 1 0 1 0 0 2 get-var-info 4 2) 28 -2 2 1 -2 7 (1 -2 0 2 var-info-orig-name-get 8 1) 29 17) 16 get-var-orig-name 10)\n"
-"(9 2 0 (26 3 3 (1 1 0 2 symbol? 4 1) 7 (29 6 -2 1 0 6 -3 . #0=(7 (3 (1 1 0 1 -3 0 2 scope-local-only-has? 4 2) 6 -4 7 (1 -3 0 3 (1 -4 0 3 (1 -3 0 2 scope-local-infos 4 1) 0 2 elt 4 2) 0 27 2 . #1=(17)) 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 1 1 -3 . #0#) 29 0 29 0 27 2 . #1#)) 29 0 29 0 27 2 . #1#) 16 get-var-info 10)\n"
-"(9 3 0 (26 2 3 (1 1 0 1 0 0 2 get-var-info 4 2) 28 -2 2 1 -2 7 (3 (3 (1 2 0 3 (1 -2 0 2 var-info-flag-get 4 1) 0 2 logior 4 2) 0 1 -2 0 2 var-info-flag-set! 4 2) 1 -2 . #0=(17)) 11 . #0#) 16 add-var-info 10)\n"
-"(9 3 0 (26 2 3 (1 1 0 1 0 0 2 get-var-info 4 2) 28 -2 2 1 -2 7 (3 (1 2 0 3 (1 -2 0 2 var-info-flag-get 4 1) 0 2 bit? 4 2) 7 (1 -2 . #0=(17)) 29 . #0#) 29 . #0#) 16 var-has-attr? 10)\n"
-"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #0=(7 (3 (3 (1 -3 0 2 scope-sets 4 1) 0 1 1 0 2 assoc 4 2) 6 -4 7 (1 -4 31 . #1=(17)) 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 1 1 -3 . #0#) 11 . #1#)) 16 var-is-set? 10)\n"
-"(9 2 0 (26 4 3 (5 2 0 1 1 0 1 0 0 2 add-var-info 4 3) 29 6 -2 1 0 6 -3 . #0=(7 (3 (1 1 0 1 -3 0 2 scope-local-has? 4 2) 7 (11 . #2=(17)) 3 (1 -3 0 2 scope-block-top-get 4 1) 6 -4 3 (1 -4 0 2 scope-frees 4 1) 6 -5 3 (1 -5 0 1 1 0 2 member 4 2) 7 (11 . #1=(3 (1 -4 0 2 scope-outer-scope 4 1) 0 19 1 1 1 -3 . #0#)) 3 (3 (1 -5 0 1 1 0 2 cons 4 2) 0 1 -4 0 2 scope-frees-set! 4 2) . #1#) 11 . #2#)) 16 register-fref 10)\n"
-"(9 3 0 (26 3 3 (5 4 0 1 1 0 1 0 0 2 add-var-info 4 3) 3 (1 1 0 1 0 0 2 get-var-info 4 2) 28 -2 2 1 -2 7 (3 (1 0 0 1 -3 0 2 same-scope-block? 4 2) 7 (1 2 . #0=(6 -4 0 1 1 0 1 -3 0 2 do-register-set! 8 3)) 29 . #0#) 11 17) 16 register-set! 10)\n"
-"(9 3 0 (26 2 3 (1 0 0 2 scope-sets 4 1) 6 -2 3 (1 -2 0 1 1 0 2 assoc 4 2) 6 -3 7 (3 (1 -3 31 0 1 2 0 2 cons 4 2) 0 1 -3 0 2 set-cdr! 8 2) 3 (1 -2 0 3 (1 2 0 2 list 4 1) 0 1 1 0 2 acons 4 3) 0 1 0 0 2 scope-sets-set! 8 2) 16 do-register-set! 10)\n"
-"(9 1 0 (26 3 29 6 -2 5 0 6 -4 1 0 6 -3 . #0=(3 (1 -3 0 2 scope-block-top? 4 1) 7 (3 (1 -3 0 2 scope-work-size 4 1) 0 1 -4 0 41 2 7 (1 -4 0 1 -3 0 2 scope-work-size-set! 8 2) 11 17) 3 (3 (1 -3 0 2 scope-local-infos 4 1) 0 2 length 4 1) 0 1 -4 0 32 2 0 3 (1 -3 0 2 scope-outer-scope 4 1) 0 19 1 2 . #0#)) 16 calc-scope-work-size 10)\n"
-"(9 2 0 (26 2 3 (1 1 0 2 scope-block-top-get 4 1) 6 -3 3 (1 0 0 2 scope-upper-block-top-get 4 1) 6 -2 1 -3 0 1 -2 38 17) 16 upper-scope-is? 10)\n"
-"(9 3 0 (26 4 1 1 7 (3 (29 0 29 0 2 cons 4 2) . #1=(6 -3 3 (1 0 0 2 check-parameters 4 1) 6 -2 0 1 0 38 7 (3 (1 0 0 2 length 4 1) . #0=(6 -5 3 (1 2 0 1 -2 0 2 create-scope 4 2) 6 -4 1 -3 0 1 -5 0 1 -2 0 1 -4 0 2 create-lambda-node 8 4)) 3 (5 -1 0 5 1 0 3 (1 -2 0 2 length 4 1) 0 33 2 0 2 list 4 2) . #0#)) 29 . #1#) 16 prepare-lambda-node 10)\n"
-"(9 4 0 (1 3 0 1 2 0 3 (29 0 29 0 2 cons 4 2) 0 1 0 0 5 :LAMBDA 0 2 vector 8 5) 16 create-lambda-node 10)\n"
-"(9 1 0 (3 (1 0 0 2 vector? 4 1) 7 (5 :LAMBDA 0 3 (5 0 0 1 0 0 2 vector-get 4 2) 38 . #0=(17)) 29 . #0#) 16 lambda-node? 10)\n"
-"(9 1 0 (5 1 0 1 0 0 2 vector-get 8 2) 16 lambda-scope-get 10)\n"
-"(9 1 0 (5 2 0 1 0 0 2 vector-get 8 2) 16 lambda-body-slot-get 10)\n"
-"(9 1 0 (5 3 0 1 0 0 2 vector-get 8 2) 16 lambda-varnum-get 10)\n"
-"(9 1 0 (5 4 0 1 0 0 2 vector-get 8 2) 16 lambda-body-node-get 10)\n"
-"(9 2 0 (1 1 0 5 1 0 1 0 0 2 vector-set! 8 3) 16 lambda-scope-set! 10)\n"
-"(9 1 0 (3 (1 0 0 2 vector? 4 1) 7 (5 :REF 0 3 (5 0 0 1 0 0 2 vector-get 4 2) 38 . #0=(17)) 29 . #0#) 16 refer-node? 10)\n"
-"(9 1 0 (5 1 0 1 0 0 2 vector-get 8 2) 16 refer-node-name 10)\n"
-"(9 1 0 (3 (1 0 0 2 vector? 4 1) 7 (5 :CONST 0 3 (5 0 0 1 0 0 2 vector-get 4 2) 38 . #0=(17)) 29 . #0#) 16 const-node? 10)\n"
-"(9 1 0 (5 1 0 1 0 0 2 vector-get 8 2) 16 const-node-value 10)\n"
-"(9 2 0 (1 1 0 5 1 0 1 0 0 2 vector-set! 8 3) 16 invoke-node-scope-set! 10)\n"
-"(9 2 0 (1 1 0 5 2 0 1 0 0 2 vector-set! 8 3) 16 invoke-node-args-set! 10)\n"
-"(25 aif2 (1 -1) 0 (26 3 1 1 7 (1 1 31 7 (1 1 31 30 . #1=(6 -3 1 1 7 (1 1 30 . #0=(6 -2 3 (2 gensym 4 0) 6 -4 3 (1 -3 0 1 -2 0 3 (3 (3 (1 -4 0 5 car 0 2 list 4 2) 0 1 -4 0 5 and 0 2 list 4 3) 0 5 it 0 5 or 0 2 list 4 3) 0 5 if 0 2 list 4 4) 0 1 0 0 3 (1 -4 0 5 &rest 0 5 it 0 2 list 4 3) 0 5 receive 0 2 list 8 4)) 29 . #0#)) 29 . #1#) 29 . #1#) 10)\n"
-"(25 acond2 (0 -1) 0 (26 3 1 0 7 (3 (2 gensym 4 0) 6 -4 3 (2 gensym 4 0) 6 -3 1 0 30 6 -2 3 (3 (1 0 31 0 5 acond2 0 2 list* 4 2) 0 3 (1 -2 31 0 1 -3 0 5 it 0 5 let1 0 2 list* 4 4) 0 3 (3 (3 (1 -4 0 5 car 0 2 list 4 2) 0 1 -4 0 5 and 0 2 list 4 3) 0 1 -3 0 5 or 0 2 list 4 3) 0 5 if 0 2 list 4 4) 0 1 -2 30 0 3 (1 -4 0 5 &rest 0 1 -3 0 2 list 4 3) 0 5 receive 0 2 list 8 4) 2 nil 17) 10)\n"
-"(25 labels (1 -1) 0 (3 (1 1 0 3 (1 0 0 9 1 0 (3 (1 0 31 31 0 1 0 31 30 0 5 ^ 0 2 list* 4 3) 0 1 0 30 0 5 set! 0 2 list 8 3) 0 2 map 4 2) 0 2 append 4 2) 0 3 (1 0 0 9 1 0 (29 0 1 0 30 0 2 list 8 2) 0 2 map 4 2) 0 5 let 0 2 list* 8 3) 10)\n"
-"(9 3 0 (26 15 . #0=(3 (1 1 0 1 0 0 2 equal? 4 2) 28 -2 (1 -1) 1 -2 7 (1 -2 7 #20=(5 t 0 1 2 0 27 2 . #1=(17)) 3 . #21=((1 2 0 1 0 0 2 binding 4 2) 28 -4 (1 -1) 1 -4 7 (1 -4 7 #17=(1 2 0 1 1 0 1 -4 0 19 0 3 . #0#) 3 . #18=((1 2 0 1 1 0 2 binding 4 2) 28 -6 (1 -1) 1 -6 7 (1 -6 7 #14=(1 2 0 1 -6 0 1 0 0 19 0 3 . #0#) 3 . #15=((1 0 0 2 varsym? 4 1) 28 -8 (1 -1) 1 -8 7 (1 -8 7 #11=(5 t 0 3 (1 2 0 3 (1 1 0 1 0 0 2 cons 4 2) 0 2 cons 4 2) 0 27 2 . #1#) 3 . #12=((1 1 0 2 varsym? 4 1) 28 -10 (1 -1) 1 -10 7 (1 -10 7 #8=(5 t 0 3 (1 2 0 3 (1 0 0 1 1 0 2 cons 4 2) 0 2 cons 4 2) 0 27 2 . #1#) 3 . #9=((1 0 0 2 pair? 4 1) 7 (3 (1 1 0 2 pair? 4 1) 7 (3 (1 2 0 1 1 30 0 1 0 30 0 2 match 4 3) . #7=(28 -12 (1 -1) 1 -12 7 (1 -12 7 #4=(1 -12 0 1 1 31 0 1 0 31 0 19 0 3 . #0#) 5 . #5=(t 28 -14 (1 -1) 1 -14 7 (1 -14 7 #2=(29 0 29 0 27 2 . #1#) 29 . #1#) 1 -15 7 (1 -15 30 . #3=(6 -16 7 #2# 29 . #1#)) 29 . #3#)) 1 -13 7 (1 -13 30 . #6=(6 -14 7 #4# 5 . #5#)) 29 . #6#)) 29 . #7#) 29 . #7#)) 1 -11 7 (1 -11 30 . #10=(6 -12 7 #8# 3 . #9#)) 29 . #10#)) 1 -9 7 (1 -9 30 . #13=(6 -10 7 #11# 3 . #12#)) 29 . #13#)) 1 -7 7 (1 -7 30 . #16=(6 -8 7 #14# 3 . #15#)) 29 . #16#)) 1 -5 7 (1 -5 30 . #19=(6 -6 7 #17# 3 . #18#)) 29 . #19#)) 1 -3 7 (1 -3 30 . #22=(6 -4 7 #20# 3 . #21#)) 29 . #22#)) 16 match 10)\n"
-"(9 1 0 (3 (1 0 0 2 symbol? 4 1) 7 (5 #\\? 0 3 (5 0 0 3 (1 0 0 2 string 4 1) 0 2 char-at 4 2) 38 . #0=(17)) 29 . #0#) 16 varsym? 10)\n"
-"(9 2 0 (26 2 29 6 -2 20 -2 1 -2 0 9 2 1 (26 2 3 (1 1 0 1 0 0 2 assoc 4 2) 6 -2 7 (3 (1 1 0 1 -2 31 0 12 0 21 4 2) 6 -3 7 (1 -3 . #0=(17)) 1 -2 7 (1 -2 . #0#) 29 . #0#) 11 . #0#) 13 -2 3 (1 1 0 1 0 0 1 -2 21 4 2) 6 -3 0 1 -3 31 0 27 2 17) 16 binding 10)\n"
-"(25 if-match (3 -1) 0 (26 1 1 3 7 (1 3 30 . #0=(6 -2 0 3 (1 2 0 3 (3 (1 2 0 2 vars-in 4 1) 0 9 1 0 (3 (5 (it) 0 3 (1 0 0 5 quote 0 2 list 4 2) 0 5 binding 0 2 list* 4 3) 0 1 0 0 2 list 8 2) 0 2 map 4 2) 0 5 let 0 2 list 4 3) 0 3 (5 ('nil) 0 1 1 0 3 (1 0 0 5 quote 0 2 list 4 2) 0 5 match 0 2 list* 4 4) 0 5 aif2 0 2 list 8 4)) 29 . #0#) 10)\n"
-"(9 1 0 (3 (1 0 0 2 var? 4 1) 7 (1 0 0 2 list 8 1) 3 (1 0 0 2 pair? 4 1) 7 (3 (1 0 31 0 2 vars-in 4 1) 0 3 (1 0 30 0 2 vars-in 4 1) 0 2 union 8 2) 29 17) 16 vars-in 10)\n"
-"(9 1 0 (1 0 0 2 varsym? 8 1) 16 var? 10)\n"
-"(5 ((0 $next) (1 (n . $next)) (2 (sym . $next)) (3 ($cont . $ret)) (4 (n)) (5 (v . $next)) (6 (offset . $next)) (7 ($then . $else)) (8 (n)) (9 (nparam nfree $body . $next)) (10 nil) (11 $next) (12 (n . $next)) (13 (n . $next)) (14 (n . $next)) (15 (sym . $next)) (16 (sym . $next)) (17 nil) (18 nil) (19 (offset n . $next)) (20 (n . $next)) (21 $next) (22 (tail . $next)) (23 (offset $body . $next)) (24 nil) (25 (name nparam nfree $body . $next)) (26 (n . $next)) (27 (n . $next)) (28 (offset n . $next)) (29 $next) (30 $next) (31 $next) (32 (n . $next)) (33 (n . $next)) (34 $next) (35 (n . $next)) (36 (n . $next)) (37 $next) (38 $next) (39 (n . $next)) (40 (n . $next)) (41 (n . $next)) (42 (n . $next))) 16 instructions 10)\n"
-"(3 (2 table 4 0) 16 *opcode-table* 10)\n"
-"(5 0 0 26 3 29 6 -2 2 instructions 6 -3 . #0=(3 (1 -3 0 2 pair? 4 1) 7 (1 -3 30 6 -4 3 (3 (1 -4 31 30 0 9 1 0 (5 #\\$ 0 3 (5 0 0 3 (1 0 0 2 string 4 1) 0 2 char-at 4 2) 38 17) 0 2 map 4 2) 0 1 -4 30 0 2 *opcode-table* 0 2 table-put! 4 3) 1 -3 31 0 19 1 1 . #0#) 11 26 -4 10))\n"
-"(9 2 0 (26 2 3 (1 0 0 2 create-ss-table 4 1) 6 -2 29 6 -3 20 -3 1 -2 0 1 1 0 1 -3 0 9 1 3 (26 6 . #0=(3 (1 0 0 12 2 0 2 table-get 4 2) 6 -2 7 (29 . #5=(6 -3 7 #3=(3 (5 -1 0 1 0 0 12 2 0 2 table-put! 4 3) 1 0 30 6 -3 3 (12 0 21 0 1 0 0 12 1 4 2) 6 -4 7 (1 -4 0 19 0 1 . #0#) 29 6 -5 1 0 31 6 -7 3 (1 -3 0 2 *opcode-table* 0 2 table-get 4 2) 6 -6 . #1=(3 (1 -6 0 2 pair? 4 1) 7 (1 -6 30 7 (3 (1 -7 30 0 12 0 21 4 1) . #2=(1 -7 31 0 1 -6 31 0 19 4 2 . #1#)) 11 . #2#) 1 -6 7 (1 -7 0 12 0 21 8 1) 11 . #4=(17))) 5 0 0 1 -2 0 42 2 6 -4 7 #3# 11 . #4#)) 5 t . #5#)) 13 -3 1 0 0 1 -3 21 8 1) 16 vm-walker 10)\n"
-"(9 2 0 (9 3 0 (26 8 3 (5 0 0 1 0 0 2 vector-get 4 2) 6 -2 5 :INVOKE 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 5 1 0 1 1 38 7 (3 (1 -3 0 2 scope-local-infos 4 1) 6 -6 3 (1 -5 0 1 -3 0 1 2 0 1 -6 0 1 -4 0 2 propagate-constant 4 5) 3 (1 -4 0 1 -6 0 2 remove-unused-params-args 4 2) 28 -7 2 3 (1 -7 0 1 -6 0 2 equal? 4 2) 7 (11 . #0=(17)) 3 (3 (1 -3 0 2 scope-outer-scope 4 1) 0 3 (1 -3 0 2 scope-sets 4 1) 0 1 -7 0 2 expand-scope2 4 3) 6 -9 3 (1 -9 0 1 -5 0 2 replace-body-scope! 4 2) 3 (1 -9 0 1 0 0 2 invoke-node-scope-set! 4 2) 1 -8 0 1 0 0 2 invoke-node-args-set! 8 2) 11 . #0#) 5 :APPLY 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 5 1 0 1 1 38 7 (3 (1 -4 0 2 refer-node? 4 1) 7 (3 (3 (1 -4 0 2 refer-node-name 4 1) 0 2 pure-function? 4 1) 7 (3 (1 -5 0 2 all-constant? 4 1) 7 (3 (3 (1 2 0 1 -3 0 1 -5 0 1 -4 0 2 fold-constant 4 4) 0 5 :CONST 0 2 vector 4 2) 0 1 0 0 2 copy-vector! 8 2) 11 . #0#) 11 . #0#) 11 . #0#) 11 . #0#) 5 :IF 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 5 1 0 1 1 38 7 (3 (1 -3 0 2 const-node? 4 1) 7 (3 (1 -3 0 2 const-node-value 4 1) 7 (1 -4 . #1=(0 1 0 0 2 copy-vector! 8 2)) 1 -5 . #1#) 11 . #0#) 11 . #0#) 29 . #0#) 0 1 1 0 1 0 0 2 traverse-ast 8 3) 16 optimize-ast 10)\n"
-"(5 0 0 26 4 3 (2 table 4 0) 6 -2 29 6 -3 5 (+ - * / < > <= >= int char ash logand logior logxor) 6 -4 . #0=(3 (1 -4 0 2 pair? 4 1) 7 (1 -4 30 6 -5 3 (5 t 0 1 -5 0 1 -2 0 2 table-put! 4 3) 1 -4 31 0 19 2 1 . #0#) 11 1 -2 0 9 1 1 (1 0 0 12 0 0 2 table-exists? 8 2) 16 pure-function? 26 -5 10))\n"
-"(9 1 0 (1 0 0 2 const-node? 0 2 every? 8 2) 16 all-constant? 10)\n"
-"(9 4 0 (3 (5 (10) 0 1 3 0 1 2 0 1 1 0 1 0 0 2 compile-apply2 4 5) 0 2 run-binary 8 1) 16 fold-constant 10)\n"
-"(25 match-cond (1 -1) 0 (26 2 3 (2 gensym 4 0) 6 -2 29 6 -3 20 -3 1 -2 0 1 -3 0 9 1 2 (26 1 1 0 7 (1 0 30 6 -2 5 t 0 1 -2 30 38 7 (1 -2 31 0 5 do 0 2 list* 8 2) 3 (1 0 31 0 12 0 21 4 1) 0 3 (1 -2 31 0 5 do 0 2 list* 4 2) 0 12 1 0 1 -2 30 0 5 if-match 0 2 list 8 5) 11 17) 13 -3 3 (1 1 0 1 -3 21 4 1) 0 1 0 0 1 -2 0 5 let1 0 2 list 8 4) 10)\n"
-"(9 3 0 (3 (1 1 0 1 0 0 2 set-car! 4 2) 3 (1 2 0 1 0 0 2 set-cdr! 4 2) 1 0 17) 16 replace-pair! 10)\n"
-"(9 1 0 (9 2 0 (26 15 3 (29 0 1 0 0 5 (5 nil . ?rest) 0 2 match 4 3) 28 -2 (1 -1) 1 -2 7 (1 -2 7 #18=(3 (1 -2 0 5 ?rest 0 2 binding 4 2) 6 -4 1 0 31 30 7 (29 . #0=(17)) 3 (1 -4 0 5 29 0 1 0 0 2 replace-pair! 4 3) 1 0 . #0#) 3 . #19=((29 0 1 0 0 5 (2 nil . ?rest) 0 2 match 4 3) 28 -4 (1 -1) 1 -4 7 (1 -4 7 #15=(3 (1 -4 0 5 ?rest 0 2 binding 4 2) 6 -6 3 (1 -6 0 5 29 0 1 0 0 2 replace-pair! 4 3) 1 0 . #0#) 3 . #16=((29 0 1 0 0 5 (2 t . ?rest) 0 2 match 4 3) 28 -6 (1 -1) 1 -6 7 (1 -6 7 #12=(3 (5 5 0 1 0 0 2 set-car! 4 2) 1 0 . #0#) 3 . #13=((29 0 1 0 0 5 (29 7 ?then . ?else) 0 2 match 4 3) 28 -8 (1 -1) 1 -8 7 (1 -8 7 #9=(3 (1 -8 0 5 ?else 0 2 binding 4 2) 6 -10 3 (1 -10 0 1 0 0 2 copy-pair! 4 2) 1 0 . #0#) 3 . #10=((29 0 1 0 0 5 (5 t 7 ?then . ?else) 0 2 match 4 3) 28 -10 (1 -1) 1 -10 7 (1 -10 7 #6=(3 (1 -10 0 5 ?then 0 2 binding 4 2) 6 -12 3 (1 -12 0 1 0 0 2 copy-pair! 4 2) 1 0 . #0#) 3 . #7=((29 0 1 0 0 5 (6 ?i 1 ?i . ?rest) 0 2 match 4 3) 28 -12 (1 -1) 1 -12 7 (1 -12 7 #3=(3 (1 -12 0 5 ?rest 0 2 binding 4 2) 6 -14 3 (1 -14 0 1 0 31 0 2 set-cdr! 4 2) 1 0 . #0#) 3 . #4=((29 0 1 0 0 5 (6 ?i 7 (1 ?i 7 ?then . ?else) . ?else2) 0 2 match 4 3) 28 -14 (1 -1) 1 -14 7 (1 -14 7 #1=(3 (1 -14 0 5 ?then 0 2 binding 4 2) 6 -16 3 (1 -16 0 1 0 31 31 31 0 2 set-car! 4 2) 1 0 . #0#) 29 . #0#) 1 -15 7 (1 -15 30 . #2=(6 -16 7 #1# 29 . #0#)) 29 . #2#)) 1 -13 7 (1 -13 30 . #5=(6 -14 7 #3# 3 . #4#)) 29 . #5#)) 1 -11 7 (1 -11 30 . #8=(6 -12 7 #6# 3 . #7#)) 29 . #8#)) 1 -9 7 (1 -9 30 . #11=(6 -10 7 #9# 3 . #10#)) 29 . #11#)) 1 -7 7 (1 -7 30 . #14=(6 -8 7 #12# 3 . #13#)) 29 . #14#)) 1 -5 7 (1 -5 30 . #17=(6 -6 7 #15# 3 . #16#)) 29 . #17#)) 1 -3 7 (1 -3 30 . #20=(6 -4 7 #18# 3 . #19#)) 29 . #20#) 0 1 0 0 2 vm-walker 8 2) 16 optimize! 10)\n"
-"(9 3 0 (26 9 3 (1 1 0 5 0 0 1 0 0 1 2 4 3) 3 (5 0 0 1 0 0 2 vector-get 4 2) 6 -2 5 :CONST 0 1 -2 38 7 (29 . #8=(6 -2 29 6 -3 1 -2 6 -4 . #0=(3 (1 -4 0 2 pair? 4 1) 7 (1 -4 30 6 -5 3 (1 -5 0 2 int? 4 1) 7 (5 0 0 1 -5 0 42 2 7 (3 (1 2 0 1 1 0 3 (1 -5 0 1 0 0 2 vector-get 4 2) 0 2 traverse-ast 4 3) . #2=(1 -4 31 0 19 2 1 . #0#)) 29 6 -6 3 (1 -5 34 0 1 0 0 2 vector-get 4 2) 6 -7 . #1=(3 (1 -7 0 2 pair? 4 1) 7 (1 -7 30 6 -8 3 (1 2 0 1 1 0 1 -8 0 2 traverse-ast 4 3) 1 -7 31 0 19 5 1 . #1#) 11 . #2#)) 11 . #2#) 11 3 (1 1 0 5 1 0 1 0 0 1 2 4 3) 29 6 -3 1 -2 6 -4 . #3=(3 (1 -4 0 2 pair? 4 1) 7 (1 -4 30 6 -5 3 (1 -5 0 2 int? 4 1) 7 (11 . #4=(1 -4 31 0 19 2 1 . #3#)) 3 (1 -5 0 2 int? 4 1) 7 (1 1 . #7=(6 -7 3 (1 -5 0 2 int? 4 1) 7 (1 -5 . #6=(6 -6 5 0 0 1 -6 0 42 2 7 (3 (1 2 0 1 -7 0 3 (1 -6 0 1 0 0 2 vector-get 4 2) 0 2 traverse-ast 4 3) . #4#) 29 6 -8 3 (1 -6 34 0 1 0 0 2 vector-get 4 2) 6 -9 . #5=(3 (1 -9 0 2 pair? 4 1) 7 (1 -9 30 6 -10 3 (1 2 0 1 -7 0 1 -10 0 2 traverse-ast 4 3) 1 -9 31 0 19 7 1 . #5#) 11 . #4#))) 1 -5 30 . #6#)) 3 (1 -5 31 0 1 0 0 2 vector-get 4 2) . #7#) 11 1 1 0 5 2 0 1 0 0 1 2 8 3)))) 5 :VOID 0 1 -2 38 7 (29 . #8#) 5 :REF 0 1 -2 38 7 (29 . #8#) 5 :SET! 0 1 -2 38 7 (5 (2) . #8#) 5 :DEF 0 1 -2 38 7 (5 (2) . #8#) 5 :IF 0 1 -2 38 7 (5 (1 2 3) . #8#) 5 :LAMBDA 0 1 -2 38 7 (5 ((-4 . 1)) . #8#) 5 :INVOKE 0 1 -2 38 7 (5 (-2 (-3 . 1)) . #8#) 5 :MACRO 0 1 -2 38 7 (5 ((-4 . 1)) . #8#) 5 :APPLY 0 1 -2 38 7 (5 (2 -3) . #8#) 5 :CONTI 0 1 -2 38 7 (5 (1) . #8#) 5 :CONTI-DIRECT 0 1 -2 38 7 (5 ((-2 . 1)) . #8#) 5 :VALS 0 1 -2 38 7 (5 (-1) . #8#) 5 :RECV 0 1 -2 38 7 (5 (3 (-4 . 1)) . #8#) 3 (1 0 0 5 \"Unknown [%@]\" 0 2 compile-error 4 2) . #8#) 16 traverse-ast 10)\n"
-"(9 1 0 (26 3 3 (1 0 0 2 list? 4 1) 7 (11 . #6=(3 (1 0 0 9 1 0 (5 (&rest &body) 0 1 0 0 2 member 8 2) 0 2 position-if 4 2) 6 -2 7 (3 (1 0 0 5 1 0 1 -2 0 32 2 0 2 drop 4 2) 6 -4 3 (1 0 0 1 -2 0 2 take 4 2) 6 -3 3 (1 -4 0 2 single? 4 1) 7 (11 . #4=(3 (1 -4 0 1 -3 0 2 append! 4 2) . #5=(6 -2 3 (1 0 0 9 1 0 (26 1 3 (1 0 0 2 symbol? 4 1) 6 -2 7 (29 . #0=(17)) 5 t . #0#) 0 2 some? 4 2) 6 -3 7 (3 (1 -3 30 0 5 \"parameter must be symbol, but `%@`\" 0 2 compile-error 4 2) . #3=(29 6 -3 1 -2 6 -4 . #1=(7 (3 (1 -4 31 0 1 -4 30 0 2 member 4 2) 7 (3 (1 -4 30 0 5 \"Duplicated parameter `%@`\" 0 2 compile-error 4 2) . #2=(1 -4 31 0 19 2 1 1 -4 . #1#)) 11 . #2#) 11 1 -2 17))) 11 . #3#))) 3 (1 -4 0 5 \"&rest requires only 1 name, but %@\" 0 2 compile-error 4 2) . #4#) 1 0 . #5#)) 3 (1 0 0 5 \"parameters must be list, but %@\" 0 2 compile-error 4 2) . #6#) 16 check-parameters 10)\n"
-"(9 1 0 (3 (1 0 0 2 pair? 4 1) 7 (5 ^ 0 1 0 30 38 . #0=(17)) 29 . #0#) 16 lambda-expression? 10)\n"
-"(9 2 0 (26 3 1 0 30 6 -2 3 (1 -2 0 2 symbol? 4 1) 6 -3 7 (29 . #1=(6 -3 7 #0=(1 0 17) 3 (1 -2 0 1 1 0 2 alpha-conversion 4 2) 6 -4 7 #0# 1 0 0 2 macroexpand 8 1)) 5 t . #1#) 16 expand-macro 10)\n"
-"(9 3 0 (26 1 . #1=(3 (1 0 0 2 symbol? 4 1) 7 (3 (1 0 0 1 1 0 2 alpha-conversion 4 2) 6 -2 7 (3 (5 1 0 1 -2 0 1 1 0 2 add-var-info 4 3) 1 -2 . #0=(6 -2 1 1 0 1 -2 0 2 traverse-refer 8 2)) 1 0 . #0#) 3 (1 0 0 2 pair? 4 1) 7 (3 (1 1 0 1 0 0 2 expand-macro 4 2) 6 -2 3 (1 -2 0 2 pair? 4 1) 7 (1 2 0 1 1 0 1 -2 0 2 traverse-list 8 3) 1 2 0 1 1 0 1 -2 0 19 0 3 . #1#) 1 0 0 5 :CONST 0 2 vector 8 2)) 16 traverse 10)\n"
-"(9 3 0 (26 3 1 0 30 6 -2 5 quote 0 1 -2 38 7 (1 0 31 0 9 1 0 (1 0 0 5 :CONST 0 2 vector 8 2) 0 2 apply 8 2) 5 ^ 0 1 -2 38 7 (1 0 31 0 1 1 0 9 (1 -1) 1 (12 0 0 1 1 0 1 0 0 2 traverse-lambda 8 3) 0 2 apply 8 2) 5 if 0 1 -2 38 7 (1 0 31 0 1 1 0 1 2 0 9 (2 -1) 2 (12 0 0 12 1 0 1 2 0 1 1 0 1 0 0 2 traverse-if 8 5) 0 2 apply 8 2) 5 set! 0 1 -2 38 7 (1 0 31 0 1 1 0 9 2 1 (12 0 0 1 1 0 1 0 0 5 :SET! 0 2 traverse-set! 8 4) 0 2 apply 8 2) 5 def 0 1 -2 38 7 (1 0 31 0 1 1 0 9 2 1 (3 (1 0 0 2 inline-function-name? 4 1) 7 (3 (12 0 0 1 1 0 1 0 0 2 register-inline-function 4 3) . #0=(12 0 0 1 1 0 1 0 0 5 :DEF 0 2 traverse-set! 8 4)) 11 . #0#) 0 2 apply 8 2) 5 call/cc 0 1 -2 38 7 (1 0 31 0 1 1 0 1 2 0 9 1 2 (12 0 0 12 1 0 1 0 0 2 traverse-call/cc 8 3) 0 2 apply 8 2) 5 defmacro 0 1 -2 38 7 (1 0 31 0 1 1 0 9 (2 -1) 1 (12 0 0 1 2 0 1 1 0 1 0 0 2 traverse-defmacro 8 4) 0 2 apply 8 2) 5 values 0 1 -2 38 7 (1 0 31 0 1 1 0 1 2 0 9 (0 -1) 2 (12 0 0 12 1 0 1 0 0 2 traverse-values 8 3) 0 2 apply 8 2) 5 receive 0 1 -2 38 7 (1 0 31 0 1 1 0 1 2 0 9 (2 -1) 2 (12 0 0 12 1 0 1 2 0 1 1 0 1 0 0 2 traverse-receive 8 5) 0 2 apply 8 2) 1 0 31 6 -4 1 0 30 6 -3 3 (1 -3 0 2 lambda-expression? 4 1) 7 (1 2 0 1 1 0 1 1 0 1 -4 0 1 -3 31 31 0 1 -3 31 30 0 2 traverse-apply-direct 8 6) 3 (1 -3 0 2 inline-function-name? 4 1) 7 (1 2 0 1 1 0 1 -4 0 1 -3 0 2 traverse-inline-apply 8 4) 1 2 0 1 1 0 1 -4 0 1 -3 0 2 traverse-apply 8 4) 16 traverse-list 10)\n"
-"(9 2 0 (26 1 3 (1 0 0 1 1 0 2 scope-local-has? 4 2) 6 -2 7 (11 . #0=(1 0 0 5 :REF 0 2 vector 8 2)) 3 (1 0 0 1 1 0 2 scope-upper-vars-has? 4 2) 7 (3 (1 0 0 1 1 0 2 register-fref 4 2) . #0#) 11 . #0#) 16 traverse-refer 10)\n"
-"(9 4 0 (26 6 3 (1 1 0 2 symbol? 4 1) 7 (11 . #6=(3 (1 1 0 1 3 0 2 alpha-conversion 4 2) 6 -2 7 (1 -2 . #5=(6 -2 3 (1 -2 0 1 3 0 2 scope-upper-vars-has? 4 2) 6 -4 3 (1 -2 0 1 3 0 2 scope-local-has? 4 2) 6 -3 7 (11 . #4=(3 (1 2 0 2 lambda-expression? 4 1) 7 (1 2 31 31 6 -6 1 2 31 30 6 -5 3 (1 3 0 1 -6 0 1 -5 0 2 prepare-lambda-node 4 3) 6 -7 5 :DEF 0 1 0 38 7 (3 (1 -7 0 1 -2 0 1 3 0 2 do-register-set! 4 3) . #0=(3 (1 -6 0 1 -7 0 2 traverse-lambda-exec 4 2) 1 -7 0 1 -2 0 1 0 0 2 vector 8 3)) 1 -3 7 (1 -3 . #1=(7 (3 (1 -7 0 1 -2 0 1 3 0 2 register-set! 4 3) . #0#) 29 . #0#)) 1 -4 7 (1 -4 . #1#) 29 . #0#) 3 (29 0 1 3 0 1 2 0 2 traverse 4 3) 6 -5 5 :SET! 0 1 0 38 7 (1 -3 7 (1 -3 . #3=(7 (3 (1 -5 0 1 -2 0 1 3 0 2 register-set! 4 3) . #2=(1 -5 0 1 -2 0 1 0 0 2 vector 8 3)) 11 . #2#)) 1 -4 7 (1 -4 . #3#) 11 . #2#) 11 . #2#)) 1 -4 7 (3 (1 -2 0 1 3 0 2 register-fref 4 2) . #4#) 11 . #4#)) 1 1 . #5#)) 3 (1 1 0 3 (5 4 0 5 1 0 3 (1 0 0 2 string 4 1) 0 2 substr 4 3) 0 5 \"`%s` requires symbol, but `%@`\" 0 2 compile-error 4 3) . #6#) 16 traverse-set! 10)\n"
-"(9 5 0 (1 2 7 (1 2 31 7 (3 (5 \"malformed if\" 0 2 compile-error 4 1) . #1=(1 2 7 (3 (1 4 0 1 3 0 1 2 30 0 2 traverse 4 3) . #0=(0 3 (1 4 0 1 3 0 1 1 0 2 traverse 4 3) 0 3 (29 0 1 3 0 1 0 0 2 traverse 4 3) 0 5 :IF 0 2 vector 8 4)) 5 #(:VOID) . #0#)) 11 . #1#) 11 . #1#) 16 traverse-if 10)\n"
-"(9 3 0 (26 5 3 (1 0 0 2 lambda-expression? 4 1) 7 (1 0 31 31 6 -3 1 0 31 30 6 -2 0 3 (1 -2 0 2 check-parameters 4 1) 38 7 (11 . #1=(5 1 0 3 (1 -2 0 2 length 4 1) 38 7 (11 . #0=(3 (1 1 0 1 -2 0 2 expand-scope 4 2) 6 -4 3 (1 2 0 1 -4 0 1 -3 0 2 traverse-body 4 3) 6 -5 3 (1 -2 30 0 1 -4 0 2 alpha-conversion 4 2) 6 -6 3 (5 128 0 1 -6 0 1 -4 0 2 add-var-info 4 3) 1 -5 0 1 -4 0 5 :CONTI-DIRECT 0 2 vector 8 3)) 3 (1 -2 0 5 \"Illegal parameters, call/cc requires 1 parameter function, but `%@`\" 0 2 compile-error 4 2) . #0#)) 3 (5 \"Not implemented: rest param for call/cc\" 0 2 compile-error 4 1) . #1#) 3 (1 2 0 1 1 0 1 0 0 2 traverse 4 3) 0 5 :CONTI 0 2 vector 8 2) 16 traverse-call/cc 10)\n"
-"(9 2 0 (26 2 3 (1 0 0 2 lambda-body-node-get 4 1) 6 -3 3 (1 0 0 2 lambda-scope-get 4 1) 6 -2 1 1 7 (3 (3 (5 t 0 1 -2 0 1 1 0 2 traverse-body 4 3) 0 1 -3 0 2 copy-pair! 4 2) . #0=(1 0 17)) 11 . #0#) 16 traverse-lambda-exec 10)\n"
-"(9 3 0 (1 1 0 3 (1 2 0 1 1 0 1 0 0 2 prepare-lambda-node 4 3) 0 2 traverse-lambda-exec 8 2) 16 traverse-lambda 10)\n"
-"(9 3 0 (1 0 0 1 1 0 1 2 0 9 1 2 (26 1 1 0 31 6 -2 7 (29 . #0=(0 12 1 0 1 0 30 0 2 traverse 8 3)) 12 0 . #0#) 0 2 maplist 8 2) 16 traverse-body 10)\n"
-"(9 3 0 (26 3 3 (1 0 0 1 1 0 2 var-is-set? 4 2) 6 -2 7 (3 (1 -2 0 2 single? 4 1) 7 (3 (1 -2 30 0 2 lambda-node? 4 1) 7 (3 (1 0 0 1 1 0 2 scope-local-has? 4 2) 7 (3 (5 16 0 1 0 0 1 1 0 2 var-has-attr? 4 3) 7 (5 32 . #0=(17)) 5 16 . #0#) 1 2 7 (3 (1 0 0 1 1 0 2 get-var-info 4 2) 28 -3 2 1 -4 7 (3 (1 -4 0 1 1 0 2 upper-scope-is? 4 2) . #1=(7 (5 8 . #0#) 5 64 . #0#)) 3 (1 1 0 2 scope-block-top-get 4 1) 0 3 (1 -2 30 0 2 lambda-scope-get 4 1) 38 . #1#) 5 64 . #0#) 5 . #2=(64 . #0#)) 5 . #2#) 5 . #2#) 16 detect-call-type 10)\n"
-"(9 4 0 (26 3 3 (1 0 0 2 symbol? 4 1) 7 (3 (1 0 0 1 2 0 2 alpha-conversion 4 2) . #2=(6 -2 7 (1 -2 . #1=(6 -2 3 (1 3 0 1 2 0 1 -2 0 2 detect-call-type 4 3) 6 -3 3 (1 0 0 2 symbol? 4 1) 7 (3 (1 -3 0 1 -2 0 1 2 0 2 add-var-info 4 3) 3 (1 2 0 1 -2 0 2 traverse-refer 4 2) . #0=(6 -4 3 (1 1 0 1 2 0 9 1 1 (29 0 12 0 0 1 0 0 2 traverse 8 3) 0 2 map 4 2) 0 1 -4 0 1 -3 0 5 :APPLY 0 2 vector 8 4)) 3 (29 0 1 2 0 1 0 0 2 traverse 4 3) . #0#)) 1 0 . #1#)) 29 . #2#) 16 traverse-apply 10)\n"
-"(9 4 0 (26 2 3 (1 0 0 2 get-inline-function-scope 4 1) 6 -3 3 (1 0 0 2 get-inline-function-body 4 1) 6 -2 1 3 0 1 -3 0 1 2 0 1 1 0 1 -2 31 31 0 1 -2 31 30 0 2 traverse-apply-direct 8 6) 16 traverse-inline-apply 10)\n"
-"(9 6 0 (26 7 . #2=(3 (1 0 0 2 check-parameters 4 1) 6 -2 1 0 0 1 -2 38 7 (5 0 . #3=(0 3 (1 -2 0 2 length 4 1) 0 33 2 6 -4 3 (1 2 0 2 length 4 1) 6 -3 1 -2 0 1 0 38 6 -5 7 (1 -4 0 1 -3 38 7 (3 (1 2 0 1 3 0 9 1 1 (29 0 12 0 0 1 0 0 2 traverse 8 3) 0 2 map 4 2) 6 -5 3 (1 3 0 1 -2 0 2 expand-scope 4 2) 6 -6 1 4 0 1 3 38 7 (1 -6 . #0=(6 -7 3 (1 5 0 1 -7 0 1 1 0 2 traverse-body 4 3) 6 -8 0 1 -5 0 1 -6 0 5 :INVOKE 0 2 vector 8 4)) 3 (1 4 0 3 (1 -6 0 2 scope-sets 4 1) 0 3 (1 -6 0 2 scope-local-infos 4 1) 0 2 expand-scope2 4 3) . #0#) 1 -4 0 1 -3 0 39 2 7 (5 \"few\" . #1=(6 -5 1 -4 0 1 -3 0 1 -5 0 5 \"Too %s arguments, %@ for %@\" 0 2 compile-error 8 4)) 5 \"many\" . #1#) 1 -4 0 1 -3 0 39 2 7 (1 5 0 1 4 0 1 3 0 1 2 0 1 1 0 1 -2 0 19 0 6 . #2#) 1 -4 0 1 -3 0 41 2 7 (3 (3 (3 (3 (1 2 0 1 -4 0 2 drop 4 2) 0 5 list 0 2 list* 4 2) 0 2 list 4 1) 0 3 (1 2 0 1 -4 0 2 take 4 2) 0 2 append! 4 2) 6 -5 1 5 0 1 4 0 1 3 0 1 -5 0 1 1 0 1 -2 0 19 0 6 . #2#) 1 5 0 1 4 0 1 3 0 3 (5 (nil) 0 1 2 0 2 append 4 2) 0 1 1 0 1 -2 0 19 0 6 . #2#)) 5 1 . #3#)) 16 traverse-apply-direct 10)\n"
-"(9 4 0 (26 4 3 (1 1 0 2 check-parameters 4 1) 6 -2 3 (1 3 0 1 -2 0 2 create-scope 4 2) 6 -3 3 (5 t 0 1 -3 0 1 2 0 2 traverse-body 4 3) 6 -4 1 -2 0 1 1 38 7 (3 (1 1 0 2 length 4 1) . #0=(6 -5 1 -4 0 1 -5 0 1 0 0 1 -3 0 5 :MACRO 0 2 vector 8 5)) 3 (5 -1 0 5 1 0 3 (1 -2 0 2 length 4 1) 0 33 2 0 2 list 4 2) . #0#) 16 traverse-defmacro 10)\n"
-"(9 3 0 (3 (1 0 0 1 1 0 1 2 0 1 0 0 9 1 3 (12 0 31 7 (12 1 . #0=(0 12 2 0 1 0 30 0 2 traverse 8 3)) 29 . #0#) 0 2 maplist 4 2) 0 5 :VALS 0 2 vector 8 2) 16 traverse-values 10)\n"
-"(9 5 0 (26 5 3 (1 0 0 2 check-parameters 4 1) 6 -2 3 (29 0 1 3 0 1 1 0 2 traverse 4 3) 6 -4 1 -2 0 1 0 38 7 (3 (1 0 0 2 length 4 1) . #0=(6 -3 3 (1 3 0 1 -2 0 2 expand-scope 4 2) 6 -5 3 (1 4 0 1 -5 0 1 2 0 2 traverse-body 4 3) 6 -6 0 1 -4 0 1 -3 0 1 -5 0 5 :RECV 0 2 vector 8 5)) 3 (5 -1 0 5 1 0 3 (1 -2 0 2 length 4 1) 0 33 2 0 2 list 4 2) . #0#) 16 traverse-receive 10)\n"
-"(9 3 0 (26 5 . #0=(3 (5 0 0 1 0 0 2 vector-get 4 2) 6 -2 5 :CONST 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 -3 0 5 5 0 2 list* 8 3) 5 :VOID 0 1 -2 38 7 (1 2 0 5 11 0 2 list* 8 2) 5 :REF 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 2 compile-ref 8 3) 5 :SET! 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -4 0 1 -3 0 2 compile-set! 8 4) 5 :DEF 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 2 0 1 -3 0 5 16 0 2 list* 4 3) 0 1 1 0 1 -4 0 19 0 3 . #0#) 5 :IF 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (3 (1 2 0 1 1 0 1 -5 0 2 compile-recur 4 3) 0 3 (1 2 0 1 1 0 1 -4 0 2 compile-recur 4 3) 0 5 7 0 2 list* 4 3) 0 1 1 0 1 -3 0 19 0 3 . #0#) 5 :LAMBDA 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -6 3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -6 0 1 -5 0 1 -4 0 1 -3 0 2 compile-lambda 8 6) 5 :INVOKE 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -5 0 1 -4 0 1 -3 0 2 compile-invoke 8 5) 5 :MACRO 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -6 3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -6 0 1 -5 0 1 -4 0 1 -3 0 2 compile-macro 8 6) 5 :APPLY 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 1 -5 0 1 -4 0 2 compile-apply 8 5) 5 :CONTI 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 2 compile-conti 8 3) 5 :CONTI-DIRECT 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -4 0 1 -3 0 2 compile-conti-direct 8 4) 5 :VALS 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 2 compile-vals 8 3) 5 :RECV 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -6 3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -6 0 1 -5 0 1 -4 0 1 -3 0 2 compile-recv 8 6) 1 0 0 5 \"Unknown [%@]\" 0 2 compile-error 8 2)) 16 compile-recur 10)\n"
-"(9 2 0 (26 4 3 (1 1 0 1 0 0 2 get-var-info 4 2) 28 -2 2 1 -2 7 (3 (1 -2 0 2 var-info-flag-get 4 1) 6 -4 3 (5 97 0 1 -4 0 2 bit? 4 2) 6 -5 7 (29 . #0=(17)) 5 16 0 1 -4 0 2 bit? 8 2) 29 . #0#) 16 can-eliminate-lambda-node? 10)\n"
-"(9 2 0 (26 4 . #0=(3 (5 0 0 1 0 0 2 vector-get 4 2) 6 -2 5 :LAMBDA 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 2 scope-outer-scope-set! 8 2) 5 :INVOKE 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -4 0 2 replace-body-scope! 4 2) 1 1 0 1 -3 0 2 scope-outer-scope-set! 8 2) 5 :RECV 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -4 0 2 replace-outer-scope! 4 2) 1 1 0 1 -3 0 2 scope-outer-scope-set! 8 2) 5 :SET! 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 19 0 2 . #0#) 5 :DEF 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 19 0 2 . #0#) 5 :IF 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -3 0 2 replace-outer-scope! 4 2) 3 (1 1 0 1 -4 0 2 replace-outer-scope! 4 2) 1 1 0 1 -5 0 19 0 2 . #0#) 5 :APPLY 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -3 0 2 replace-outer-scope! 4 2) 1 1 0 1 -4 0 2 replace-body-scope! 8 2) 5 :CONTI 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 19 0 2 . #0#) 5 :CONTI-DIRECT 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 2 replace-body-scope! 8 2) 5 :VALS 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 0 2 replace-body-scope! 8 2) 29 17)) 16 replace-outer-scope! 10)\n"
-"(9 2 0 (3 (1 1 0 1 0 0 2 lambda-scope-set! 4 2) 1 1 0 3 (1 0 0 2 lambda-body-node-get 4 1) 0 2 replace-body-scope! 8 2) 16 replace-lambda-scope! 10)\n"
-"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #0=(3 (1 -3 0 2 pair? 4 1) 7 (1 -3 30 6 -4 3 (1 1 0 1 -4 0 2 replace-outer-scope! 4 2) 1 -3 31 0 19 1 1 . #0#) 11 17)) 16 replace-body-scope! 10)\n"
-"(9 4 0 (3 (1 3 0 3 (1 1 0 2 length 4 1) 0 1 0 0 2 list* 4 3) 0 1 2 0 1 1 0 2 compile-args 8 3) 16 compile-embed-op 10)\n"
-"(9 4 0 (3 (3 (1 3 0 1 0 0 2 list* 4 2) 0 1 2 0 1 1 30 0 2 compile-recur 4 3) 0 1 2 0 1 1 31 0 2 compile-args 8 3) 16 compile-embed-op-1 10)\n"
-"(3 (2 table 4 0) 16 *compiler-embed-funcs* 10)\n"
-"(9 2 0 (1 1 0 1 0 0 2 *compiler-embed-funcs* 0 2 table-put! 8 3) 16 register-embed-func 10)\n"
-"(9 1 0 (1 0 0 2 *compiler-embed-funcs* 0 2 table-get 8 2) 16 compiler-embed-func? 10)\n"
-"(9 5 0 (26 5 3 (1 3 0 1 0 0 2 apply-func-can-be-loop? 4 2) 6 -2 7 (3 (5 16 0 1 2 0 2 bit? 4 2) 7 (3 (3 (1 0 0 2 refer-node-name 4 1) 0 1 3 0 2 can-eliminate-lambda-node? 4 2) 7 (1 4 0 1 3 0 1 1 0 1 0 0 1 -2 0 2 compile-apply-loop 8 5) 1 . #2=(-2 7 (3 (5 8 0 1 2 0 2 bit? 4 2) 7 (1 3 0 1 1 0 1 0 0 1 -2 0 2 compile-apply-self-recur 8 4) 3 . #1=((1 0 0 2 refer-node? 4 1) 7 (3 (3 (1 0 0 2 refer-node-name 4 1) 0 1 3 0 2 get-var-info 4 2) 28 -3 2 1 -3 7 (3 (1 -3 0 2 var-info-flag-get 4 1) 6 -5 3 (5 128 0 1 -5 0 2 bit? 4 2) 7 (3 (5 5 0 1 -5 0 2 bit? 4 2) 6 -6 7 (29 . #0=(6 -3 7 (1 3 0 1 1 0 1 0 0 2 compile-apply-conti 8 3) 1 4 0 1 3 0 1 2 0 1 1 0 1 0 0 2 compile-apply2 8 5)) 5 t . #0#) 29 . #0#) 29 . #0#) 29 . #0#)) 3 . #1#)) 1 . #2#) 1 . #2#) 16 compile-apply 10)\n"
-"(9 5 0 (26 1 3 (1 0 0 2 refer-node? 4 1) 7 (3 (3 (1 0 0 2 refer-node-name 4 1) 0 2 compiler-embed-func? 4 1) . #0=(6 -2 7 (1 4 0 1 3 0 1 1 0 1 -2 8 3) 1 4 0 1 3 0 1 1 0 1 0 0 2 compile-apply-normal 8 4)) 29 . #0#) 16 compile-apply2 10)\n"
-"(9 3 0 (26 2 3 (1 1 0 2 length 4 1) 6 -2 5 1 0 1 -2 0 41 2 7 (3 (3 (3 (1 0 0 2 refer-node-name 4 1) 0 1 2 0 2 get-var-orig-name 4 2) 0 5 \"Too many argument for continuation `%@`\" 0 2 compile-error 4 2) . #0=(3 (3 (5 24 0 2 list 4 1) 0 1 2 0 1 0 0 2 compile-recur 4 3) 6 -3 5 0 0 1 -2 38 7 (1 -3 0 5 0 0 5 29 0 2 list* 8 3) 1 -3 0 1 2 0 1 1 0 2 compile-args 8 3)) 11 . #0#) 16 compile-apply-conti 10)\n"
-"(9 4 0 (26 3 3 (1 1 0 2 length 4 1) 6 -3 5 17 0 1 3 30 38 6 -2 3 (3 (1 -2 7 (3 (1 -3 0 5 8 0 2 list 4 2) . #0=(0 1 2 0 1 0 0 2 compile-recur 4 3)) 3 (1 -3 0 5 4 0 2 list 4 2) . #0#) 0 1 2 0 1 1 0 2 compile-args 4 3) 6 -4 1 -2 7 (1 -4 17) 1 3 0 1 -4 0 5 3 0 2 list* 8 3) 16 compile-apply-normal 10)\n"
-"(9 5 0 (26 6 3 (1 0 0 2 lambda-scope-get 4 1) 6 -2 3 (1 -2 0 2 scope-local-infos 4 1) 6 -3 3 (1 2 0 2 length 4 1) 6 -7 3 (1 0 0 2 lambda-body-slot-get 4 1) 6 -6 3 (1 0 0 2 lambda-varnum-get 4 1) 6 -5 3 (1 3 0 3 (1 -2 0 2 scope-sets 4 1) 0 1 -3 0 2 expand-scope2 4 3) 6 -4 3 (1 -5 0 2 pair? 4 1) 7 (3 (5 \"Not implemented: rest param for loop\" 0 2 compile-error 4 1) . #1=(1 -5 0 1 -7 38 7 (11 . #0=(3 (1 -4 0 1 0 0 2 replace-lambda-scope! 4 2) 3 (3 (1 4 0 1 -4 0 3 (1 0 0 2 lambda-body-node-get 4 1) 0 1 -3 0 2 compile-body 4 4) 0 1 -6 0 2 copy-pair! 4 2) 3 (1 -4 0 2 calc-scope-work-size 4 1) 1 -6 0 1 -4 0 1 3 0 1 2 0 2 compile-args-for-local 8 4)) 3 (1 -7 0 1 -5 0 3 (3 (1 1 0 2 refer-node-name 4 1) 0 1 3 0 2 get-var-orig-name 4 2) 0 5 \"Illegal argnum, `%@` requires %@, but %@\" 0 2 compile-error 4 4) . #0#)) 11 . #1#) 16 compile-apply-loop 10)\n"
-"(9 4 0 (26 3 3 (3 (1 1 0 2 refer-node-name 4 1) 0 1 3 0 2 can-eliminate-lambda-node? 4 2) 7 (3 (3 (1 0 0 2 lambda-scope-get 4 1) 0 2 scope-upper-work-size 4 1) . #2=(6 -4 3 (1 0 0 2 lambda-varnum-get 4 1) 6 -3 3 (1 2 0 2 length 4 1) 6 -2 3 (1 -3 0 2 pair? 4 1) 7 (3 (5 \"Not implemented: rest param for loop\" 0 2 compile-error 4 1) . #1=(1 -3 0 1 -2 38 7 (11 . #0=(3 (3 (1 0 0 2 lambda-body-slot-get 4 1) 0 1 -2 0 1 -4 0 5 19 0 2 list* 4 4) 0 1 3 0 1 2 0 2 compile-args 8 3)) 3 (1 -2 0 1 -3 0 3 (3 (1 1 0 2 refer-node-name 4 1) 0 1 3 0 2 get-var-orig-name 4 2) 0 5 \"Illegal argnum, `%@` requires %@, but %@\" 0 2 compile-error 4 4) . #0#)) 11 . #1#)) 5 0 . #2#) 16 compile-apply-self-recur 10)\n"
-"(9 6 0 (26 2 3 (1 0 0 2 scope-frees 4 1) 6 -2 3 (3 (3 (5 17 0 2 list 4 1) 0 1 0 0 1 3 0 3 (1 0 0 2 scope-local-infos 4 1) 0 2 compile-body 4 4) 0 1 1 0 2 copy-pair! 4 2) 3 (1 0 0 2 scope-work-size 4 1) 6 -3 3 (1 5 0 5 0 0 1 -3 38 7 (1 1 . #0=(0 3 (1 -2 0 2 length 4 1) 0 1 2 0 5 9 0 2 list* 4 5)) 3 (1 1 0 1 -3 0 5 26 0 2 list* 4 3) . #0#) 0 1 4 0 1 -2 0 2 collect-free 8 3) 16 compile-lambda 10)\n"
-"(9 5 0 (3 (1 0 0 2 calc-scope-work-size 4 1) 3 (1 4 0 1 0 0 1 2 0 3 (1 0 0 2 scope-local-infos 4 1) 0 2 compile-body 4 4) 0 1 0 0 1 3 0 1 1 0 2 compile-args-for-local 8 4) 16 compile-invoke 10)\n"
-"(9 2 0 (26 5 29 6 -2 29 6 -6 29 6 -5 1 1 6 -4 1 0 6 -3 . #0=(7 (5 0 0 3 (1 -3 30 0 2 var-info-flag-get 4 1) 38 7 (1 -6 0 1 -5 0 1 -4 31 0 1 -3 31 0 19 1 4 . #1=(1 -3 . #0#)) 3 (1 -6 0 1 -4 30 0 2 cons 4 2) 0 3 (1 -5 0 1 -3 30 0 2 cons 4 2) 0 1 -4 31 0 1 -3 31 0 19 1 4 . #1#) 3 (1 -6 0 2 reverse! 4 1) 0 3 (1 -5 0 2 reverse! 4 1) 0 27 2 17)) 16 remove-unused-params-args 10)\n"
-"(9 5 0 (26 9 29 6 -2 1 1 6 -4 1 0 6 -3 . #0=(7 (1 -3 30 6 -6 3 (1 -4 30 0 2 var-info-name-get 4 1) 6 -5 3 (1 -5 0 1 3 0 2 var-is-set? 4 2) 7 (11 . #1=(1 -4 31 0 1 -3 31 0 19 1 2 1 -3 . #0#)) 3 (1 -6 0 2 const-node? 4 1) 6 -7 7 #2=(3 (1 -6 0 1 -5 0 1 4 0 2 replace-var-ref-body! 4 3) 3 (5 0 0 1 -4 30 0 2 var-info-flag-set! 4 2) . #1#) 3 (1 -6 0 2 refer-node? 4 1) 7 (3 (1 -6 0 2 refer-node-name 4 1) 6 -8 3 (1 -8 0 1 2 0 2 scope-local-has? 4 2) 6 -9 7 #4=(3 (1 -8 0 1 2 0 2 var-is-set? 4 2) 6 -9 7 (29 . #3=(6 -8 7 #2# 11 . #1#)) 5 t . #3#) 3 (1 -8 0 1 2 0 2 scope-upper-vars-has? 4 2) 6 -10 7 #4# 29 . #3#) 29 . #3#) 11 17)) 16 propagate-constant 10)\n"
-"(9 3 0 (26 3 29 6 -2 1 0 6 -3 . #0=(3 (1 -3 0 2 pair? 4 1) 7 (1 -3 30 6 -4 3 (1 2 0 1 1 0 1 -4 0 2 replace-var-ref! 4 3) 1 -3 31 0 19 1 1 . #0#) 11 17)) 16 replace-var-ref-body! 10)\n"
-"(9 3 0 (26 4 . #0=(3 (5 0 0 1 0 0 2 vector-get 4 2) 6 -2 5 :REF 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 1 0 1 -3 38 7 (1 2 0 1 0 0 2 copy-vector! 8 2) 11 . #1=(17)) 5 :LAMBDA 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -3 0 2 scope-frees-remove! 4 2) 1 2 0 1 1 0 1 -4 0 2 replace-var-ref-body! 8 3) 5 :MACRO 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 1 0 1 -3 0 2 scope-frees-remove! 4 2) 1 2 0 1 1 0 1 -4 0 2 replace-var-ref-body! 8 3) 5 :INVOKE 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 2 0 1 1 0 1 -3 0 2 replace-var-ref-body! 4 3) 1 2 0 1 1 0 1 -4 0 2 replace-var-ref-body! 8 3) 5 :RECV 0 1 -2 38 7 (3 (5 4 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 2 0 1 1 0 1 -3 0 2 replace-var-ref! 4 3) 1 2 0 1 1 0 1 -4 0 2 replace-var-ref-body! 8 3) 5 :SET! 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 19 0 3 . #0#) 5 :DEF 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 19 0 3 . #0#) 5 :IF 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -5 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 2 0 1 1 0 1 -3 0 2 replace-var-ref! 4 3) 3 (1 2 0 1 1 0 1 -4 0 2 replace-var-ref! 4 3) 1 2 0 1 1 0 1 -5 0 19 0 3 . #0#) 5 :APPLY 0 1 -2 38 7 (3 (5 3 0 1 0 0 2 vector-get 4 2) 6 -4 3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 3 (1 2 0 1 1 0 1 -3 0 2 replace-var-ref! 4 3) 1 2 0 1 1 0 1 -4 0 2 replace-var-ref-body! 8 3) 5 :CONTI 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 19 0 3 . #0#) 5 :CONTI-DIRECT 0 1 -2 38 7 (3 (5 2 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 2 replace-var-ref-body! 8 3) 5 :VALS 0 1 -2 38 7 (3 (5 1 0 1 0 0 2 vector-get 4 2) 6 -3 1 2 0 1 1 0 1 -3 0 2 replace-var-ref-body! 8 3) 29 . #1#)) 16 replace-var-ref! 10)\n"
-"(9 3 0 (26 3 3 (1 0 0 1 1 0 2 scope-local-has? 4 2) 6 -2 7 (1 -2 0 5 1 0 27 2 . #2=(28 -2 2 5 2 0 1 -2 38 6 -4 7 (1 . #1=(2 . #0=(0 1 -3 0 1 -2 0 2 list* 8 3))) 3 (1 0 0 1 1 0 2 var-is-set? 4 2) 7 (3 (1 2 0 5 21 0 2 list* 4 2) . #0#) 1 . #1#)) 3 (1 0 0 1 1 0 2 scope-frees-has? 4 2) 6 -3 7 (1 -3 0 5 12 0 27 2 . #2#) 1 0 0 5 2 0 27 2 . #2#) 16 compile-ref 10)\n"
-"(9 4 0 (26 2 3 (1 1 0 2 lambda-node? 4 1) 7 (3 (1 0 0 1 2 0 2 can-eliminate-lambda-node? 4 2) 7 (1 3 17) 3 . #1=((1 0 0 1 2 0 2 scope-local-has? 4 2) 6 -2 7 (1 -2 0 5 13 0 27 2 . #0=(28 -2 2 3 (1 3 0 1 -3 0 1 -2 0 2 list* 4 3) 0 1 2 0 1 1 0 2 compile-recur 8 3)) 3 (1 0 0 1 2 0 2 scope-frees-has? 4 2) 6 -3 7 (1 -3 0 5 14 0 27 2 . #0#) 1 0 0 5 15 0 27 2 . #0#)) 3 . #1#) 16 compile-set! 10)\n"
-"(9 3 0 (26 2 5 17 0 1 2 30 38 6 -2 3 (3 (1 -2 7 (3 (5 1 0 5 8 0 2 list 4 2) . #0=(0 1 1 0 1 0 0 2 compile-recur 4 3)) 3 (5 1 0 5 4 0 2 list 4 2) . #0#) 0 5 0 0 1 -2 0 5 22 0 2 list* 4 4) 6 -3 1 -2 7 (1 -3 17) 1 2 0 1 -3 0 5 3 0 2 list* 8 3) 16 compile-conti 10)\n"
-"(9 4 0 (26 7 3 (1 0 0 2 scope-local-infos 4 1) 6 -2 3 (1 -2 30 0 2 var-info-flag-get 4 1) 6 -4 5 17 0 1 3 30 38 6 -3 3 (5 5 0 1 -4 0 2 bit? 4 2) 7 (3 (1 0 0 2 calc-scope-work-size 4 1) 3 (3 (1 -3 7 (1 3 . #0=(0 1 0 0 1 1 0 1 -2 0 2 compile-body 4 4)) 3 (5 18 0 2 list 4 1) . #0#) 0 3 (1 0 0 2 get-scope-local-offset 4 1) 0 5 6 0 1 -3 0 5 22 0 2 list* 4 5) 6 -5 1 -3 7 (1 -5 17) 1 3 0 1 -5 0 5 3 0 2 list* 8 3) 3 (5 88 0 1 -4 0 2 bit? 4 2) 7 (3 (2 gensym 4 0) 6 -5 3 (1 -5 0 5 1 0 1 -5 0 2 var-info 4 3) 6 -6 3 (3 (1 -6 0 1 -6 0 1 -6 0 2 list 4 3) 0 3 (1 0 0 2 scope-local-infos 4 1) 0 2 append 4 2) 6 -7 3 (1 2 0 3 (1 0 0 2 scope-sets 4 1) 0 1 -7 0 2 expand-scope2 4 3) 6 -8 3 (1 -8 0 1 1 0 2 replace-body-scope! 4 2) 3 (1 -8 0 2 calc-scope-work-size 4 1) 1 3 0 3 (1 3 0 1 -8 0 1 1 0 1 -2 0 2 compile-body 4 4) 0 3 (1 -8 0 2 scope-upper-work-size 4 1) 0 5 23 0 2 list* 8 4) 3 (1 2 0 1 1 0 2 replace-body-scope! 4 2) 1 3 0 1 2 0 1 1 0 1 -2 0 2 compile-body 8 4) 16 compile-conti-direct 10)\n"
-"(9 3 0 (26 1 3 (1 0 0 2 length 4 1) 6 -2 5 0 0 1 -2 38 7 (1 2 0 5 11 0 2 list* 8 2) 3 (1 2 0 1 -2 0 5 27 0 2 list* 4 3) 0 1 1 0 1 0 0 2 compile-args 8 3) 16 compile-vals 10)\n"
-"(9 6 0 (3 (1 0 0 2 calc-scope-work-size 4 1) 3 (3 (1 5 0 1 0 0 1 3 0 3 (1 0 0 2 scope-local-infos 4 1) 0 2 compile-body 4 4) 0 1 1 0 3 (1 0 0 2 get-scope-local-offset 4 1) 0 5 28 0 2 list* 4 4) 0 1 4 0 1 2 0 2 compile-recur 8 3) 16 compile-recv 10)\n"
-"(9 6 0 (26 3 3 (3 (5 17 0 2 list 4 1) 0 1 0 0 1 3 0 3 (1 0 0 2 scope-local-infos 4 1) 0 2 compile-body 4 4) 6 -3 3 (1 0 0 2 scope-frees 4 1) 6 -2 3 (1 0 0 2 scope-work-size 4 1) 6 -4 3 (1 5 0 5 0 0 1 -4 38 7 (1 -3 . #0=(0 3 (1 -2 0 2 length 4 1) 0 1 2 0 1 1 0 5 25 0 2 list* 4 6)) 3 (1 -3 0 1 -4 0 5 26 0 2 list* 4 3) . #0#) 0 1 4 0 1 -2 0 2 collect-free 8 3) 16 compile-macro 10)\n"
-"(9 4 0 (26 1 1 1 7 (29 6 -2 20 -2 1 3 0 1 2 0 1 -2 0 9 1 3 (1 0 7 (3 (1 0 31 0 12 0 21 4 1) 0 12 1 0 1 0 30 0 2 compile-recur 8 3) 12 2 17) 13 -2 3 (1 1 0 1 -2 21 4 1) 0 1 0 0 1 2 0 2 make-boxes 8 3) 1 3 0 5 11 0 2 list* 8 2) 16 compile-body 10)\n"
-"(9 3 0 (26 1 29 6 -2 20 -2 1 2 0 1 -2 0 1 0 0 9 1 3 (26 3 . #0=(1 0 7 (1 0 31 6 -3 3 (1 0 30 0 2 var-info-name-get 4 1) 6 -2 3 (1 -2 0 12 0 0 2 var-is-set? 4 2) 7 (3 (12 0 0 1 -2 0 2 symbol-can-be-loop? 4 2) 7 (3 (1 -2 0 12 0 0 2 can-eliminate-lambda-node? 4 2) . #1=(6 -4 7 (1 . #2=(-3 0 19 0 1 . #0#)) 3 (1 -3 0 12 1 21 4 1) 0 3 (1 -2 0 12 0 0 2 scope-local-has? 4 2) 0 5 20 0 2 list* 8 3)) 29 . #1#) 1 . #2#) 12 2 17)) 13 -2 1 1 0 1 -2 21 8 1) 16 make-boxes 10)\n"
-"(9 3 0 #0=(1 0 7 (3 (3 (1 2 0 5 0 0 2 list* 4 2) 0 1 1 0 1 0 30 0 2 compile-recur 4 3) 0 1 1 0 1 0 31 0 19 0 3 . #0#) 1 2 17) 16 compile-args 10)\n"
-"(9 4 0 (26 4 29 6 -2 1 3 6 -5 3 (1 2 0 2 get-scope-local-offset 4 1) 6 -4 1 0 6 -3 . #0=(7 (3 (3 (1 -5 0 1 -4 0 5 6 0 2 list* 4 3) 0 1 1 0 1 -3 30 0 2 compile-recur 4 3) 0 5 1 0 1 -4 0 33 2 0 1 -3 31 0 19 1 3 1 -3 . #0#) 1 -5 17)) 16 compile-args-for-local 10)\n"
-"(9 3 0 (26 3 . #0=(1 0 7 (1 0 30 6 -2 3 (1 -2 0 1 1 0 2 scope-local-has? 4 2) 6 -3 7 (3 (1 2 0 5 0 0 1 -3 0 5 1 0 2 list* 4 4) . #1=(0 1 1 0 1 0 31 0 19 0 3 . #0#)) 3 (1 -2 0 1 1 0 2 scope-frees-has? 4 2) 6 -4 7 (3 (1 2 0 5 0 0 1 -4 0 5 12 0 2 list* 4 4) . #1#) 3 (1 1 0 1 -2 0 5 \"something wrong in collect-free [%@](%@)\" 0 2 compile-error 4 3) . #1#) 1 2 17)) 16 collect-free 10)\n"
-"(9 2 0 (3 (1 0 0 2 refer-node? 4 1) 7 (1 1 0 3 (1 0 0 2 refer-node-name 4 1) 0 2 symbol-can-be-loop? 8 2) 29 17) 16 apply-func-can-be-loop? 10)\n"
-"(9 2 0 (26 2 3 (1 0 0 1 1 0 2 var-is-set? 4 2) 6 -2 7 (3 (1 -2 0 2 single? 4 1) 7 (1 -2 30 6 -3 3 (1 -3 0 2 lambda-node? 4 1) 7 (1 -3 . #0=(17)) 29 . #0#) 29 . #0#) 11 . #0#) 16 symbol-can-be-loop? 10)\n"
-"(25 declaim (0 -1) 0 (3 (1 0 0 9 1 0 (26 4 3 (1 0 0 2 pair? 4 1) 7 (1 0 30 6 -2 5 inline 0 1 -2 38 7 (29 6 -3 1 0 31 6 -4 . #0=(3 (1 -4 0 2 pair? 4 1) 7 (1 -4 30 6 -5 3 (1 -5 0 2 declaim-inline 4 1) 1 -4 31 0 19 2 1 . #0#) 11 5 (values) . #1=(17))) 29 . #1#) 11 . #1#) 0 2 map 4 2) 0 5 do 0 2 list* 8 2) 10)\n"
-"(5 0 0 26 1 3 (2 table 4 0) 6 -2 0 9 1 1 (5 t 0 1 0 0 12 0 0 2 table-put! 8 3) 16 declaim-inline 1 -2 0 9 1 1 (3 (1 0 0 2 symbol? 4 1) 7 (1 0 0 12 0 0 2 table-exists? 8 2) 29 17) 16 inline-function-name? 1 -2 0 9 3 1 (26 2 3 (29 0 1 2 0 1 1 0 2 traverse 4 3) 6 -2 3 (1 -2 0 2 lambda-node? 4 1) 7 (3 (3 (1 -2 0 2 lambda-scope-get 4 1) 0 2 scope-frees 4 1) 6 -3 7 (3 . #0=((1 0 0 12 0 0 2 table-delete! 4 2) 29 17)) 3 (1 2 0 1 1 0 2 cons 4 2) 0 1 0 0 12 0 0 2 table-put! 8 3) 3 . #0#) 16 register-inline-function 1 -2 0 9 1 1 (3 (1 0 0 12 0 0 2 table-get 4 2) 30 17) 16 get-inline-function-body 1 -2 0 9 1 1 (3 (1 0 0 12 0 0 2 table-get 4 2) 31 17) 16 get-inline-function-scope 26 -2 10)\n"
-"(5 0 0 26 6 9 4 0 (1 0 0 1 2 0 1 1 0 1 3 0 9 3 4 (1 0 7 (3 (1 0 0 2 single? 4 1) 7 (12 0 7 (3 (1 2 0 12 0 0 2 list* 4 2) . #0=(0 1 1 0 1 0 30 0 2 compile-recur 8 3)) 1 2 . #0#) 1 2 0 1 1 0 1 0 0 12 1 0 2 compile-embed-op 8 4) 12 2 7 (1 2 0 12 2 0 5 5 0 2 list* 8 3) 12 3 0 5 \"`%@` requires at least 1 parameter\" 0 2 compile-error 8 2) 17) 6 -4 9 1 0 (1 0 0 9 3 1 (1 2 0 1 1 0 1 0 0 12 0 0 2 compile-embed-op-1 8 4) 17) 6 -3 9 1 0 (1 0 0 9 3 1 (1 2 0 1 1 0 1 0 0 12 0 0 2 compile-embed-op 8 4) 17) 6 -2 29 6 -5 3 (3 (3 (5 31 0 1 -3 4 1) 0 5 cdr 0 2 cons 4 2) 0 3 (3 (5 30 0 1 -3 4 1) 0 5 car 0 2 cons 4 2) 0 3 (3 (5 42 0 1 -2 4 1) 0 5 >= 0 2 cons 4 2) 0 3 (3 (5 40 0 1 -2 4 1) 0 5 <= 0 2 cons 4 2) 0 3 (3 (5 41 0 1 -2 4 1) 0 5 > 0 2 cons 4 2) 0 3 (3 (5 39 0 1 -2 4 1) 0 5 < 0 2 cons 4 2) 0 3 (3 (5 38 0 1 -3 4 1) 0 5 eq? 0 2 cons 4 2) 0 3 (3 (5 37 0 29 0 5 36 0 5 / 0 1 -4 4 4) 0 5 / 0 2 cons 4 2) 0 3 (3 (29 0 5 1 0 5 35 0 5 * 0 1 -4 4 4) 0 5 * 0 2 cons 4 2) 0 3 (3 (5 34 0 29 0 5 33 0 5 - 0 1 -4 4 4) 0 5 - 0 2 cons 4 2) 0 3 (3 (29 0 5 0 0 5 32 0 5 + 0 1 -4 4 4) 0 5 + 0 2 cons 4 2) 0 2 list 4 11) 6 -6 . #1=(3 (1 -6 0 2 pair? 4 1) 7 (1 -6 30 6 -7 3 (1 -7 31 0 1 -7 30 0 2 register-embed-func 4 2) 1 -6 31 0 19 4 1 . #1#) 11 26 -7 10))\n"
-"(5 0 0 26 1 29 6 -2 20 -2 1 -2 0 9 (0 -1) 1 (12 0 21 7 (3 (1 0 0 2 *stderr* 0 2 format 0 2 apply 4 3) 3 (2 *stderr* 0 5 \"\\n\" 0 2 display 4 2) 29 0 12 0 21 8 1) 3 (1 0 0 29 0 2 format 0 2 apply 4 3) 0 2 error 8 1) 16 compile-error 1 -2 0 9 1 1 (26 5 22 t 6 -3 14 0 3 (29 0 29 0 2 create-scope 4 2) 6 -2 3 (29 0 1 -2 0 1 0 0 2 traverse 4 3) 6 -3 3 (1 -2 0 1 -3 0 2 optimize-ast 4 2) 3 (5 10 0 2 list 4 1) 6 -4 3 (1 -4 0 1 -2 0 1 -3 0 2 compile-recur 4 3) 6 -5 3 (1 -2 0 2 scope-work-size 4 1) 6 -6 3 (1 -5 0 2 optimize! 4 1) 29 14 0 5 0 0 1 -6 38 7 (1 -5 17) 3 (3 (5 10 0 1 -6 0 5 -1 0 33 2 0 5 26 0 2 list 4 3) 0 1 -4 0 2 copy-pair! 4 2) 1 -5 0 1 -6 0 5 26 0 5 0 0 5 0 0 5 5 0 2 list* 8 6) 16 compile 26 -2 10)\n"
-"(9 1 0 (3 (1 0 0 2 compile 4 1) 0 2 run-binary 8 1) 16 eval 10)\n"
+"(9 1 0 (44 int 3 (43 0 45 type 1) 38 17) 16 int? 9 1 0 (44 pair 3 (43 0 45 type 1) 38 17) 16 pair? 9 1 0 (44 symbol 3 (43 0 45 type 1) 38 17) 16 symbol? 9 1 0 (44 string 3 (43 0 45 type 1) 38 17) 16 string? 9 1 0 (44 flonum 3 (43 0 45 type 1) 38 17) 16 flonum? 9 1 0 (44 char 3 (43 0 45 type 1) 38 17) 16 char? 9 1 0 (44 vector 3 (43 0 45 type 1) 38 17) 16 vector? 9 1 0 (44 table 3 (43 0 45 type 1) 38 17) 16 table? 10)\n"
+"(9 (2 -1) 0 (26 3 46 2 (29 6 -2 3 (43 2 43 1 45 cons 2) 6 -3 . #1=(3 (43 -3 2 null? 0 45 some? 2) 7 (29 . #0=(17)) 3 (3 (43 -3 2 car 0 45 map 2) 0 43 0 45 apply 2) 6 -4 7 (1 -4 . #0#) 3 (43 -3 2 cdr 0 45 map 2) 0 19 1 1 . #1#)) 29 6 -2 1 1 6 -3 7 . #2=((3 (1 -3 30 0 1 0 4 1) 6 -4 7 (43 -4 43 -3 27 2 . #0#) 1 -3 31 0 19 1 1 46 -3 . #2#) 29 0 29 0 27 2 . #0#)) 16 some? 10)\n"
+"(9 (2 -1) 0 (26 2 46 2 (29 6 -2 3 (43 2 43 1 45 cons 2) 6 -3 . #0=(3 (43 -3 2 null? 0 45 some? 2) 7 (5 t . #1=(17)) 3 (3 (43 -3 2 car 0 45 map 2) 0 43 0 45 apply 2) 7 (3 (43 -3 2 cdr 0 45 map 2) 0 19 1 1 . #0#) 29 . #1#)) 29 6 -2 1 1 6 -3 7 . #2=((3 (1 -3 30 0 1 0 4 1) 7 (1 -3 31 0 19 1 1 46 -3 . #2#) 29 . #1#) 5 t . #1#)) 16 every? 10)\n"
+"(9 (2 -1) 0 (26 4 46 2 (29 6 -2 29 6 -4 3 (43 2 43 1 45 cons 2) 6 -3 . #0=(3 (43 -3 2 null? 0 45 some? 2) 7 (43 -4 2 reverse! 8 1) 3 (43 -4 3 (3 (43 -3 2 car 0 45 map 2) 0 43 0 45 apply 2) 0 45 cons 2) 0 3 (43 -3 2 cdr 0 45 map 2) 0 19 1 2 . #0#)) 29 6 -2 29 6 -4 1 1 6 -3 . #1=(3 (43 -3 45 pair? 1) 7 (3 (43 -4 3 (1 -3 30 0 1 0 4 1) 0 45 cons 2) 0 1 -3 31 0 19 1 2 . #1#) 3 (43 -4 45 reverse! 1) 6 -5 46 -3 (46 -4 (3 (3 (43 -3 1 0 4 1) 0 43 -4 45 set-cdr! 2) 1 -5 . #2=(17)) 43 -3 1 0 8 1) 1 -5 . #2#)) 16 map 10)\n"
+"(25 do (0 -1) 0 (3 (43 0 29 0 44 ^ 45 list* 3) 0 2 list 8 1) 10)\n"
+"(25 when (1 -1) 0 (3 (43 1 44 do 45 list* 2) 0 43 0 44 if 2 list 8 3) 10)\n"
+"(25 unless (1 -1) 0 (3 (43 1 44 do 45 list* 2) 0 44 (do) 43 0 44 if 2 list 8 4) 10)\n"
+"(25 set! (2 -1) 0 (46 2 (3 (43 2 44 set! 45 list* 2) 0 3 (43 1 43 0 44 set! 45 list 3) 0 44 do 2 list 8 3) 43 1 43 0 44 set! 2 list 8 3) 10)\n"
+"(25 and (0 -1) 0 (46 0 (1 0 31 7 (44 ('nil) 3 (1 0 31 0 44 and 45 list* 2) 0 1 0 30 0 44 if 2 list* 8 4) 1 0 30 . #0=(17)) 5 t . #0#) 10)\n"
+"(25 let1 (2 -1) 0 (43 1 3 (43 2 3 (43 0 45 list 1) 0 44 ^ 45 list* 3) 0 2 list 8 2) 10)\n"
+"(25 let (1 -1) 0 (26 2 3 (43 0 45 symbol? 1) 7 (46 0 (1 1 31 6 -3 1 1 30 6 -2 3 (3 (43 -2 2 cadr 0 45 map 2) 0 43 0 45 list* 2) 0 3 (3 (43 -3 3 (43 -2 2 car 0 45 map 2) 0 44 ^ 45 list* 3) 0 43 0 44 set! 45 list 3) 0 29 0 43 0 44 let1 2 list 8 5) 3 . #1=((43 0 9 1 0 (26 1 3 (43 0 45 pair? 1) 7 (3 (1 0 31 0 45 single? 1) 6 -2 7 (11 . #0=(1 0 31 30 17)) 3 (43 0 44 \"malformed let: %@\" 45 compile-error 2) . #0#) 11 . #0#) 0 45 map 2) 0 3 (43 1 3 (43 0 2 car 0 45 map 2) 0 44 ^ 45 list* 3) 0 2 list* 8 2)) 3 . #1#) 10)\n"
+"(25 let* (1 -1) 0 (46 0 (3 (3 (3 (43 1 1 0 31 0 44 let* 45 list* 3) 0 45 list 1) 0 1 0 30 0 45 append 2) 0 44 let1 2 list* 8 2) 43 1 44 do 2 list* 8 2) 10)\n"
+"(25 alet (1 -1) 0 (43 1 43 0 44 loop 44 let 2 list* 8 4) 10)\n"
+"(9 2 0 (26 4 46 0 (1 0 31 6 -3 1 0 30 6 -2 31 6 -5 1 -2 30 6 -4 44 t 1 -4 38 7 (46 -3 (44 \"else clause must comes at last in cond\" 2 compile-error 8 1) 43 -5 44 do 2 list* 8 2) 43 -3 43 -5 43 -4 1 1 8 3) 29 17) 16 cond-template 10)\n"
+"(25 cond (0 -1) 0 (9 3 0 (3 (43 2 44 cond 45 list* 2) 0 3 (43 1 44 do 45 list* 2) 0 43 0 44 if 2 list 8 4) 0 43 0 2 cond-template 8 2) 10)\n"
+"(25 acond (0 -1) 0 (9 3 0 (26 1 3 (45 gensym 0) 6 -2 3 (3 (43 2 44 acond 45 list* 2) 0 3 (43 1 43 -2 44 it 44 let1 45 list* 4) 0 43 -2 44 if 45 list 4) 0 43 0 43 -2 44 let1 2 list 8 4) 0 43 0 2 cond-template 8 2) 10)\n"
+"(25 aif (1 -1) 0 (3 (43 1 44 it 44 if 45 list* 3) 0 43 0 44 it 44 let1 2 list 8 4) 10)\n"
+"(25 awhen (1 -1) 0 (3 (43 1 44 do 45 list* 2) 0 43 0 44 aif 2 list 8 3) 10)\n"
+"(25 let-gensym (1 -1) 0 (3 (43 0 45 pair? 1) 7 (43 1 3 (43 0 9 1 0 (44 (gensym) 43 0 2 list 8 2) 0 45 map 2) 0 44 let 2 list* 8 3) 43 1 44 (gensym) 43 0 44 let1 2 list* 8 4) 10)\n"
+"(25 while (1 -1) 0 (26 1 3 (45 gensym 0) 6 -2 3 (3 (3 (3 (43 -2 45 list 1) 0 45 list 1) 0 43 1 45 append 2) 0 43 0 44 when 45 list* 3) 0 29 0 43 -2 44 let 2 list 8 4) 10)\n"
+"(25 awhile (1 -1) 0 (26 1 3 (45 gensym 0) 6 -2 3 (3 (3 (3 (43 -2 45 list 1) 0 45 list 1) 0 43 1 45 append 2) 0 43 0 44 awhen 45 list* 3) 0 29 0 43 -2 44 let 2 list 8 4) 10)\n"
+"(25 until (1 -1) 0 (26 1 3 (45 gensym 0) 6 -2 3 (3 (3 (3 (43 -2 45 list 1) 0 45 list 1) 0 43 1 45 append 2) 0 43 0 44 unless 45 list* 3) 0 29 0 43 -2 44 let 2 list 8 4) 10)\n"
+"(25 or (0 -1) 0 (26 1 46 0 (3 (45 gensym 0) 6 -2 3 (3 (1 0 31 0 44 or 45 list* 2) 0 43 -2 43 -2 44 if 45 list 4) 0 1 0 30 0 43 -2 44 let1 2 list 8 4) 29 17) 10)\n"
+"(25 case (1 -1) 0 (26 1 3 (45 gensym 0) 6 -2 3 (3 (43 1 43 -2 9 1 1 (26 2 1 0 31 6 -3 1 0 30 6 -2 44 t 1 -2 38 7 (1 0 17) 3 (43 -2 45 pair? 1) 7 (43 -3 3 (3 (43 -2 44 quote 45 list 2) 0 12 0 0 44 member 45 list 3) 0 2 list* 8 2) 43 -3 3 (3 (43 -2 44 quote 45 list 2) 0 12 0 0 44 eq? 45 list 3) 0 2 list* 8 2) 0 45 map 2) 0 44 cond 45 list* 2) 0 43 0 43 -2 44 let1 2 list 8 4) 10)\n"
+"(25 dolist (1 -1) 0 (26 4 1 0 31 30 6 -3 1 0 30 6 -2 3 (45 gensym 0) 6 -5 3 (45 gensym 0) 6 -4 3 (3 (3 (3 (3 (3 (43 -4 44 cdr 45 list 2) 0 43 -5 45 list 2) 0 45 list 1) 0 43 1 45 append 2) 0 3 (43 -4 44 car 45 list 2) 0 43 -2 44 let1 45 list* 4) 0 3 (43 -4 44 pair? 45 list 2) 0 44 when 45 list 3) 0 3 (3 (43 -3 43 -4 45 list 2) 0 45 list 1) 0 43 -5 44 let 2 list 8 4) 10)\n"
+"(25 for0-n (2 -1) 0 (26 2 3 (45 gensym 0) 6 -3 3 (45 gensym 0) 6 -2 3 (3 (3 (3 (3 (3 (44 (1) 43 0 44 + 45 list* 3) 0 43 -3 45 list 2) 0 45 list 1) 0 43 2 45 append 2) 0 3 (43 -2 43 0 44 < 45 list 3) 0 44 when 45 list* 3) 0 3 (3 (44 (0) 43 0 45 list* 2) 0 45 list 1) 0 43 -3 44 let 45 list 4) 0 43 1 43 -2 44 let1 2 list 8 4) 10)\n"
+"(9 1 0 (26 4 3 (43 0 45 type 1) 6 -2 44 pair 1 -2 38 7 (29 6 -3 5 0 6 -5 1 0 6 -4 . #0=(3 (43 -4 45 pair? 1) 7 (44 1 43 -5 32 2 0 1 -4 31 0 19 2 2 . #0#) 1 -5 . #1=(17))) 44 string 1 -2 38 7 (43 0 2 string-length 8 1) 44 vector 1 -2 38 7 (43 0 2 vector-length 8 1) 5 0 . #1#) 16 length 10)\n"
+"(9 1 0 #0=(3 (1 0 31 0 45 pair? 1) 7 (1 0 31 0 19 0 1 . #0#) 1 0 17) 16 last 10)\n"
+"(9 1 0 (26 3 29 6 -2 29 6 -4 1 0 6 -3 . #0=(3 (43 -3 45 pair? 1) 7 (3 (43 -4 1 -3 30 0 45 cons 2) 0 1 -3 31 0 19 1 2 . #0#) 1 -4 17)) 16 reverse 10)\n"
+"(9 2 0 (26 4 29 6 -2 29 6 -4 1 1 6 -3 . #0=(3 (43 -3 45 pair? 1) 7 (3 (43 -4 3 (43 -3 1 0 4 1) 0 45 cons 2) 0 1 -3 31 0 19 1 2 . #0#) 3 (43 -4 45 reverse! 1) 6 -5 46 -3 (46 -4 (3 (3 (43 -3 1 0 4 1) 0 43 -4 45 set-cdr! 2) 1 -5 . #1=(17)) 43 -3 1 0 8 1) 1 -5 . #1#)) 16 maplist 10)\n"
+"(9 2 0 (43 1 43 0 9 1 1 (43 0 12 0 38 17) 0 2 some? 8 2) 16 member 10)\n"
+"(9 2 0 #0=(46 1 (43 0 1 1 30 30 38 7 (1 1 30 . #1=(17)) 1 1 31 0 43 0 19 0 2 . #0#) 29 . #1#) 16 assoc 10)\n"
+"(9 3 0 (43 2 3 (43 1 43 0 45 cons 2) 0 2 cons 8 2) 16 acons 10)\n"
+"(9 2 0 (26 1 . #0=(46 0 (1 0 30 6 -2 3 (43 1 43 -2 45 member 2) 7 (43 1 . #1=(1 0 31 0 19 0 2 . #0#)) 3 (43 1 43 -2 45 cons 2) 0 . #1#) 1 1 17)) 16 union 10)\n"
+"(9 2 0 #0=(46 0 (3 (43 1 1 0 30 0 45 member 2) 7 (3 (43 1 1 0 31 0 45 intersection 2) 0 1 0 30 0 2 cons 8 2) 43 1 1 0 31 0 19 0 2 . #0#) 29 17) 16 intersection 10)\n"
+"(9 1 0 (26 1 3 (43 0 45 pair? 1) 7 (1 0 31 6 -2 7 (29 . #0=(17)) 5 t . #0#) 29 . #0#) 16 single? 10)\n"
+"(9 2 0 (26 1 3 (43 0 45 reverse! 1) 6 -2 3 (43 1 43 0 45 set-cdr! 2) 1 -2 17) 16 nreconc 10)\n"
+"(9 (1 -1) 0 (26 1 46 1 (1 1 30 . #0=(6 -2 3 (43 -2 3 (43 0 45 create-ss-table 1) 0 43 0 45 write/ss-print 3) 1 0 17)) 2 *stdout* . #0#) 16 write/ss 10)\n"
+"(5 0 0 26 1 3 (45 gensym 0) 6 -2 0 9 1 1 (26 3 9 3 0 (26 1 3 (43 1 43 0 45 table-get 2) 7 (11 17) 3 (43 2 43 0 45 table-get 2) 6 -2 3 (43 -2 43 1 43 0 45 table-put! 3) 43 -2 44 1 32 2 0 43 2 43 0 2 table-put! 8 3) 6 -3 3 (44 eq? 45 table 1) 6 -2 3 (44 0 12 0 0 43 -2 45 table-put! 3) 29 6 -4 20 -4 43 -2 43 -4 43 -3 12 0 0 9 1 4 (26 4 . #0=(3 (43 0 45 type 1) 6 -2 3 (44 (pair vector) 43 -2 45 member 2) 7 (3 (43 0 12 3 0 45 table-exists? 2) 7 (12 0 0 43 0 12 3 0 12 1 8 3) 3 (29 0 43 0 12 3 0 45 table-put! 3) 44 pair 1 -2 38 7 (3 (1 0 30 0 12 2 21 4 1) 1 0 31 0 19 0 1 . #0#) 44 vector 1 -2 38 7 (3 (43 0 45 length 1) 6 -3 29 6 -4 5 0 6 -5 . #1=(43 -3 43 -5 39 2 7 (3 (3 (43 -5 43 0 45 vector-get 2) 0 12 2 21 4 1) 44 1 43 -5 32 2 0 19 3 1 . #1#) 11 . #2=(17))) 29 . #2#) 11 . #2#)) 13 -4 3 (43 0 1 -4 21 4 1) 1 -2 17) 16 create-ss-table 26 -2 10)\n"
+"(9 3 0 (26 9 3 (43 0 43 1 45 table-get 2) 6 -2 7 (44 0 43 -2 39 2 7 (43 -2 44 -1 33 2 0 44 \"#%@#\" 43 2 2 format 8 3) 46 -2 . #7=((3 (43 -2 44 \"#%@=\" 43 2 45 format 3) 3 (43 -2 44 -1 33 2 0 43 0 43 1 45 table-put! 3) . #6=(3 (43 0 45 type 1) 6 -3 44 pair 1 -3 38 7 (3 (1 0 31 0 45 single? 1) 7 (3 (1 0 31 0 43 1 45 table-get 2) 6 -4 7 (29 . #4=(6 -4 7 (3 (43 2 1 -4 31 0 45 display 2) 43 2 1 0 31 30 0 2 write 8 2) 29 6 -5 1 0 6 -7 5 \"(\" 6 -6 . #1=(46 -7 (3 (43 2 43 -6 45 display 2) 3 (43 2 43 1 1 -7 30 0 45 write/ss-print 3) 1 -7 31 6 -8 7 (3 (43 -8 45 pair? 1) 6 -9 7 (29 . #2=(6 -9 7 #0=(3 (43 2 44 \" . \" 45 display 2) 3 (43 2 43 1 43 -8 45 write/ss-print 3) . #3=(43 2 44 \")\" 2 display 8 2)) 3 (43 -8 43 1 45 table-get 2) 6 -10 7 #0# 43 -8 44 \" \" 19 4 2 . #1#)) 5 t . #2#) 29 . #2#) 11 . #3#))) 3 (44 ((quote . \"'\") (quasiquote . \"`\") (unquote . \",\") (unquote-splicing . \",@\")) 1 0 30 0 45 assoc 2) . #4#) 29 . #4#) 44 vector 1 -3 38 7 (3 (43 0 45 vector-length 1) 6 -4 29 6 -5 5 0 6 -7 5 \"#(\" 6 -6 . #5=(43 -4 43 -7 39 2 7 (3 (43 2 43 -6 45 display 2) 3 (43 2 43 1 3 (43 -7 43 0 45 vector-get 2) 0 45 write/ss-print 3) 44 1 43 -7 32 2 0 44 \" \" 19 4 2 . #5#) 11 43 2 44 \")\" 2 display 8 2)) 43 2 43 0 2 write 8 2)) 11 . #6#)) 46 -2 . #7#) 16 write/ss-print 10)\n"
+"(9 2 0 (26 4 29 6 -2 1 1 6 -5 29 6 -4 1 0 6 -3 . #0=(46 -5 (44 0 43 -3 41 2 7 (1 -5 31 0 3 (43 -4 1 -5 30 0 45 cons 2) 0 44 1 43 -3 33 2 0 19 1 3 . #0#) 43 -4 . #1=(2 reverse! 8 1)) 43 -4 . #1#)) 16 take 10)\n"
+"(9 2 0 #0=(46 1 (44 0 43 0 41 2 7 (1 1 31 0 44 1 43 0 33 2 0 19 0 2 . #0#) 1 1 . #1=(17)) 11 . #1#) 16 drop 10)\n"
+"(9 2 0 (3 (43 0 43 1 45 drop 2) 30 17) 16 elt 10)\n"
+"(9 2 0 (26 3 29 6 -2 5 0 6 -4 1 1 6 -3 7 . #0=((3 (1 -3 30 0 1 0 4 1) 7 (1 -4 . #1=(17)) 44 1 43 -4 32 2 0 1 -3 31 0 19 1 2 46 -3 . #0#) 29 . #1#)) 16 position-if 10)\n"
+"(9 2 0 (43 1 43 0 9 1 1 (12 0 0 1 0 38 17) 0 2 position-if 8 2) 16 position 10)\n"
+"(9 1 0 (26 2 46 0 (29 . #2=(6 -2 7 (1 -2 . #0=(17)) 3 (43 0 45 pair? 1) 7 (3 (43 0 45 last 1) 31 6 -3 7 (29 . #1=(6 -3 7 (1 -3 . #0#) 29 . #0#)) 5 t . #1#) 29 . #1#)) 5 t . #2#) 16 list? 10)\n"
+"(9 (0 -1) 0 (26 4 29 6 -2 1 0 30 6 -4 1 0 31 6 -3 7 . #0=((1 -3 30 6 -5 43 -4 43 -5 39 2 7 (43 -5 . #1=(1 -3 31 0 19 1 2 46 -3 . #0#)) 43 -4 . #1#) 1 -4 17)) 16 min 10)\n"
+"(9 2 0 (3 (1 1 30 0 43 0 45 set-car! 2) 1 1 31 0 43 0 2 set-cdr! 8 2) 16 copy-pair! 10)\n"
+"(9 2 0 (26 3 3 (3 (43 1 45 vector-length 1) 0 3 (43 0 45 vector-length 1) 0 45 min 2) 6 -2 29 6 -3 5 0 6 -4 . #0=(43 -2 43 -4 39 2 7 (3 (3 (43 -4 43 1 45 vector-get 2) 0 43 -4 43 0 45 vector-set! 3) 44 1 43 -4 32 2 0 19 2 1 . #0#) 11 17)) 16 copy-vector! 10)\n"
+"(9 2 0 (26 3 29 6 -2 29 6 -4 1 1 6 -3 7 . #0=((3 (1 -3 30 0 1 0 4 1) 7 (43 -4 . #1=(1 -3 31 0 19 1 2 46 -3 . #0#)) 3 (43 -4 1 -3 30 0 45 cons 2) 0 . #1#) 43 -4 2 reverse! 8 1)) 16 remove-if 10)\n"
+"(9 2 0 (43 1 43 0 9 1 1 (26 1 3 (43 0 12 0 4 1) 6 -2 7 (29 . #0=(17)) 5 t . #0#) 0 2 remove-if 8 2) 16 remove-if-not 10)\n"
+"(9 1 0 (3 (43 0 45 pair? 1) 7 (3 (1 0 31 0 45 copy-list 1) 0 3 (1 0 30 0 45 copy-list 1) 0 2 cons 8 2) 1 0 17) 16 copy-list 10)\n"
+"(9 2 0 (26 1 44 0 3 (43 1 43 0 45 logand 2) 38 6 -2 7 (29 . #0=(17)) 5 t . #0#) 16 bit? 10)\n"
+"(9 1 0 (26 5 3 (43 0 45 length 1) 6 -2 3 (43 -2 45 make-vector 1) 6 -3 29 6 -4 1 0 6 -6 5 0 6 -5 . #0=(43 -2 43 -5 39 2 7 (3 (1 -6 30 0 43 -5 43 -3 45 vector-set! 3) 1 -6 31 0 44 1 43 -5 32 2 0 19 3 2 . #0#) 1 -3 17)) 16 list->vector 10)\n"
+"(9 1 0 (44 (#\\space #\\tab #\\nl nil #\\( #\\) #\\[ #\\] #\\{ #\\} #\\; #\\,) 43 0 2 member 8 2) 16 delimiter? 10)\n"
+"(9 1 0 (26 1 3 (43 0 45 int 1) 6 -2 44 122 43 -2 44 97 40 3 7 (44 -32 43 -2 32 2 0 2 char 8 1) 1 0 17) 16 upcase 10)\n"
+"(9 1 0 (26 1 3 (3 (43 0 45 upcase 1) 0 45 int 1) 6 -2 44 57 43 -2 44 48 40 3 7 (44 48 43 -2 33 2 . #0=(17)) 44 90 43 -2 44 65 40 3 7 (44 55 43 -2 33 2 . #0#) 29 . #0#) 16 numeral-char? 10)\n"
+"(9 2 0 (26 4 29 6 -2 3 (43 0 45 read-char 1) 6 -4 5 0 6 -3 . #0=(3 (43 -4 45 delimiter? 1) 7 (3 (43 0 43 -4 45 unread-char 2) 1 -3 17) 44 #\\_ 1 -4 38 7 (3 (43 0 45 read-char 1) 0 43 -3 19 1 2 . #0#) 3 (43 -4 45 numeral-char? 1) 6 -5 7 (43 1 43 -5 39 2 7 (11 . #1=(3 (43 0 45 read-char 1) 0 43 -5 43 1 43 -3 35 2 0 32 2 0 19 1 2 . #0#)) 3 . #2=((43 -4 44 \"Illegal char for number literal [%@]\" 45 error 2) . #1#)) 3 . #2#)) 16 read-num-literal 10)\n"
+"(25 with-open-file (1 -1) 0 (26 2 1 0 31 30 6 -3 1 0 30 6 -2 3 (3 (3 (44 (result) 3 (43 -2 44 close 45 list 2) 0 45 list* 2) 0 43 1 45 append 2) 0 44 result 44 let1 45 list* 3) 0 3 (43 -3 44 open 45 list 2) 0 43 -2 44 let1 2 list 8 4) 10)\n"
+"(9 1 0 (26 3 29 6 -2 29 6 -3 . #0=(3 (43 0 45 read 1) 6 -4 7 (3 (43 -3 43 -4 45 cons 2) 0 19 1 1 . #0#) 43 -3 2 reverse! 8 1)) 16 stream->list 10)\n"
+"(3 (45 gensym 0) 16 *bq-clobberable* 10)\n"
+"(3 (29 0 44 quote 45 list 2) 16 *bq-quote-nil* 10)\n"
+"(3 (9 2 0 (3 (43 0 45 read 1) 0 44 quasiquote 2 list 8 2) 0 44 #\\` 45 set-macro-character 2) 10)\n"
+"(3 (9 2 0 (26 1 3 (43 0 45 read-char 1) 6 -2 44 #\\@ 1 -2 38 7 (3 (43 0 45 read 1) 0 44 unquote-splicing 2 list 8 2) 44 #\\. 1 -2 38 7 (3 (43 0 45 read 1) 0 44 unquote-dot 2 list 8 2) 3 (43 0 43 -2 45 unread-char 2) 3 (43 0 45 read 1) 0 44 unquote 2 list 8 2) 0 44 #\\, 45 set-macro-character 2) 10)\n"
+"(25 quasiquote 1 0 (43 0 2 bq-completely-process 8 1) 10)\n"
+"(9 1 0 (3 (43 0 45 bq-process 1) 0 2 bq-simplify 8 1) 16 bq-completely-process 10)\n"
+"(9 1 0 (26 4 . #0=(3 (43 0 45 pair? 1) 6 -2 7 (44 quasiquote 1 0 30 38 7 (3 (1 0 31 30 0 45 bq-completely-process 1) 0 19 0 1 . #0#) 44 unquote 1 0 30 38 7 (1 0 31 30 17) 44 unquote-splicing 1 0 30 38 7 (1 0 31 30 0 44 \",@~S after `\" 2 error 8 2) 44 unquote-dot 1 0 30 38 7 (1 0 31 30 0 44 \",.~S after `\" 2 error 8 2) 29 6 -2 29 6 -4 1 0 6 -3 . #2=(3 (43 -3 45 pair? 1) 6 -5 7 (44 unquote 1 -3 30 38 7 (1 -3 31 31 6 -5 7 (3 (43 -3 44 \"Malformed ,~S\" 45 error 2) . #1=(3 (3 (1 -3 31 30 0 45 list 1) 0 43 -4 45 nreconc 2) 0 44 append 2 cons 8 2)) 11 . #1#) 44 unquote-splicing 1 -3 30 38 7 (3 (43 -3 44 \"Dotted ,@~S\" 45 error 2) . #4=(44 unquote-dot 1 -3 30 38 7 (3 (43 -3 44 \"Dotted ,.~S\" 45 error 2) . #3=(3 (43 -4 3 (1 -3 30 0 45 bracket 1) 0 45 cons 2) 0 1 -3 31 0 19 1 2 . #2#)) 11 . #3#)) 11 . #4#) 3 (3 (3 (43 -3 44 quote 45 list 2) 0 45 list 1) 0 43 -4 45 nreconc 2) 0 44 append 2 cons 8 2)) 43 0 44 quote 2 list 8 2)) 16 bq-process 10)\n"
+"(9 1 0 (26 1 3 (43 0 45 pair? 1) 6 -2 7 (44 unquote 1 0 30 38 7 (1 0 31 30 0 44 list 2 list 8 2) 44 unquote-splicing 1 0 30 38 7 (1 0 31 30 17) 44 unquote-dot 1 0 30 38 7 (1 0 31 30 0 2 *bq-clobberable* 0 2 list 8 2) 3 (43 0 45 bq-process 1) 0 44 list 2 list 8 2) 3 (43 0 45 bq-process 1) 0 44 list 2 list 8 2) 16 bracket 10)\n"
+"(9 2 0 (26 2 3 (43 1 45 pair? 1) 6 -2 7 (3 (1 1 31 0 43 0 45 maptree 2) 6 -3 3 (1 1 30 0 1 0 4 1) 6 -2 3 (1 1 30 0 43 -2 45 equal? 2) 7 (3 (1 1 31 0 43 -3 45 equal? 2) 7 (1 1 17) 43 -3 . #0=(43 -2 2 cons 8 2)) 43 -3 . #0#) 43 1 1 0 8 1) 16 maptree 10)\n"
+"(9 1 0 (26 2 3 (43 0 45 pair? 1) 7 (44 unquote-splicing 1 0 30 38 6 -2 7 (1 -2 . #0=(17)) 44 unquote-dot 1 0 30 38 6 -3 7 (1 -3 . #0#) 29 . #0#) 29 . #0#) 16 bq-splicing-frob 10)\n"
+"(9 1 0 (26 3 3 (43 0 45 pair? 1) 7 (44 unquote 1 0 30 38 6 -2 7 (1 -2 . #0=(17)) 44 unquote-splicing 1 0 30 38 6 -3 7 (1 -3 . #0#) 44 unquote-dot 1 0 30 38 6 -4 7 (1 -4 . #0#) 29 . #0#) 29 . #0#) 16 bq-frob 10)\n"
+"(9 1 0 (26 2 3 (43 0 45 pair? 1) 7 (44 quote 1 0 30 38 7 (1 0 . #0=(6 -2 44 append 1 -2 30 38 6 -3 7 (43 -2 2 bq-simplify-args 8 1) 1 -2 . #1=(17))) 3 (43 0 2 bq-simplify 0 45 maptree 2) . #0#) 1 0 . #1#) 16 bq-simplify 10)\n"
+"(9 1 0 (26 4 29 6 -2 29 6 -4 3 (1 0 31 0 45 reverse 1) 6 -3 7 . #0=((3 (1 -3 30 0 45 pair? 1) 6 -5 7 (44 list 1 -3 30 30 38 7 (3 (1 -3 30 31 0 2 bq-splicing-frob 0 45 some? 2) 6 -5 7 (44 list* . #4=(1 -3 30 30 38 7 (3 (1 -3 30 31 0 2 bq-splicing-frob 0 45 some? 2) 6 -5 7 (44 quote . #3=(1 -3 30 30 38 7 (3 (1 -3 30 31 30 0 45 pair? 1) 7 (3 (1 -3 30 31 30 0 45 bq-frob 1) 6 -5 7 (2 . #2=(*bq-clobberable* 0 1 -3 30 30 38 7 (3 (43 -4 1 -3 30 31 30 0 44 append! 45 bq-attach-append 3) . #1=(0 1 -3 31 0 19 1 2 46 -3 . #0#)) 3 (43 -4 1 -3 30 0 44 append 45 bq-attach-append 3) . #1#)) 3 (43 -3 45 cddar 1) 6 -5 7 (2 . #2#) 3 (43 -4 3 (3 (3 (43 -3 45 caadar 1) 0 44 quote 45 list 2) 0 45 list 1) 0 45 bq-attach-conses 2) . #1#) 2 . #2#) 2 . #2#)) 3 (3 (43 -4 3 (1 -3 30 0 45 last 1) 30 0 44 append 45 bq-attach-append 3) 0 3 (3 (1 -3 30 31 0 45 reverse 1) 31 0 45 reverse 1) 0 45 bq-attach-conses 2) . #1#) 44 quote . #3#)) 3 (43 -4 1 -3 30 31 0 45 bq-attach-conses 2) . #1#) 44 list* . #4#) 3 (43 -4 1 -3 30 0 44 append 45 bq-attach-append 3) . #1#) 1 -4 17)) 16 bq-simplify-args 10)\n"
+"(9 1 0 (26 2 46 0 (29 . #2=(6 -2 7 (1 -2 . #0=(17)) 3 (43 0 45 pair? 1) 7 (44 quote 1 0 30 38 . #1=(6 -3 7 (1 -3 . #0#) 29 . #0#)) 29 . #1#)) 5 t . #2#) 16 null-or-quoted 10)\n"
+"(9 3 0 (26 2 3 (43 1 45 null-or-quoted 1) 7 (3 (43 2 45 null-or-quoted 1) 7 (3 (1 2 31 30 0 1 1 31 30 0 45 append 2) 0 44 quote 2 list 8 2) 46 2 . #3=((29 . #2=(6 -2 7 #0=(3 (43 1 45 bq-splicing-frob 1) 7 (43 1 43 0 2 list 8 2) 1 1 17) 3 (2 *bq-quote-nil* 0 43 2 45 equal? 2) 6 -3 7 #0# 3 (43 2 45 pair? 1) 7 (43 0 1 2 30 38 7 (1 2 31 0 43 1 1 2 30 0 2 list* 8 3) 43 2 . #1=(43 1 43 0 2 list 8 3)) 43 2 . #1#)) 5 t . #2#)) 46 2 . #3#) 16 bq-attach-append 10)\n"
+"(9 2 0 (26 2 3 (43 0 2 null-or-quoted 0 45 every? 2) 7 (3 (43 1 45 null-or-quoted 1) 7 (3 (1 1 31 30 0 3 (43 0 2 cadr 0 45 map 2) 0 45 append 2) 0 44 quote 2 list 8 2) 46 1 . #4=((29 . #3=(6 -2 7 #0=(43 0 44 list 2 cons 8 2) 3 (2 *bq-quote-nil* 0 43 1 45 equal? 2) 6 -3 7 #0# 3 (43 1 45 pair? 1) 7 (44 list 1 1 30 38 6 -2 7 #1=(3 (1 1 31 0 43 0 45 append 2) 0 1 1 30 0 2 cons 8 2) 44 list* 1 1 30 38 6 -3 7 #1# 3 . #2=((3 (43 1 45 list 1) 0 43 0 45 append 2) 0 44 list* 2 cons 8 2)) 3 . #2#)) 5 t . #3#)) 46 1 . #4#) 16 bq-attach-conses 10)\n"
+"(9 (0 -1) 0 (3 (2 *stderr* 0 43 0 45 write/ss 2) 2 *stderr* 0 44 \"\\n\" 2 display 8 2) 16 debug/ss 10)\n"
+"(5 0 0 26 1 3 (45 table 0) 6 -2 0 9 2 1 (43 1 43 0 12 0 0 2 table-put! 8 3) 16 register-setf-expander 43 -2 9 1 1 (26 1 3 (43 0 45 symbol? 1) 7 (3 (45 gensym 0) 6 -2 43 0 3 (43 -2 43 0 44 set! 45 list 3) 0 3 (43 -2 45 list 1) 0 29 0 29 0 27 5 17) 3 (43 0 45 pair? 1) 7 (3 (1 0 30 0 12 0 0 45 table-get 2) . #0=(6 -2 7 (43 0 1 -2 8 1) 43 0 44 \"not registered setf expander for `%@`\" 2 error 8 2)) 29 . #0#) 16 get-setf-expansion 26 -2 10)\n"
+"(9 2 0 (26 1 3 (43 0 45 pair? 1) 7 (3 (43 1 1 0 31 0 45 replace-tree 2) 0 3 (43 1 1 0 30 0 45 replace-tree 2) 0 2 cons 8 2) 3 (43 1 43 0 45 assoc 2) 6 -2 7 (1 -2 31 . #0=(17)) 1 0 . #0#) 16 replace-tree 10)\n"
+"(25 setf 2 0 (26 5 3 (43 0 45 get-setf-expansion 1) 28 -2 5 3 (3 (43 -3 43 -2 2 cons 0 45 map 3) 0 3 (43 1 1 -4 30 0 45 cons 2) 0 45 cons 2) 0 43 -5 2 replace-tree 8 2) 10)\n"
+"(3 (9 1 0 (26 2 3 (45 gensym 0) 6 -3 3 (45 gensym 0) 6 -2 3 (43 -2 44 car 45 list 2) 0 3 (43 -3 43 -2 44 set-car! 45 list 3) 0 3 (43 -3 45 list 1) 0 3 (1 0 31 30 0 45 list 1) 0 3 (43 -2 45 list 1) 0 27 5 17) 0 44 car 45 register-setf-expander 2) 10)\n"
+"(3 (9 1 0 (26 2 3 (45 gensym 0) 6 -3 3 (45 gensym 0) 6 -2 3 (43 -2 44 cdr 45 list 2) 0 3 (43 -3 43 -2 44 set-cdr! 45 list 3) 0 3 (43 -3 45 list 1) 0 3 (1 0 31 30 0 45 list 1) 0 3 (43 -2 45 list 1) 0 27 5 17) 0 44 cdr 45 register-setf-expander 2) 10)\n"
+"(3 (9 1 0 (26 3 3 (45 gensym 0) 6 -4 3 (45 gensym 0) 6 -3 3 (45 gensym 0) 6 -2 3 (43 -3 43 -2 44 table-get 45 list 3) 0 3 (43 -4 43 -3 43 -2 44 table-put! 45 list 4) 0 3 (43 -4 45 list 1) 0 3 (1 0 31 31 30 0 1 0 31 30 0 45 list 2) 0 3 (43 -3 43 -2 45 list 2) 0 27 5 17) 0 44 table-get 45 register-setf-expander 2) 10)\n"
+"(3 (9 1 0 (26 3 3 (45 gensym 0) 6 -4 3 (45 gensym 0) 6 -3 3 (45 gensym 0) 6 -2 3 (43 -3 43 -2 44 vector-get 45 list 3) 0 3 (43 -4 43 -3 43 -2 44 vector-set! 45 list 4) 0 3 (43 -4 45 list 1) 0 3 (1 0 31 31 30 0 1 0 31 30 0 45 list 2) 0 3 (43 -3 43 -2 45 list 2) 0 27 5 17) 0 44 vector-get 45 register-setf-expander 2) 10)\n"
+"(25 inc! (1 -1) 0 (26 6 46 1 (1 1 30 . #0=(6 -2 3 (43 0 45 get-setf-expansion 1) 28 -3 5 3 (3 (3 (43 -2 43 -7 44 + 1 -5 30 0 45 list 4) 0 45 list 1) 0 43 -6 45 replace-tree 2) 0 3 (43 -4 43 -3 2 list 0 45 map 3) 0 44 let 2 list 8 3)) 5 1 . #0#) 10)\n"
+"(25 dec! (1 -1) 0 (26 1 46 1 (1 1 30 . #0=(6 -2 3 (43 -2 44 - 45 list 2) 0 43 0 44 inc! 2 list 8 3)) 5 1 . #0#) 10)\n"
+"(25 push! 2 0 (26 5 3 (43 1 45 get-setf-expansion 1) 28 -2 5 3 (3 (3 (43 -6 43 0 44 cons 1 -4 30 0 45 list 4) 0 45 list 1) 0 43 -5 45 replace-tree 2) 0 3 (43 -3 43 -2 2 list 0 45 map 3) 0 44 let 2 list 8 3) 10)\n"
+"(25 pop! 1 0 (26 7 3 (43 0 45 get-setf-expansion 1) 28 -2 5 3 (45 gensym 0) 6 -8 1 -4 30 6 -7 3 (3 (43 -8 44 car 45 list 2) 0 3 (3 (3 (43 -8 44 cdr 43 -7 45 list 3) 0 45 list 1) 0 43 -5 45 replace-tree 2) 0 3 (3 (43 -6 43 -8 45 list 2) 0 45 list 1) 0 44 let 45 list 4) 0 3 (43 -3 43 -2 2 list 0 45 map 3) 0 44 let 2 list 8 3) 10)\n"
+"(5 0 16 *traverse-seq* 10)\n"
+"(9 0 0 (44 1 2 *traverse-seq* 0 32 2 15 *traverse-seq* 17) 16 traverse-seq 10)\n"
+"(9 2 0 (3 (45 traverse-seq 0) 0 29 0 29 0 44 0 43 1 29 0 44 t 29 0 3 (43 0 9 1 0 (43 0 44 0 3 (45 gensym 0) 0 2 var-info 8 3) 0 45 map 2) 0 2 vector 8 9) 16 create-scope 10)\n"
+"(9 2 0 (43 1 29 0 3 (43 0 9 1 0 (43 0 44 0 3 (45 gensym 0) 0 2 var-info 8 3) 0 45 map 2) 0 2 expand-scope2 8 3) 16 expand-scope 10)\n"
+"(9 3 0 (3 (45 traverse-seq 0) 0 29 0 29 0 44 0 43 2 43 1 29 0 29 0 43 0 2 vector 8 9) 16 expand-scope2 10)\n"
+"(9 1 0 (44 0 43 0 2 vector-get 8 2) 16 scope-local-infos 10)\n"
+"(9 1 0 (44 1 43 0 2 vector-get 8 2) 16 scope-frees 10)\n"
+"(9 1 0 (44 2 43 0 2 vector-get 8 2) 16 scope-block-top? 10)\n"
+"(9 1 0 (44 3 43 0 2 vector-get 8 2) 16 scope-sets 10)\n"
+"(9 1 0 (44 4 43 0 2 vector-get 8 2) 16 scope-outer-scope 10)\n"
+"(9 1 0 (44 5 43 0 2 vector-get 8 2) 16 scope-work-size 10)\n"
+"(9 1 0 (44 6 43 0 2 vector-get 8 2) 16 scope-caller 10)\n"
+"(9 1 0 (44 7 43 0 2 vector-get 8 2) 16 scope-func-name 10)\n"
+"(9 1 0 (44 8 43 0 2 vector-get 8 2) 16 scope-start-seq 10)\n"
+"(9 2 0 (43 1 44 1 43 0 2 vector-set! 8 3) 16 scope-frees-set! 10)\n"
+"(9 2 0 (43 1 44 3 43 0 2 vector-set! 8 3) 16 scope-sets-set! 10)\n"
+"(9 2 0 (43 1 44 5 43 0 2 vector-set! 8 3) 16 scope-work-size-set! 10)\n"
+"(9 2 0 (43 1 44 6 43 0 2 vector-set! 8 3) 16 scope-caller-set! 10)\n"
+"(9 2 0 (43 1 44 7 43 0 2 vector-set! 8 3) 16 scope-func-name-set! 10)\n"
+"(9 2 0 (43 1 44 4 43 0 2 vector-set! 8 3) 16 scope-outer-scope-set! 10)\n"
+"(9 1 0 (26 3 29 6 -2 5 0 6 -4 3 (43 0 45 scope-outer-scope 1) 6 -3 . #0=(3 (43 -3 45 scope-block-top? 1) 7 (1 -4 17) 3 (3 (43 -3 45 scope-local-infos 1) 0 45 length 1) 0 43 -4 32 2 0 3 (43 -3 45 scope-outer-scope 1) 0 19 1 2 . #0#)) 16 scope-upper-work-size 10)\n"
+"(9 2 0 (26 3 29 6 -2 1 0 6 -3 7 . #0=((3 (3 (43 -3 45 scope-local-infos 1) 0 43 1 9 1 1 (12 0 0 3 (43 0 45 var-info-orig-name-get 1) 38 17) 0 45 some? 2) 6 -4 7 (1 -4 30 0 2 var-info-name-get 8 1) 3 (43 -3 45 scope-outer-scope 1) 0 19 1 1 46 -3 . #0#) 11 17)) 16 alpha-conversion 10)\n"
+"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #1=(3 (43 1 43 -3 45 scope-local-only-has? 2) 6 -4 7 (3 (43 -3 45 scope-block-top? 1) 7 (1 -4 . #0=(17)) 3 (43 -3 45 scope-upper-work-size 1) 0 43 -4 32 2 0 44 -2 33 2 . #0#) 3 (43 -3 45 scope-block-top? 1) 7 (11 . #0#) 3 (43 -3 45 scope-outer-scope 1) 0 19 1 1 . #1#)) 16 scope-local-has? 10)\n"
+"(9 2 0 (3 (43 0 45 scope-local-infos 1) 0 43 1 9 1 1 (12 0 0 3 (43 0 45 var-info-name-get 1) 38 17) 0 2 position-if 8 2) 16 scope-local-only-has? 10)\n"
+"(9 1 0 (26 1 3 (43 0 45 scope-local-infos 1) 6 -2 7 (3 (1 -2 30 0 45 var-info-name-get 1) 0 43 0 2 scope-local-has? 8 2) 5 0 17) 16 get-scope-local-offset 10)\n"
+"(9 1 0 (26 2 29 6 -2 1 0 6 -3 . #0=(3 (43 -3 45 scope-block-top? 1) 7 (1 -3 17) 3 (43 -3 45 scope-outer-scope 1) 0 19 1 1 . #0#)) 16 scope-block-top-get 10)\n"
+"(9 1 0 (3 (3 (43 0 45 scope-block-top-get 1) 0 45 scope-outer-scope 1) 0 2 scope-block-top-get 8 1) 16 scope-upper-block-top-get 10)\n"
+"(9 2 0 (3 (43 1 45 scope-block-top-get 1) 0 3 (43 0 45 scope-block-top-get 1) 38 17) 16 same-scope-block? 10)\n"
+"(9 2 0 (3 (3 (43 0 45 scope-block-top-get 1) 0 45 scope-frees 1) 0 43 1 2 position 8 2) 16 scope-frees-has? 10)\n"
+"(9 2 0 (26 3 29 6 -2 3 (43 0 45 scope-block-top-get 1) 6 -3 . #0=(3 (43 -3 45 scope-outer-scope 1) 6 -4 7 (3 (43 1 43 -4 45 scope-local-only-has? 2) 7 (1 -4 . #1=(17)) 43 -4 19 1 1 . #0#) 29 . #1#)) 16 scope-upper-vars-has? 10)\n"
+"(9 2 0 (26 1 3 (43 0 45 scope-frees 1) 6 -2 3 (43 -2 43 1 45 member 2) 7 (3 (43 -2 43 1 9 1 1 (43 0 12 0 38 17) 0 45 remove-if 2) 0 43 0 2 scope-frees-set! 8 2) 11 17) 16 scope-frees-remove! 10)\n"
+"(9 1 0 (26 4 29 6 -2 5 0 6 -4 1 0 6 -3 . #0=(3 (3 (43 -3 45 scope-local-infos 1) 0 45 length 1) 0 43 -4 32 2 6 -5 3 (43 -3 45 scope-block-top? 1) 7 (1 -5 17) 43 -5 3 (43 -3 45 scope-outer-scope 1) 0 19 1 2 . #0#)) 16 scope-local-count 10)\n"
+"(9 3 0 (44 0 44 0 29 0 29 0 43 2 43 1 43 0 2 vector 8 7) 16 var-info 10)\n"
+"(9 1 0 (44 0 43 0 2 vector-get 8 2) 16 var-info-name-get 10)\n"
+"(9 1 0 (44 1 43 0 2 vector-get 8 2) 16 var-info-flag-get 10)\n"
+"(9 1 0 (44 2 43 0 2 vector-get 8 2) 16 var-info-orig-name-get 10)\n"
+"(9 1 0 (44 3 43 0 2 vector-get 8 2) 16 var-info-calls-get 10)\n"
+"(9 1 0 (44 4 43 0 2 vector-get 8 2) 16 var-info-captures-get 10)\n"
+"(9 1 0 (44 5 43 0 2 vector-get 8 2) 16 var-info-ref-seq-get 10)\n"
+"(9 1 0 (44 6 43 0 2 vector-get 8 2) 16 var-info-set-seq-get 10)\n"
+"(9 2 0 (43 1 44 1 43 0 2 vector-set! 8 3) 16 var-info-flag-set! 10)\n"
+"(9 2 0 (43 1 44 3 43 0 2 vector-set! 8 3) 16 var-info-calls-set! 10)\n"
+"(9 2 0 (43 1 44 4 43 0 2 vector-set! 8 3) 16 var-info-captures-set! 10)\n"
+"(9 2 0 (43 1 44 5 43 0 2 vector-set! 8 3) 16 var-info-ref-seq-set! 10)\n"
+"(9 2 0 (43 1 44 6 43 0 2 vector-set! 8 3) 16 var-info-set-seq-set! 10)\n"
+"(9 2 0 (26 2 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (43 -2 2 var-info-orig-name-get 8 1) 29 17) 16 get-var-orig-name 10)\n"
+"(9 2 0 (26 3 3 (43 1 45 symbol? 1) 7 (29 6 -2 1 0 6 -3 7 . #0=((3 (43 1 43 -3 45 scope-local-only-has? 2) 6 -4 7 (43 -3 3 (43 -4 3 (43 -3 45 scope-local-infos 1) 0 45 elt 2) 0 27 2 . #1=(17)) 3 (43 -3 45 scope-outer-scope 1) 0 19 1 1 46 -3 . #0#) 29 0 29 0 27 2 . #1#)) 29 0 29 0 27 2 . #1#) 16 get-var-info 10)\n"
+"(9 3 0 (26 2 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (3 (3 (43 2 3 (43 -2 45 var-info-flag-get 1) 0 45 logior 2) 0 43 -2 45 var-info-flag-set! 2) 1 -2 . #0=(17)) 11 . #0#) 16 add-var-info 10)\n"
+"(9 3 0 (26 2 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (3 (43 2 3 (43 -2 45 var-info-flag-get 1) 0 45 bit? 2) 7 (1 -2 . #0=(17)) 29 . #0#) 29 . #0#) 16 var-has-attr? 10)\n"
+"(9 2 0 (26 3 29 6 -2 1 0 6 -3 7 . #0=((3 (3 (43 -3 45 scope-sets 1) 0 43 1 45 assoc 2) 6 -4 7 (1 -4 31 . #1=(17)) 3 (43 -3 45 scope-outer-scope 1) 0 19 1 1 46 -3 . #0#) 11 . #1#)) 16 var-is-set? 10)\n"
+"(9 2 0 (26 5 3 (43 1 43 0 45 var-is-set? 2) 7 (3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (29 . #2=(6 -4 7 (1 -4 . #0=(17)) 3 (3 (43 -2 45 var-info-calls-get 1) 0 43 -2 9 1 1 (43 0 12 0 0 2 call-spans? 8 2) 0 45 some? 2) 6 -5 7 (1 -5 . #0#) 3 (3 (43 -2 45 var-info-captures-get 1) 0 9 1 0 (26 1 3 (43 0 45 loop-scope? 1) 6 -2 7 (29 . #1=(17)) 5 t . #1#) 0 45 some? 2) 6 -6 7 (1 -6 . #0#) 29 . #0#)) 5 t . #2#) 29 . #0#) 16 var-needs-box? 10)\n"
+"(9 2 0 (26 6 3 (44 2 43 1 45 vector-get 2) 6 -4 3 (44 1 43 1 45 vector-get 2) 6 -3 3 (44 0 43 1 45 vector-get 2) 6 -2 46 -4 (3 (43 -4 45 loop-call? 1) 7 (11 . #2=(17)) 29 . #3=(6 -5 1 -2 6 -7 1 -3 6 -6 7 . #0=((3 (1 -6 30 0 45 loop-scope? 1) 7 (3 (3 (1 -6 30 0 45 scope-start-seq 1) 0 43 -7 45 min 2) 0 . #1=(1 -6 31 0 19 4 2 46 -6 . #0#)) 43 -7 . #1#) 1 -7 6 -5 0 3 (43 0 45 var-info-set-seq-get 1) 0 41 2 7 (43 -5 3 (43 0 45 var-info-ref-seq-get 1) 0 41 2 . #2#) 29 . #2#))) 29 . #3#) 16 call-spans? 10)\n"
+"(9 3 0 (29 0 3 (44 24 43 1 45 bit? 2) 7 (3 (43 0 43 2 43 1 45 vector 3) . #0=(0 3 (45 traverse-seq 0) 0 43 0 2 register-call-seq 8 4)) 29 . #0#) 16 register-call 10)\n"
+"(9 4 0 (26 7 29 6 -2 1 3 6 -4 1 0 6 -3 7 . #1=((3 (43 2 43 -4 43 1 45 vector 3) 6 -5 29 6 -6 3 (43 -3 45 scope-local-infos 1) 6 -7 . #0=(3 (43 -7 45 pair? 1) 7 (1 -7 30 6 -8 3 (3 (3 (43 -8 45 var-info-calls-get 1) 0 43 -5 45 cons 2) 0 43 -8 45 var-info-calls-set! 2) 1 -7 31 0 19 5 1 . #0#) 11 3 (43 -3 45 scope-caller 1) 6 -5 7 (3 (43 -4 43 2 43 1 43 -5 45 register-call-seq 4) . #3=(3 (43 -3 45 scope-block-top? 1) 7 (3 (43 -4 43 -3 45 cons 2) 0 . #2=(3 (43 -3 45 scope-outer-scope 1) 0 19 1 2 46 -3 . #1#)) 43 -4 . #2#)) 11 . #3#)) 11 17)) 16 register-call-seq 10)\n"
+"(9 2 0 (26 2 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (3 (45 traverse-seq 0) 0 43 -2 2 var-info-ref-seq-set! 8 2) 11 17) 16 register-ref 10)\n"
+"(9 1 0 (26 5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (44 0 43 0 45 vector-get 2) 6 -2 3 (43 -4 43 -3 45 symbol-can-be-loop? 2) 7 (3 (44 8 43 -2 45 bit? 2) 6 -5 7 (1 -5 . #0=(17)) 3 (43 -3 43 -4 45 can-eliminate-lambda-node? 2) 6 -6 7 (1 -6 . #0#) 29 . #0#) 29 . #0#) 16 loop-call? 10)\n"
+"(9 1 0 (26 2 3 (43 0 45 scope-outer-scope 1) 6 -3 3 (43 0 45 scope-func-name 1) 6 -2 7 (3 (43 -3 43 -2 45 symbol-can-be-loop? 2) 7 (43 -2 43 -3 2 can-eliminate-lambda-node? 8 2) 29 . #0=(17)) 29 . #0#) 16 loop-scope? 10)\n"
+"(9 2 0 (26 6 3 (44 2 43 1 43 0 45 add-var-info 3) 6 -2 29 6 -3 1 0 6 -4 7 . #0=((3 (43 1 43 -4 45 scope-local-has? 2) 7 (11 . #3=(17)) 3 (43 -4 45 scope-block-top-get 1) 6 -5 3 (43 -5 45 scope-frees 1) 6 -6 3 (43 -6 43 1 45 member 2) 7 (11 . #2=(46 -2 (3 (3 (43 -2 45 var-info-captures-get 1) 0 43 -5 45 member 2) 6 -7 7 (11 . #1=(3 (43 -5 45 scope-outer-scope 1) 0 19 2 1 46 -4 . #0#)) 3 (3 (3 (43 -2 45 var-info-captures-get 1) 0 43 -5 45 cons 2) 0 43 -2 45 var-info-captures-set! 2) . #1#) 11 . #1#)) 3 (3 (43 -6 43 1 45 cons 2) 0 43 -5 45 scope-frees-set! 2) . #2#) 11 . #3#)) 16 register-fref 10)\n"
+"(9 3 0 (26 3 3 (44 4 43 1 43 0 45 add-var-info 3) 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (3 (3 (45 traverse-seq 0) 0 43 -2 45 var-info-set-seq-set! 2) 3 (43 0 43 -3 45 same-scope-block? 2) 7 (1 2 . #0=(6 -4 0 43 1 43 -3 2 do-register-set! 8 3)) 29 . #0#) 11 17) 16 register-set! 10)\n"
+"(9 3 0 (26 2 3 (43 0 45 scope-sets 1) 6 -2 3 (43 -2 43 1 45 assoc 2) 6 -3 7 (3 (1 -3 31 0 43 2 45 cons 2) 0 43 -3 2 set-cdr! 8 2) 3 (43 -2 3 (43 2 45 list 1) 0 43 1 45 acons 3) 0 43 0 2 scope-sets-set! 8 2) 16 do-register-set! 10)\n"
+"(9 1 0 (26 3 29 6 -2 5 0 6 -4 1 0 6 -3 . #0=(3 (43 -3 45 scope-block-top? 1) 7 (3 (43 -3 45 scope-work-size 1) 0 43 -4 41 2 7 (43 -4 43 -3 2 scope-work-size-set! 8 2) 11 17) 3 (3 (43 -3 45 scope-local-infos 1) 0 45 length 1) 0 43 -4 32 2 0 3 (43 -3 45 scope-outer-scope 1) 0 19 1 2 . #0#)) 16 calc-scope-work-size 10)\n"
+"(9 2 0 (26 2 3 (43 1 45 scope-block-top-get 1) 6 -3 3 (43 0 45 scope-upper-block-top-get 1) 6 -2 43 -3 1 -2 38 17) 16 upper-scope-is? 10)\n"
+"(9 3 0 (26 4 46 1 (3 (29 0 29 0 45 cons 2) . #1=(6 -3 3 (43 0 45 check-parameters 1) 6 -2 0 1 0 38 7 (3 (43 0 45 length 1) . #0=(6 -5 3 (43 2 43 -2 45 create-scope 2) 6 -4 43 -3 43 -5 43 -2 43 -4 2 create-lambda-node 8 4)) 3 (44 -1 44 1 3 (43 -2 45 length 1) 0 33 2 0 45 list 2) . #0#)) 29 . #1#) 16 prepare-lambda-node 10)\n"
+"(9 4 0 (43 3 43 2 3 (29 0 29 0 45 cons 2) 0 43 0 44 :LAMBDA 2 vector 8 5) 16 create-lambda-node 10)\n"
+"(9 1 0 (3 (43 0 45 vector? 1) 7 (44 :LAMBDA 3 (44 0 43 0 45 vector-get 2) 38 . #0=(17)) 29 . #0#) 16 lambda-node? 10)\n"
+"(9 1 0 (44 1 43 0 2 vector-get 8 2) 16 lambda-scope-get 10)\n"
+"(9 1 0 (44 2 43 0 2 vector-get 8 2) 16 lambda-body-slot-get 10)\n"
+"(9 1 0 (44 3 43 0 2 vector-get 8 2) 16 lambda-varnum-get 10)\n"
+"(9 1 0 (44 4 43 0 2 vector-get 8 2) 16 lambda-body-node-get 10)\n"
+"(9 2 0 (43 1 44 1 43 0 2 vector-set! 8 3) 16 lambda-scope-set! 10)\n"
+"(9 1 0 (3 (43 0 45 vector? 1) 7 (44 :REF 3 (44 0 43 0 45 vector-get 2) 38 . #0=(17)) 29 . #0#) 16 refer-node? 10)\n"
+"(9 1 0 (44 1 43 0 2 vector-get 8 2) 16 refer-node-name 10)\n"
+"(9 1 0 (3 (43 0 45 vector? 1) 7 (44 :CONST 3 (44 0 43 0 45 vector-get 2) 38 . #0=(17)) 29 . #0#) 16 const-node? 10)\n"
+"(9 1 0 (44 1 43 0 2 vector-get 8 2) 16 const-node-value 10)\n"
+"(9 2 0 (43 1 44 1 43 0 2 vector-set! 8 3) 16 invoke-node-scope-set! 10)\n"
+"(9 2 0 (43 1 44 2 43 0 2 vector-set! 8 3) 16 invoke-node-args-set! 10)\n"
+"(25 aif2 (1 -1) 0 (26 3 46 1 (1 1 31 7 (1 1 31 30 . #1=(6 -3 46 1 (1 1 30 . #0=(6 -2 3 (45 gensym 0) 6 -4 3 (43 -3 43 -2 3 (3 (3 (43 -4 44 car 45 list 2) 0 43 -4 44 and 45 list 3) 0 44 it 44 or 45 list 3) 0 44 if 45 list 4) 0 43 0 3 (43 -4 44 &rest 44 it 45 list 3) 0 44 receive 2 list 8 4)) 29 . #0#)) 29 . #1#) 29 . #1#) 10)\n"
+"(25 acond2 (0 -1) 0 (26 3 46 0 (3 (45 gensym 0) 6 -4 3 (45 gensym 0) 6 -3 1 0 30 6 -2 3 (3 (1 0 31 0 44 acond2 45 list* 2) 0 3 (1 -2 31 0 43 -3 44 it 44 let1 45 list* 4) 0 3 (3 (3 (43 -4 44 car 45 list 2) 0 43 -4 44 and 45 list 3) 0 43 -3 44 or 45 list 3) 0 44 if 45 list 4) 0 1 -2 30 0 3 (43 -4 44 &rest 43 -3 45 list 3) 0 44 receive 2 list 8 4) 29 17) 10)\n"
+"(25 labels (1 -1) 0 (3 (43 1 3 (43 0 9 1 0 (3 (1 0 31 31 0 1 0 31 30 0 44 ^ 45 list* 3) 0 1 0 30 0 44 set! 2 list 8 3) 0 45 map 2) 0 45 append 2) 0 3 (43 0 9 1 0 (29 0 1 0 30 0 2 list 8 2) 0 45 map 2) 0 44 let 2 list* 8 3) 10)\n"
+"(9 3 0 (26 15 . #0=(3 (43 1 43 0 45 equal? 2) 28 -2 (1 -1) 46 -2 (46 -2 #20=(44 t 43 2 27 2 . #1=(17)) 3 . #21=((43 2 43 0 45 binding 2) 28 -4 (1 -1) 46 -4 (46 -4 #17=(43 2 43 1 43 -4 19 0 3 . #0#) 3 . #18=((43 2 43 1 45 binding 2) 28 -6 (1 -1) 46 -6 (46 -6 #14=(43 2 43 -6 43 0 19 0 3 . #0#) 3 . #15=((43 0 45 varsym? 1) 28 -8 (1 -1) 46 -8 (46 -8 #11=(44 t 3 (43 2 3 (43 1 43 0 45 cons 2) 0 45 cons 2) 0 27 2 . #1#) 3 . #12=((43 1 45 varsym? 1) 28 -10 (1 -1) 46 -10 (46 -10 #8=(44 t 3 (43 2 3 (43 0 43 1 45 cons 2) 0 45 cons 2) 0 27 2 . #1#) 3 . #9=((43 0 45 pair? 1) 7 (3 (43 1 45 pair? 1) 7 (3 (43 2 1 1 30 0 1 0 30 0 45 match 3) . #7=(28 -12 (1 -1) 46 -12 (46 -12 #4=(43 -12 1 1 31 0 1 0 31 0 19 0 3 . #0#) 5 . #5=(t 28 -14 (1 -1) 46 -14 (46 -14 #2=(29 0 29 0 27 2 . #1#) 29 . #1#) 46 -15 (1 -15 30 . #3=(6 -16 7 #2# 29 . #1#)) 29 . #3#)) 46 -13 (1 -13 30 . #6=(6 -14 7 #4# 5 . #5#)) 29 . #6#)) 29 . #7#) 29 . #7#)) 46 -11 (1 -11 30 . #10=(6 -12 7 #8# 3 . #9#)) 29 . #10#)) 46 -9 (1 -9 30 . #13=(6 -10 7 #11# 3 . #12#)) 29 . #13#)) 46 -7 (1 -7 30 . #16=(6 -8 7 #14# 3 . #15#)) 29 . #16#)) 46 -5 (1 -5 30 . #19=(6 -6 7 #17# 3 . #18#)) 29 . #19#)) 46 -3 (1 -3 30 . #22=(6 -4 7 #20# 3 . #21#)) 29 . #22#)) 16 match 10)\n"
+"(9 1 0 (3 (43 0 45 symbol? 1) 7 (44 #\\? 3 (44 0 3 (43 0 45 string 1) 0 45 char-at 2) 38 . #0=(17)) 29 . #0#) 16 varsym? 10)\n"
+"(9 2 0 (26 2 29 6 -2 20 -2 43 -2 9 2 1 (26 2 3 (43 1 43 0 45 assoc 2) 6 -2 7 (3 (43 1 1 -2 31 0 12 0 21 4 2) 6 -3 7 (1 -3 . #0=(17)) 46 -2 (1 -2 . #0#) 29 . #0#) 11 . #0#) 13 -2 3 (43 1 43 0 1 -2 21 4 2) 6 -3 0 1 -3 31 0 27 2 17) 16 binding 10)\n"
+"(25 if-match (3 -1) 0 (26 1 46 3 (1 3 30 . #0=(6 -2 0 3 (43 2 3 (3 (43 2 45 vars-in 1) 0 9 1 0 (3 (44 (it) 3 (43 0 44 quote 45 list 2) 0 44 binding 45 list* 3) 0 43 0 2 list 8 2) 0 45 map 2) 0 44 let 45 list 3) 0 3 (44 ('nil) 43 1 3 (43 0 44 quote 45 list 2) 0 44 match 45 list* 4) 0 44 aif2 2 list 8 4)) 29 . #0#) 10)\n"
+"(9 1 0 (3 (43 0 45 var? 1) 7 (43 0 2 list 8 1) 3 (43 0 45 pair? 1) 7 (3 (1 0 31 0 45 vars-in 1) 0 3 (1 0 30 0 45 vars-in 1) 0 2 union 8 2) 29 17) 16 vars-in 10)\n"
+"(9 1 0 (43 0 2 varsym? 8 1) 16 var? 10)\n"
+"(5 ((0 $next) (1 (n . $next)) (2 (sym . $next)) (3 ($cont . $ret)) (4 (n)) (5 (v . $next)) (6 (offset . $next)) (7 ($then . $else)) (8 (n)) (9 (nparam nfree $body . $next)) (10 nil) (11 $next) (12 (n . $next)) (13 (n . $next)) (14 (n . $next)) (15 (sym . $next)) (16 (sym . $next)) (17 nil) (18 nil) (19 (offset n . $next)) (20 (n . $next)) (21 $next) (22 (tail . $next)) (23 (offset $body . $next)) (24 nil) (25 (name nparam nfree $body . $next)) (26 (n . $next)) (27 (n . $next)) (28 (offset n . $next)) (29 $next) (30 $next) (31 $next) (32 (n . $next)) (33 (n . $next)) (34 $next) (35 (n . $next)) (36 (n . $next)) (37 $next) (38 $next) (39 (n . $next)) (40 (n . $next)) (41 (n . $next)) (42 (n . $next)) (43 (n . $next)) (44 (v . $next)) (45 (sym n)) (46 (n $then . $else))) 16 instructions 10)\n"
+"(3 (45 table 0) 16 *opcode-table* 10)\n"
+"(5 0 0 26 3 29 6 -2 2 instructions 6 -3 . #0=(3 (43 -3 45 pair? 1) 7 (1 -3 30 6 -4 3 (3 (1 -4 31 30 0 9 1 0 (44 #\\$ 3 (44 0 3 (43 0 45 string 1) 0 45 char-at 2) 38 17) 0 45 map 2) 0 1 -4 30 0 2 *opcode-table* 0 45 table-put! 3) 1 -3 31 0 19 1 1 . #0#) 11 26 -4 10))\n"
+"(9 2 0 (26 2 3 (43 0 45 create-ss-table 1) 6 -2 29 6 -3 20 -3 43 -2 43 1 43 -3 9 1 3 (26 6 . #0=(3 (43 0 12 2 0 45 table-get 2) 6 -2 7 (29 . #5=(6 -3 7 #3=(3 (44 -1 43 0 12 2 0 45 table-put! 3) 1 0 30 6 -3 3 (12 0 21 0 43 0 12 1 4 2) 6 -4 7 (43 -4 19 0 1 . #0#) 29 6 -5 1 0 31 6 -7 3 (43 -3 2 *opcode-table* 0 45 table-get 2) 6 -6 . #1=(3 (43 -6 45 pair? 1) 7 (1 -6 30 7 (3 (1 -7 30 0 12 0 21 4 1) . #2=(1 -7 31 0 1 -6 31 0 19 4 2 . #1#)) 11 . #2#) 46 -6 (43 -7 12 0 21 8 1) 11 . #4=(17))) 44 0 43 -2 42 2 6 -4 7 #3# 11 . #4#)) 5 t . #5#)) 13 -3 43 0 1 -3 21 8 1) 16 vm-walker 10)\n"
+"(9 2 0 (9 3 0 (26 8 3 (44 0 43 0 45 vector-get 2) 6 -2 44 :INVOKE 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 44 1 1 1 38 7 (3 (43 -3 45 scope-local-infos 1) 6 -6 3 (43 -5 43 -3 43 2 43 -6 43 -4 45 propagate-constant 5) 3 (43 -4 43 -6 45 remove-unused-params-args 2) 28 -7 2 3 (43 -7 43 -6 45 equal? 2) 7 (11 . #0=(17)) 3 (3 (43 -3 45 scope-outer-scope 1) 0 3 (43 -3 45 scope-sets 1) 0 43 -7 45 expand-scope2 3) 6 -9 3 (43 -9 43 -5 45 replace-body-scope! 2) 3 (43 -9 43 0 45 invoke-node-scope-set! 2) 43 -8 43 0 2 invoke-node-args-set! 8 2) 11 . #0#) 44 :APPLY 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 44 1 1 1 38 7 (3 (43 -4 45 refer-node? 1) 7 (3 (3 (43 -4 45 refer-node-name 1) 0 45 pure-function? 1) 7 (3 (43 -5 45 all-constant? 1) 7 (3 (3 (43 2 43 -3 43 -5 43 -4 45 fold-constant 4) 0 44 :CONST 45 vector 2) 0 43 0 2 copy-vector! 8 2) 11 . #0#) 11 . #0#) 11 . #0#) 11 . #0#) 44 :IF 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 44 1 1 1 38 7 (3 (43 -3 45 const-node? 1) 7 (3 (43 -3 45 const-node-value 1) 7 (43 -4 . #1=(43 0 2 copy-vector! 8 2)) 43 -5 . #1#) 11 . #0#) 11 . #0#) 29 . #0#) 0 43 1 43 0 2 traverse-ast 8 3) 16 optimize-ast 10)\n"
+"(5 0 0 26 4 3 (45 table 0) 6 -2 29 6 -3 5 (+ - * / < > <= >= int char ash logand logior logxor) 6 -4 . #0=(3 (43 -4 45 pair? 1) 7 (1 -4 30 6 -5 3 (44 t 43 -5 43 -2 45 table-put! 3) 1 -4 31 0 19 2 1 . #0#) 11 43 -2 9 1 1 (43 0 12 0 0 2 table-exists? 8 2) 16 pure-function? 26 -5 10))\n"
+"(9 1 0 (43 0 2 const-node? 0 2 every? 8 2) 16 all-constant? 10)\n"
+"(9 4 0 (3 (44 (10) 43 3 43 2 43 1 43 0 45 compile-apply2 5) 0 2 run-binary 8 1) 16 fold-constant 10)\n"
+"(25 match-cond (1 -1) 0 (26 2 3 (45 gensym 0) 6 -2 29 6 -3 20 -3 43 -2 43 -3 9 1 2 (26 1 46 0 (1 0 30 6 -2 44 t 1 -2 30 38 7 (1 -2 31 0 44 do 2 list* 8 2) 3 (1 0 31 0 12 0 21 4 1) 0 3 (1 -2 31 0 44 do 45 list* 2) 0 12 1 0 1 -2 30 0 44 if-match 2 list 8 5) 11 17) 13 -3 3 (43 1 1 -3 21 4 1) 0 43 0 43 -2 44 let1 2 list 8 4) 10)\n"
+"(9 3 0 (3 (43 1 43 0 45 set-car! 2) 3 (43 2 43 0 45 set-cdr! 2) 1 0 17) 16 replace-pair! 10)\n"
+"(9 1 0 (3 (43 0 45 peephole! 1) 43 0 2 combine-instructions! 8 1) 16 optimize! 10)\n"
+"(9 1 0 (9 2 0 (26 15 3 (29 0 43 0 44 (5 nil . ?rest) 45 match 3) 28 -2 (1 -1) 46 -2 (46 -2 #18=(3 (43 -2 44 ?rest 45 binding 2) 6 -4 1 0 31 30 7 (29 . #0=(17)) 3 (43 -4 44 29 43 0 45 replace-pair! 3) 1 0 . #0#) 3 . #19=((29 0 43 0 44 (2 nil . ?rest) 45 match 3) 28 -4 (1 -1) 46 -4 (46 -4 #15=(3 (43 -4 44 ?rest 45 binding 2) 6 -6 3 (43 -6 44 29 43 0 45 replace-pair! 3) 1 0 . #0#) 3 . #16=((29 0 43 0 44 (2 t . ?rest) 45 match 3) 28 -6 (1 -1) 46 -6 (46 -6 #12=(3 (44 5 43 0 45 set-car! 2) 1 0 . #0#) 3 . #13=((29 0 43 0 44 (29 7 ?then . ?else) 45 match 3) 28 -8 (1 -1) 46 -8 (46 -8 #9=(3 (43 -8 44 ?else 45 binding 2) 6 -10 3 (43 -10 43 0 45 copy-pair! 2) 1 0 . #0#) 3 . #10=((29 0 43 0 44 (5 t 7 ?then . ?else) 45 match 3) 28 -10 (1 -1) 46 -10 (46 -10 #6=(3 (43 -10 44 ?then 45 binding 2) 6 -12 3 (43 -12 43 0 45 copy-pair! 2) 1 0 . #0#) 3 . #7=((29 0 43 0 44 (6 ?i 1 ?i . ?rest) 45 match 3) 28 -12 (1 -1) 46 -12 (46 -12 #3=(3 (43 -12 44 ?rest 45 binding 2) 6 -14 3 (43 -14 1 0 31 0 45 set-cdr! 2) 1 0 . #0#) 3 . #4=((29 0 43 0 44 (6 ?i 7 (1 ?i 7 ?then . ?else) . ?else2) 45 match 3) 28 -14 (1 -1) 46 -14 (46 -14 #1=(3 (43 -14 44 ?then 45 binding 2) 6 -16 3 (43 -16 1 0 31 31 31 0 45 set-car! 2) 1 0 . #0#) 29 . #0#) 46 -15 (1 -15 30 . #2=(6 -16 7 #1# 29 . #0#)) 29 . #2#)) 46 -13 (1 -13 30 . #5=(6 -14 7 #3# 3 . #4#)) 29 . #5#)) 46 -11 (1 -11 30 . #8=(6 -12 7 #6# 3 . #7#)) 29 . #8#)) 46 -9 (1 -9 30 . #11=(6 -10 7 #9# 3 . #10#)) 29 . #11#)) 46 -7 (1 -7 30 . #14=(6 -8 7 #12# 3 . #13#)) 29 . #14#)) 46 -5 (1 -5 30 . #17=(6 -6 7 #15# 3 . #16#)) 29 . #17#)) 46 -3 (1 -3 30 . #20=(6 -4 7 #18# 3 . #19#)) 29 . #20#) 0 43 0 2 vm-walker 8 2) 16 peephole! 10)\n"
+"(9 1 0 (9 2 0 (26 4 1 0 30 6 -2 3 (44 (1 5 2) 43 -2 45 member 2) 7 (1 0 31 31 6 -4 1 0 31 30 6 -3 1 -4 30 6 -5 44 0 1 -5 38 7 (44 2 1 -2 38 7 (11 . #1=(17)) 3 (3 (1 -4 31 0 43 -3 45 cons 2) 0 44 1 1 -2 38 7 (44 43 . #0=(43 0 45 replace-pair! 3)) 44 44 . #0#) 1 -4 31 . #1#) 44 4 1 -5 38 7 (44 2 1 -2 38 7 (3 (3 (1 -4 31 30 0 43 -3 45 list 2) 0 44 45 43 0 45 replace-pair! 3) 1 0 . #1#) 11 . #1#) 44 7 1 -5 38 7 (44 1 1 -2 38 7 (3 (3 (1 -4 31 0 43 -3 45 list* 2) 0 44 46 43 0 45 replace-pair! 3) 3 (1 -4 31 30 0 1 1 4 1) 1 -4 31 31 . #1#) 11 . #1#) 29 . #1#) 11 . #1#) 0 43 0 2 vm-walker 8 2) 16 combine-instructions! 10)\n"
+"(9 3 0 (26 9 3 (43 1 44 0 43 0 1 2 4 3) 3 (44 0 43 0 45 vector-get 2) 6 -2 44 :CONST 1 -2 38 7 (29 . #8=(6 -2 29 6 -3 1 -2 6 -4 . #0=(3 (43 -4 45 pair? 1) 7 (1 -4 30 6 -5 3 (43 -5 45 int? 1) 7 (44 0 43 -5 42 2 7 (3 (43 2 43 1 3 (43 -5 43 0 45 vector-get 2) 0 45 traverse-ast 3) . #2=(1 -4 31 0 19 2 1 . #0#)) 29 6 -6 3 (1 -5 34 0 43 0 45 vector-get 2) 6 -7 . #1=(3 (43 -7 45 pair? 1) 7 (1 -7 30 6 -8 3 (43 2 43 1 43 -8 45 traverse-ast 3) 1 -7 31 0 19 5 1 . #1#) 11 . #2#)) 11 . #2#) 11 3 (43 1 44 1 43 0 1 2 4 3) 29 6 -3 1 -2 6 -4 . #3=(3 (43 -4 45 pair? 1) 7 (1 -4 30 6 -5 3 (43 -5 45 int? 1) 7 (11 . #4=(1 -4 31 0 19 2 1 . #3#)) 3 (43 -5 45 int? 1) 7 (1 1 . #7=(6 -7 3 (43 -5 45 int? 1) 7 (1 -5 . #6=(6 -6 44 0 43 -6 42 2 7 (3 (43 2 43 -7 3 (43 -6 43 0 45 vector-get 2) 0 45 traverse-ast 3) . #4#) 29 6 -8 3 (1 -6 34 0 43 0 45 vector-get 2) 6 -9 . #5=(3 (43 -9 45 pair? 1) 7 (1 -9 30 6 -10 3 (43 2 43 -7 43 -10 45 traverse-ast 3) 1 -9 31 0 19 7 1 . #5#) 11 . #4#))) 1 -5 30 . #6#)) 3 (1 -5 31 0 43 0 45 vector-get 2) . #7#) 11 43 1 44 2 43 0 1 2 8 3)))) 44 :VOID 1 -2 38 7 (29 . #8#) 44 :REF 1 -2 38 7 (29 . #8#) 44 :SET! 1 -2 38 7 (5 (2) . #8#) 44 :DEF 1 -2 38 7 (5 (2) . #8#) 44 :IF 1 -2 38 7 (5 (1 2 3) . #8#) 44 :LAMBDA 1 -2 38 7 (5 ((-4 . 1)) . #8#) 44 :INVOKE 1 -2 38 7 (5 (-2 (-3 . 1)) . #8#) 44 :MACRO 1 -2 38 7 (5 ((-4 . 1)) . #8#) 44 :APPLY 1 -2 38 7 (5 (2 -3) . #8#) 44 :CONTI 1 -2 38 7 (5 (1) . #8#) 44 :CONTI-DIRECT 1 -2 38 7 (5 ((-2 . 1)) . #8#) 44 :VALS 1 -2 38 7 (5 (-1) . #8#) 44 :RECV 1 -2 38 7 (5 (3 (-4 . 1)) . #8#) 3 (43 0 44 \"Unknown [%@]\" 45 compile-error 2) . #8#) 16 traverse-ast 10)\n"
+"(9 1 0 (26 3 3 (43 0 45 list? 1) 7 (11 . #6=(3 (43 0 9 1 0 (44 (&rest &body) 43 0 2 member 8 2) 0 45 position-if 2) 6 -2 7 (3 (43 0 44 1 43 -2 32 2 0 45 drop 2) 6 -4 3 (43 0 43 -2 45 take 2) 6 -3 3 (43 -4 45 single? 1) 7 (11 . #4=(3 (43 -4 43 -3 45 append! 2) . #5=(6 -2 3 (43 0 9 1 0 (26 1 3 (43 0 45 symbol? 1) 6 -2 7 (29 . #0=(17)) 5 t . #0#) 0 45 some? 2) 6 -3 7 (3 (1 -3 30 0 44 \"parameter must be symbol, but `%@`\" 45 compile-error 2) . #3=(29 6 -3 1 -2 6 -4 7 . #1=((3 (1 -4 31 0 1 -4 30 0 45 member 2) 7 (3 (1 -4 30 0 44 \"Duplicated parameter `%@`\" 45 compile-error 2) . #2=(1 -4 31 0 19 2 1 46 -4 . #1#)) 11 . #2#) 11 1 -2 17))) 11 . #3#))) 3 (43 -4 44 \"&rest requires only 1 name, but %@\" 45 compile-error 2) . #4#) 1 0 . #5#)) 3 (43 0 44 \"parameters must be list, but %@\" 45 compile-error 2) . #6#) 16 check-parameters 10)\n"
+"(9 1 0 (3 (43 0 45 pair? 1) 7 (44 ^ 1 0 30 38 . #0=(17)) 29 . #0#) 16 lambda-expression? 10)\n"
+"(9 2 0 (26 3 1 0 30 6 -2 3 (43 -2 45 symbol? 1) 6 -3 7 (29 . #1=(6 -3 7 #0=(1 0 17) 3 (43 -2 43 1 45 alpha-conversion 2) 6 -4 7 #0# 43 0 2 macroexpand 8 1)) 5 t . #1#) 16 expand-macro 10)\n"
+"(9 3 0 (26 1 . #1=(3 (43 0 45 symbol? 1) 7 (3 (43 0 43 1 45 alpha-conversion 2) 6 -2 7 (3 (44 1 43 -2 43 1 45 add-var-info 3) 1 -2 . #0=(6 -2 43 1 43 -2 2 traverse-refer 8 2)) 1 0 . #0#) 3 (43 0 45 pair? 1) 7 (3 (43 1 43 0 45 expand-macro 2) 6 -2 3 (43 -2 45 pair? 1) 7 (43 2 43 1 43 -2 2 traverse-list 8 3) 43 2 43 1 43 -2 19 0 3 . #1#) 43 0 44 :CONST 2 vector 8 2)) 16 traverse 10)\n"
+"(9 3 0 (26 3 1 0 30 6 -2 44 quote 1 -2 38 7 (1 0 31 0 9 1 0 (43 0 44 :CONST 2 vector 8 2) 0 2 apply 8 2) 44 ^ 1 -2 38 7 (1 0 31 0 43 1 9 (1 -1) 1 (12 0 0 43 1 43 0 2 traverse-lambda 8 3) 0 2 apply 8 2) 44 if 1 -2 38 7 (1 0 31 0 43 1 43 2 9 (2 -1) 2 (12 0 0 12 1 0 43 2 43 1 43 0 2 traverse-if 8 5) 0 2 apply 8 2) 44 set! 1 -2 38 7 (1 0 31 0 43 1 9 2 1 (12 0 0 43 1 43 0 44 :SET! 2 traverse-set! 8 4) 0 2 apply 8 2) 44 def 1 -2 38 7 (1 0 31 0 43 1 9 2 1 (3 (43 0 45 inline-function-name? 1) 7 (3 (12 0 0 43 1 43 0 45 register-inline-function 3) . #0=(12 0 0 43 1 43 0 44 :DEF 2 traverse-set! 8 4)) 11 . #0#) 0 2 apply 8 2) 44 call/cc 1 -2 38 7 (1 0 31 0 43 1 43 2 9 1 2 (12 0 0 12 1 0 43 0 2 traverse-call/cc 8 3) 0 2 apply 8 2) 44 defmacro 1 -2 38 7 (1 0 31 0 43 1 9 (2 -1) 1 (12 0 0 43 2 43 1 43 0 2 traverse-defmacro 8 4) 0 2 apply 8 2) 44 values 1 -2 38 7 (1 0 31 0 43 1 43 2 9 (0 -1) 2 (12 0 0 12 1 0 43 0 2 traverse-values 8 3) 0 2 apply 8 2) 44 receive 1 -2 38 7 (1 0 31 0 43 1 43 2 9 (2 -1) 2 (12 0 0 12 1 0 43 2 43 1 43 0 2 traverse-receive 8 5) 0 2 apply 8 2) 1 0 31 6 -4 1 0 30 6 -3 3 (43 -3 45 lambda-expression? 1) 7 (43 2 43 1 43 1 43 -4 1 -3 31 31 0 1 -3 31 30 0 2 traverse-apply-direct 8 6) 3 (43 -3 45 inline-function-name? 1) 7 (43 2 43 1 43 -4 43 -3 2 traverse-inline-apply 8 4) 43 2 43 1 43 -4 43 -3 2 traverse-apply 8 4) 16 traverse-list 10)\n"
+"(9 2 0 (26 1 3 (43 0 43 1 45 scope-local-has? 2) 6 -2 7 (11 . #0=(3 (43 0 43 1 45 register-ref 2) 43 0 44 :REF 2 vector 8 2)) 3 (43 0 43 1 45 scope-upper-vars-has? 2) 7 (3 (43 0 43 1 45 register-fref 2) . #0#) 11 . #0#) 16 traverse-refer 10)\n"
+"(9 4 0 (26 6 3 (43 1 45 symbol? 1) 7 (11 . #6=(3 (43 1 43 3 45 alpha-conversion 2) 6 -2 7 (1 -2 . #5=(6 -2 3 (43 -2 43 3 45 scope-upper-vars-has? 2) 6 -4 3 (43 -2 43 3 45 scope-local-has? 2) 6 -3 7 (11 . #4=(3 (43 2 45 lambda-expression? 1) 7 (1 2 31 31 6 -6 1 2 31 30 6 -5 3 (43 3 43 -6 43 -5 45 prepare-lambda-node 3) 6 -7 3 (43 -2 3 (43 -7 45 lambda-scope-get 1) 0 45 scope-func-name-set! 2) 44 :DEF 1 0 38 7 (3 (43 -7 43 -2 43 3 45 do-register-set! 3) . #0=(3 (43 -6 43 -7 45 traverse-lambda-exec 2) 43 -7 43 -2 43 0 2 vector 8 3)) 46 -3 (46 -3 . #1=((3 (43 -7 43 -2 43 3 45 register-set! 3) . #0#) 29 . #0#)) 46 -4 (46 -4 . #1#) 29 . #0#) 3 (29 0 43 3 43 2 45 traverse 3) 6 -5 44 :SET! 1 0 38 7 (46 -3 (46 -3 . #3=((3 (43 -5 43 -2 43 3 45 register-set! 3) . #2=(43 -5 43 -2 43 0 2 vector 8 3)) 11 . #2#)) 46 -4 (46 -4 . #3#) 11 . #2#) 11 . #2#)) 46 -4 (3 (43 -2 43 3 45 register-fref 2) . #4#) 11 . #4#)) 1 1 . #5#)) 3 (43 1 3 (44 4 44 1 3 (43 0 45 string 1) 0 45 substr 3) 0 44 \"`%s` requires symbol, but `%@`\" 45 compile-error 3) . #6#) 16 traverse-set! 10)\n"
+"(9 5 0 (46 2 (1 2 31 7 (3 (44 \"malformed if\" 45 compile-error 1) . #1=(46 2 (3 (43 4 43 3 1 2 30 0 45 traverse 3) 0 . #0=(3 (43 4 43 3 43 1 45 traverse 3) 0 3 (29 0 43 3 43 0 45 traverse 3) 0 44 :IF 2 vector 8 4)) 44 #(:VOID) . #0#)) 11 . #1#) 11 . #1#) 16 traverse-if 10)\n"
+"(9 3 0 (26 5 3 (29 0 44 64 43 1 45 register-call 3) 3 (43 0 45 lambda-expression? 1) 7 (1 0 31 31 6 -3 1 0 31 30 6 -2 0 3 (43 -2 45 check-parameters 1) 38 7 (11 . #1=(44 1 3 (43 -2 45 length 1) 38 7 (11 . #0=(3 (43 1 43 -2 45 expand-scope 2) 6 -4 3 (43 2 43 -4 43 -3 45 traverse-body 3) 6 -5 3 (1 -2 30 0 43 -4 45 alpha-conversion 2) 6 -6 3 (44 128 43 -6 43 -4 45 add-var-info 3) 43 -5 43 -4 44 :CONTI-DIRECT 2 vector 8 3)) 3 (43 -2 44 \"Illegal parameters, call/cc requires 1 parameter function, but `%@`\" 45 compile-error 2) . #0#)) 3 (44 \"Not implemented: rest param for call/cc\" 45 compile-error 1) . #1#) 3 (43 2 43 1 43 0 45 traverse 3) 0 44 :CONTI 2 vector 8 2) 16 traverse-call/cc 10)\n"
+"(9 2 0 (26 2 3 (43 0 45 lambda-body-node-get 1) 6 -3 3 (43 0 45 lambda-scope-get 1) 6 -2 46 1 (3 (3 (44 t 43 -2 43 1 45 traverse-body 3) 0 43 -3 45 copy-pair! 2) . #0=(1 0 17)) 11 . #0#) 16 traverse-lambda-exec 10)\n"
+"(9 3 0 (43 1 3 (43 2 43 1 43 0 45 prepare-lambda-node 3) 0 2 traverse-lambda-exec 8 2) 16 traverse-lambda 10)\n"
+"(9 3 0 (43 0 43 1 43 2 9 1 2 (26 1 1 0 31 6 -2 7 (29 . #0=(0 12 1 0 1 0 30 0 2 traverse 8 3)) 12 0 . #0#) 0 2 maplist 8 2) 16 traverse-body 10)\n"
+"(9 3 0 (26 3 3 (43 0 43 1 45 var-is-set? 2) 6 -2 7 (3 (43 -2 45 single? 1) 7 (3 (1 -2 30 0 45 lambda-node? 1) 7 (3 (43 0 43 1 45 scope-local-has? 2) 7 (3 (44 16 43 0 43 1 45 var-has-attr? 3) 7 (5 32 . #0=(17)) 5 16 . #0#) 46 2 (3 (43 0 43 1 45 get-var-info 2) 28 -3 2 46 -4 (3 (43 -4 43 1 45 upper-scope-is? 2) . #1=(7 (5 8 . #0#) 5 64 . #0#)) 3 (43 1 45 scope-block-top-get 1) 0 3 (1 -2 30 0 45 lambda-scope-get 1) 38 . #1#) 5 64 . #0#) 5 . #2=(64 . #0#)) 5 . #2#) 5 . #2#) 16 detect-call-type 10)\n"
+"(9 4 0 (26 4 3 (43 0 45 symbol? 1) 7 (3 (43 0 43 2 45 alpha-conversion 2) . #4=(6 -2 7 (1 -2 . #3=(6 -2 3 (43 3 43 2 43 -2 45 detect-call-type 3) 6 -3 3 (43 0 45 symbol? 1) 7 (3 (43 -3 43 -2 43 2 45 add-var-info 3) 3 (43 2 43 -2 45 traverse-refer 2) . #2=(6 -4 3 (43 1 43 2 9 1 1 (29 0 12 0 0 43 0 2 traverse 8 3) 0 45 map 2) 6 -5 3 (43 -2 45 symbol? 1) 7 (3 (43 -2 45 compiler-embed-func? 1) 7 (11 . #0=(43 -5 43 -4 43 -3 44 :APPLY 2 vector 8 4)) 3 . #1=((43 -2 43 -3 43 2 45 register-call 3) . #0#)) 3 . #1#)) 3 (29 0 43 2 43 0 45 traverse 3) . #2#)) 1 0 . #3#)) 29 . #4#) 16 traverse-apply 10)\n"
+"(9 4 0 (26 2 3 (43 0 45 get-inline-function-scope 1) 6 -3 3 (43 0 45 get-inline-function-body 1) 6 -2 43 3 43 -3 43 2 43 1 1 -2 31 31 0 1 -2 31 30 0 2 traverse-apply-direct 8 6) 16 traverse-inline-apply 10)\n"
+"(9 6 0 (26 7 . #2=(3 (43 0 45 check-parameters 1) 6 -2 43 0 1 -2 38 7 (44 0 . #3=(3 (43 -2 45 length 1) 0 33 2 6 -4 3 (43 2 45 length 1) 6 -3 43 -2 1 0 38 6 -5 7 (43 -4 1 -3 38 7 (3 (43 2 43 3 9 1 1 (29 0 12 0 0 43 0 2 traverse 8 3) 0 45 map 2) 6 -5 3 (43 3 43 -2 45 expand-scope 2) 6 -6 43 4 1 3 38 7 (1 -6 . #0=(6 -7 3 (43 5 43 -7 43 1 45 traverse-body 3) 6 -8 0 43 -5 43 -6 44 :INVOKE 2 vector 8 4)) 3 (43 4 3 (43 -6 45 scope-sets 1) 0 3 (43 -6 45 scope-local-infos 1) 0 45 expand-scope2 3) 6 -7 3 (43 3 43 -7 45 scope-caller-set! 2) 1 -7 . #0#) 43 -4 43 -3 39 2 7 (5 \"few\" . #1=(6 -5 43 -4 43 -3 43 -5 44 \"Too %s arguments, %@ for %@\" 2 compile-error 8 4)) 5 \"many\" . #1#) 43 -4 43 -3 39 2 7 (43 5 43 4 43 3 43 2 43 1 43 -2 19 0 6 . #2#) 43 -4 43 -3 41 2 7 (3 (3 (3 (3 (43 2 43 -4 45 drop 2) 0 44 list 45 list* 2) 0 45 list 1) 0 3 (43 2 43 -4 45 take 2) 0 45 append! 2) 6 -5 43 5 43 4 43 3 43 -5 43 1 43 -2 19 0 6 . #2#) 43 5 43 4 43 3 3 (44 (nil) 43 2 45 append 2) 0 43 1 43 -2 19 0 6 . #2#)) 44 1 . #3#)) 16 traverse-apply-direct 10)\n"
+"(9 4 0 (26 4 3 (43 1 45 check-parameters 1) 6 -2 3 (43 3 43 -2 45 create-scope 2) 6 -3 3 (44 t 43 -3 43 2 45 traverse-body 3) 6 -4 43 -2 1 1 38 7 (3 (43 1 45 length 1) . #0=(6 -5 43 -4 43 -5 43 0 43 -3 44 :MACRO 2 vector 8 5)) 3 (44 -1 44 1 3 (43 -2 45 length 1) 0 33 2 0 45 list 2) . #0#) 16 traverse-defmacro 10)\n"
+"(9 3 0 (3 (43 0 43 1 43 2 43 0 9 1 3 (12 0 31 7 (12 1 . #0=(0 12 2 0 1 0 30 0 2 traverse 8 3)) 29 . #0#) 0 45 maplist 2) 0 44 :VALS 2 vector 8 2) 16 traverse-values 10)\n"
+"(9 5 0 (26 5 3 (43 0 45 check-parameters 1) 6 -2 3 (29 0 43 3 43 1 45 traverse 3) 6 -4 43 -2 1 0 38 7 (3 (43 0 45 length 1) . #0=(6 -3 3 (43 3 43 -2 45 expand-scope 2) 6 -5 3 (43 4 43 -5 43 2 45 traverse-body 3) 6 -6 0 43 -4 43 -3 43 -5 44 :RECV 2 vector 8 5)) 3 (44 -1 44 1 3 (43 -2 45 length 1) 0 33 2 0 45 list 2) . #0#) 16 traverse-receive 10)\n"
+"(9 3 0 (26 5 . #0=(3 (44 0 43 0 45 vector-get 2) 6 -2 44 :CONST 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 -3 44 5 2 list* 8 3) 44 :VOID 1 -2 38 7 (43 2 44 11 2 list* 8 2) 44 :REF 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 2 compile-ref 8 3) 44 :SET! 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -4 43 -3 2 compile-set! 8 4) 44 :DEF 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 2 43 -3 44 16 45 list* 3) 0 43 1 43 -4 19 0 3 . #0#) 44 :IF 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (3 (43 2 43 1 43 -5 45 compile-recur 3) 0 3 (43 2 43 1 43 -4 45 compile-recur 3) 0 44 7 45 list* 3) 0 43 1 43 -3 19 0 3 . #0#) 44 :LAMBDA 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -6 3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -6 43 -5 43 -4 43 -3 2 compile-lambda 8 6) 44 :INVOKE 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -5 43 -4 43 -3 2 compile-invoke 8 5) 44 :MACRO 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -6 3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -6 43 -5 43 -4 43 -3 2 compile-macro 8 6) 44 :APPLY 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 43 -5 43 -4 2 compile-apply 8 5) 44 :CONTI 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 2 compile-conti 8 3) 44 :CONTI-DIRECT 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -4 43 -3 2 compile-conti-direct 8 4) 44 :VALS 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 2 compile-vals 8 3) 44 :RECV 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -6 3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -6 43 -5 43 -4 43 -3 2 compile-recv 8 6) 43 0 44 \"Unknown [%@]\" 2 compile-error 8 2)) 16 compile-recur 10)\n"
+"(9 2 0 (26 4 3 (43 1 43 0 45 get-var-info 2) 28 -2 2 46 -2 (3 (43 -2 45 var-info-flag-get 1) 6 -4 3 (44 97 43 -4 45 bit? 2) 6 -5 7 (29 . #0=(17)) 44 16 43 -4 2 bit? 8 2) 29 . #0#) 16 can-eliminate-lambda-node? 10)\n"
+"(9 2 0 (26 4 . #0=(3 (44 0 43 0 45 vector-get 2) 6 -2 44 :LAMBDA 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 1 43 -3 2 scope-outer-scope-set! 8 2) 44 :INVOKE 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -4 45 replace-body-scope! 2) 43 1 43 -3 2 scope-outer-scope-set! 8 2) 44 :RECV 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -4 45 replace-outer-scope! 2) 43 1 43 -3 2 scope-outer-scope-set! 8 2) 44 :SET! 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 1 43 -3 19 0 2 . #0#) 44 :DEF 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 1 43 -3 19 0 2 . #0#) 44 :IF 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -3 45 replace-outer-scope! 2) 3 (43 1 43 -4 45 replace-outer-scope! 2) 43 1 43 -5 19 0 2 . #0#) 44 :APPLY 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -4 3 (44 2 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -3 45 replace-outer-scope! 2) 43 1 43 -4 2 replace-body-scope! 8 2) 44 :CONTI 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 1 43 -3 19 0 2 . #0#) 44 :CONTI-DIRECT 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 1 43 -3 2 replace-body-scope! 8 2) 44 :VALS 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 1 43 -3 2 replace-body-scope! 8 2) 29 17)) 16 replace-outer-scope! 10)\n"
+"(9 2 0 (3 (43 1 43 0 45 lambda-scope-set! 2) 43 1 3 (43 0 45 lambda-body-node-get 1) 0 2 replace-body-scope! 8 2) 16 replace-lambda-scope! 10)\n"
+"(9 2 0 (26 3 29 6 -2 1 0 6 -3 . #0=(3 (43 -3 45 pair? 1) 7 (1 -3 30 6 -4 3 (43 1 43 -4 45 replace-outer-scope! 2) 1 -3 31 0 19 1 1 . #0#) 11 17)) 16 replace-body-scope! 10)\n"
+"(9 4 0 (3 (43 3 3 (43 1 45 length 1) 0 43 0 45 list* 3) 0 43 2 43 1 2 compile-args 8 3) 16 compile-embed-op 10)\n"
+"(9 4 0 (3 (3 (43 3 43 0 45 list* 2) 0 43 2 1 1 30 0 45 compile-recur 3) 0 43 2 1 1 31 0 2 compile-args 8 3) 16 compile-embed-op-1 10)\n"
+"(3 (45 table 0) 16 *compiler-embed-funcs* 10)\n"
+"(9 2 0 (43 1 43 0 2 *compiler-embed-funcs* 0 2 table-put! 8 3) 16 register-embed-func 10)\n"
+"(9 1 0 (43 0 2 *compiler-embed-funcs* 0 2 table-get 8 2) 16 compiler-embed-func? 10)\n"
+"(9 5 0 (26 5 3 (43 3 43 0 45 apply-func-can-be-loop? 2) 6 -2 7 (3 (44 16 43 2 45 bit? 2) 7 (3 (3 (43 0 45 refer-node-name 1) 0 43 3 45 can-eliminate-lambda-node? 2) 7 (43 4 43 3 43 1 43 0 43 -2 2 compile-apply-loop 8 5) 46 -2 . #2=((3 (44 8 43 2 45 bit? 2) 7 (43 3 43 1 43 0 43 -2 2 compile-apply-self-recur 8 4) 3 . #1=((43 0 45 refer-node? 1) 7 (3 (3 (43 0 45 refer-node-name 1) 0 43 3 45 get-var-info 2) 28 -3 2 46 -3 (3 (43 -3 45 var-info-flag-get 1) 6 -5 3 (44 128 43 -5 45 bit? 2) 7 (3 (44 5 43 -5 45 bit? 2) 6 -6 7 (29 . #0=(6 -3 7 (43 3 43 1 43 0 2 compile-apply-conti 8 3) 43 4 43 3 43 2 43 1 43 0 2 compile-apply2 8 5)) 5 t . #0#) 29 . #0#) 29 . #0#) 29 . #0#)) 3 . #1#)) 46 -2 . #2#) 46 -2 . #2#) 16 compile-apply 10)\n"
+"(9 5 0 (26 1 3 (43 0 45 refer-node? 1) 7 (3 (3 (43 0 45 refer-node-name 1) 0 45 compiler-embed-func? 1) . #0=(6 -2 7 (43 4 43 3 43 1 1 -2 8 3) 43 4 43 3 43 1 43 0 2 compile-apply-normal 8 4)) 29 . #0#) 16 compile-apply2 10)\n"
+"(9 3 0 (26 2 3 (43 1 45 length 1) 6 -2 44 1 43 -2 41 2 7 (3 (3 (3 (43 0 45 refer-node-name 1) 0 43 2 45 get-var-orig-name 2) 0 44 \"Too many argument for continuation `%@`\" 45 compile-error 2) . #0=(3 (3 (44 24 45 list 1) 0 43 2 43 0 45 compile-recur 3) 6 -3 44 0 1 -2 38 7 (43 -3 44 0 44 29 2 list* 8 3) 43 -3 43 2 43 1 2 compile-args 8 3)) 11 . #0#) 16 compile-apply-conti 10)\n"
+"(9 4 0 (26 3 3 (43 1 45 length 1) 6 -3 44 17 1 3 30 38 6 -2 3 (3 (46 -2 (3 (43 -3 44 8 45 list 2) . #0=(0 43 2 43 0 45 compile-recur 3)) 3 (43 -3 44 4 45 list 2) . #0#) 0 43 2 43 1 45 compile-args 3) 6 -4 46 -2 (1 -4 17) 43 3 43 -4 44 3 2 list* 8 3) 16 compile-apply-normal 10)\n"
+"(9 5 0 (26 6 3 (43 0 45 lambda-scope-get 1) 6 -2 3 (43 -2 45 scope-local-infos 1) 6 -3 3 (43 2 45 length 1) 6 -7 3 (43 0 45 lambda-body-slot-get 1) 6 -6 3 (43 0 45 lambda-varnum-get 1) 6 -5 3 (43 3 3 (43 -2 45 scope-sets 1) 0 43 -3 45 expand-scope2 3) 6 -4 3 (43 -5 45 pair? 1) 7 (3 (44 \"Not implemented: rest param for loop\" 45 compile-error 1) . #1=(43 -5 1 -7 38 7 (11 . #0=(3 (43 -4 43 0 45 replace-lambda-scope! 2) 3 (3 (43 4 43 -4 3 (43 0 45 lambda-body-node-get 1) 0 43 -3 45 compile-body 4) 0 43 -6 45 copy-pair! 2) 3 (43 -4 45 calc-scope-work-size 1) 43 -6 43 -4 43 3 43 2 2 compile-args-for-local 8 4)) 3 (43 -7 43 -5 3 (3 (43 1 45 refer-node-name 1) 0 43 3 45 get-var-orig-name 2) 0 44 \"Illegal argnum, `%@` requires %@, but %@\" 45 compile-error 4) . #0#)) 11 . #1#) 16 compile-apply-loop 10)\n"
+"(9 4 0 (26 3 3 (3 (43 1 45 refer-node-name 1) 0 43 3 45 can-eliminate-lambda-node? 2) 7 (3 (3 (43 0 45 lambda-scope-get 1) 0 45 scope-upper-work-size 1) . #2=(6 -4 3 (43 0 45 lambda-varnum-get 1) 6 -3 3 (43 2 45 length 1) 6 -2 3 (43 -3 45 pair? 1) 7 (3 (44 \"Not implemented: rest param for loop\" 45 compile-error 1) . #1=(43 -3 1 -2 38 7 (11 . #0=(3 (3 (43 0 45 lambda-body-slot-get 1) 0 43 -2 43 -4 44 19 45 list* 4) 0 43 3 43 2 2 compile-args 8 3)) 3 (43 -2 43 -3 3 (3 (43 1 45 refer-node-name 1) 0 43 3 45 get-var-orig-name 2) 0 44 \"Illegal argnum, `%@` requires %@, but %@\" 45 compile-error 4) . #0#)) 11 . #1#)) 5 0 . #2#) 16 compile-apply-self-recur 10)\n"
+"(9 6 0 (26 2 3 (43 0 45 scope-frees 1) 6 -2 3 (3 (3 (44 17 45 list 1) 0 43 0 43 3 3 (43 0 45 scope-local-infos 1) 0 45 compile-body 4) 0 43 1 45 copy-pair! 2) 3 (43 0 45 scope-work-size 1) 6 -3 3 (43 5 44 0 1 -3 38 7 (43 1 . #0=(3 (43 -2 45 length 1) 0 43 2 44 9 45 list* 5)) 3 (43 1 43 -3 44 26 45 list* 3) 0 . #0#) 0 43 4 43 -2 2 collect-free 8 3) 16 compile-lambda 10)\n"
+"(9 5 0 (3 (43 0 45 calc-scope-work-size 1) 3 (43 4 43 0 43 2 3 (43 0 45 scope-local-infos 1) 0 45 compile-body 4) 0 43 0 43 3 43 1 2 compile-args-for-local 8 4) 16 compile-invoke 10)\n"
+"(9 2 0 (26 5 29 6 -2 29 6 -6 29 6 -5 1 1 6 -4 1 0 6 -3 7 . #0=((44 0 3 (1 -3 30 0 45 var-info-flag-get 1) 38 7 (43 -6 43 -5 1 -4 31 0 1 -3 31 0 19 1 4 . #1=(46 -3 . #0#)) 3 (43 -6 1 -4 30 0 45 cons 2) 0 3 (43 -5 1 -3 30 0 45 cons 2) 0 1 -4 31 0 1 -3 31 0 19 1 4 . #1#) 3 (43 -6 45 reverse! 1) 0 3 (43 -5 45 reverse! 1) 0 27 2 17)) 16 remove-unused-params-args 10)\n"
+"(9 5 0 (26 9 29 6 -2 1 1 6 -4 1 0 6 -3 7 . #0=((1 -3 30 6 -6 3 (1 -4 30 0 45 var-info-name-get 1) 6 -5 3 (43 -5 43 3 45 var-is-set? 2) 7 (11 . #1=(1 -4 31 0 1 -3 31 0 19 1 2 46 -3 . #0#)) 3 (43 -6 45 const-node? 1) 6 -7 7 #2=(3 (43 -6 43 -5 43 4 45 replace-var-ref-body! 3) 3 (44 0 1 -4 30 0 45 var-info-flag-set! 2) . #1#) 3 (43 -6 45 refer-node? 1) 7 (3 (43 -6 45 refer-node-name 1) 6 -8 3 (43 -8 43 2 45 scope-local-has? 2) 6 -9 7 #4=(3 (43 -8 43 2 45 var-is-set? 2) 6 -9 7 (29 . #3=(6 -8 7 #2# 11 . #1#)) 5 t . #3#) 3 (43 -8 43 2 45 scope-upper-vars-has? 2) 6 -10 7 #4# 29 . #3#) 29 . #3#) 11 17)) 16 propagate-constant 10)\n"
+"(9 3 0 (26 3 29 6 -2 1 0 6 -3 . #0=(3 (43 -3 45 pair? 1) 7 (1 -3 30 6 -4 3 (43 2 43 1 43 -4 45 replace-var-ref! 3) 1 -3 31 0 19 1 1 . #0#) 11 17)) 16 replace-var-ref-body! 10)\n"
+"(9 3 0 (26 4 . #0=(3 (44 0 43 0 45 vector-get 2) 6 -2 44 :REF 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 1 1 -3 38 7 (43 2 43 0 2 copy-vector! 8 2) 11 . #1=(17)) 44 :LAMBDA 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -3 45 scope-frees-remove! 2) 43 2 43 1 43 -4 2 replace-var-ref-body! 8 3) 44 :MACRO 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 1 43 -3 45 scope-frees-remove! 2) 43 2 43 1 43 -4 2 replace-var-ref-body! 8 3) 44 :INVOKE 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -4 3 (44 2 43 0 45 vector-get 2) 6 -3 3 (43 2 43 1 43 -3 45 replace-var-ref-body! 3) 43 2 43 1 43 -4 2 replace-var-ref-body! 8 3) 44 :RECV 1 -2 38 7 (3 (44 4 43 0 45 vector-get 2) 6 -4 3 (44 3 43 0 45 vector-get 2) 6 -3 3 (43 2 43 1 43 -3 45 replace-var-ref! 3) 43 2 43 1 43 -4 2 replace-var-ref-body! 8 3) 44 :SET! 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 19 0 3 . #0#) 44 :DEF 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 19 0 3 . #0#) 44 :IF 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -5 3 (44 2 43 0 45 vector-get 2) 6 -4 3 (44 1 43 0 45 vector-get 2) 6 -3 3 (43 2 43 1 43 -3 45 replace-var-ref! 3) 3 (43 2 43 1 43 -4 45 replace-var-ref! 3) 43 2 43 1 43 -5 19 0 3 . #0#) 44 :APPLY 1 -2 38 7 (3 (44 3 43 0 45 vector-get 2) 6 -4 3 (44 2 43 0 45 vector-get 2) 6 -3 3 (43 2 43 1 43 -3 45 replace-var-ref! 3) 43 2 43 1 43 -4 2 replace-var-ref-body! 8 3) 44 :CONTI 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 19 0 3 . #0#) 44 :CONTI-DIRECT 1 -2 38 7 (3 (44 2 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 2 replace-var-ref-body! 8 3) 44 :VALS 1 -2 38 7 (3 (44 1 43 0 45 vector-get 2) 6 -3 43 2 43 1 43 -3 2 replace-var-ref-body! 8 3) 29 . #1#)) 16 replace-var-ref! 10)\n"
+"(9 3 0 (26 3 3 (43 0 43 1 45 scope-local-has? 2) 6 -2 7 (43 -2 44 1 27 2 . #1=(28 -2 2 44 2 1 -2 38 6 -4 7 (43 2 . #0=(43 -3 43 -2 2 list* 8 3)) 3 (43 0 43 1 45 var-needs-box? 2) 7 (3 (43 2 44 21 45 list* 2) 0 . #0#) 43 2 . #0#)) 3 (43 0 43 1 45 scope-frees-has? 2) 6 -3 7 (43 -3 44 12 27 2 . #1#) 43 0 44 2 27 2 . #1#) 16 compile-ref 10)\n"
+"(9 4 0 (26 2 3 (43 1 45 lambda-node? 1) 7 (3 (43 0 43 2 45 can-eliminate-lambda-node? 2) 7 (1 3 17) 3 . #2=((43 0 43 2 45 scope-local-has? 2) 6 -2 7 (43 -2 3 (43 0 43 2 45 var-needs-box? 2) 7 (44 13 . #0=(27 2 . #1=(28 -2 2 3 (43 3 43 -3 43 -2 45 list* 3) 0 43 2 43 1 2 compile-recur 8 3))) 44 6 . #0#) 3 (43 0 43 2 45 scope-frees-has? 2) 6 -3 7 (43 -3 44 14 27 2 . #1#) 43 0 44 15 27 2 . #1#)) 3 . #2#) 16 compile-set! 10)\n"
+"(9 3 0 (26 2 44 17 1 2 30 38 6 -2 3 (3 (46 -2 (3 (44 1 44 8 45 list 2) . #0=(0 43 1 43 0 45 compile-recur 3)) 3 (44 1 44 4 45 list 2) . #0#) 0 44 0 43 -2 44 22 45 list* 4) 6 -3 46 -2 (1 -3 17) 43 2 43 -3 44 3 2 list* 8 3) 16 compile-conti 10)\n"
+"(9 4 0 (26 7 3 (43 0 45 scope-local-infos 1) 6 -2 3 (1 -2 30 0 45 var-info-flag-get 1) 6 -4 44 17 1 3 30 38 6 -3 3 (44 5 43 -4 45 bit? 2) 7 (3 (43 0 45 calc-scope-work-size 1) 3 (3 (46 -3 (43 3 . #0=(43 0 43 1 43 -2 45 compile-body 4)) 3 (44 18 45 list 1) 0 . #0#) 0 3 (43 0 45 get-scope-local-offset 1) 0 44 6 43 -3 44 22 45 list* 5) 6 -5 46 -3 (1 -5 17) 43 3 43 -5 44 3 2 list* 8 3) 3 (44 88 43 -4 45 bit? 2) 7 (3 (45 gensym 0) 6 -5 3 (43 -5 44 1 43 -5 45 var-info 3) 6 -6 3 (3 (43 -6 43 -6 43 -6 45 list 3) 0 3 (43 0 45 scope-local-infos 1) 0 45 append 2) 6 -7 3 (43 2 3 (43 0 45 scope-sets 1) 0 43 -7 45 expand-scope2 3) 6 -8 3 (43 -8 43 1 45 replace-body-scope! 2) 3 (43 -8 45 calc-scope-work-size 1) 43 3 3 (43 3 43 -8 43 1 43 -2 45 compile-body 4) 0 3 (43 -8 45 scope-upper-work-size 1) 0 44 23 2 list* 8 4) 3 (43 2 43 1 45 replace-body-scope! 2) 43 3 43 2 43 1 43 -2 2 compile-body 8 4) 16 compile-conti-direct 10)\n"
+"(9 3 0 (26 1 3 (43 0 45 length 1) 6 -2 44 0 1 -2 38 7 (43 2 44 11 2 list* 8 2) 3 (43 2 43 -2 44 27 45 list* 3) 0 43 1 43 0 2 compile-args 8 3) 16 compile-vals 10)\n"
+"(9 6 0 (3 (43 0 45 calc-scope-work-size 1) 3 (3 (43 5 43 0 43 3 3 (43 0 45 scope-local-infos 1) 0 45 compile-body 4) 0 43 1 3 (43 0 45 get-scope-local-offset 1) 0 44 28 45 list* 4) 0 43 4 43 2 2 compile-recur 8 3) 16 compile-recv 10)\n"
+"(9 6 0 (26 3 3 (3 (44 17 45 list 1) 0 43 0 43 3 3 (43 0 45 scope-local-infos 1) 0 45 compile-body 4) 6 -3 3 (43 0 45 scope-frees 1) 6 -2 3 (43 0 45 scope-work-size 1) 6 -4 3 (43 5 44 0 1 -4 38 7 (43 -3 . #0=(3 (43 -2 45 length 1) 0 43 2 43 1 44 25 45 list* 6)) 3 (43 -3 43 -4 44 26 45 list* 3) 0 . #0#) 0 43 4 43 -2 2 collect-free 8 3) 16 compile-macro 10)\n"
+"(9 4 0 (26 1 46 1 (29 6 -2 20 -2 43 3 43 2 43 -2 9 1 3 (46 0 (3 (1 0 31 0 12 0 21 4 1) 0 12 1 0 1 0 30 0 2 compile-recur 8 3) 12 2 17) 13 -2 3 (43 1 1 -2 21 4 1) 0 43 0 43 2 2 make-boxes 8 3) 43 3 44 11 2 list* 8 2) 16 compile-body 10)\n"
+"(9 3 0 (26 1 29 6 -2 20 -2 43 2 43 -2 43 0 9 1 3 (26 3 . #0=(46 0 (1 0 31 6 -3 3 (1 0 30 0 45 var-info-name-get 1) 6 -2 3 (43 -2 12 0 0 45 var-needs-box? 2) 7 (3 (12 0 0 43 -2 45 symbol-can-be-loop? 2) 7 (3 (43 -2 12 0 0 45 can-eliminate-lambda-node? 2) . #1=(6 -4 7 (43 -3 . #2=(19 0 1 . #0#)) 3 (43 -3 12 1 21 4 1) 0 3 (43 -2 12 0 0 45 scope-local-has? 2) 0 44 20 2 list* 8 3)) 29 . #1#) 43 -3 . #2#) 12 2 17)) 13 -2 43 1 1 -2 21 8 1) 16 make-boxes 10)\n"
+"(9 3 0 #0=(46 0 (3 (3 (43 2 44 0 45 list* 2) 0 43 1 1 0 30 0 45 compile-recur 3) 0 43 1 1 0 31 0 19 0 3 . #0#) 1 2 17) 16 compile-args 10)\n"
+"(9 4 0 (26 4 29 6 -2 1 3 6 -5 3 (43 2 45 get-scope-local-offset 1) 6 -4 1 0 6 -3 7 . #0=((3 (3 (43 -5 43 -4 44 6 45 list* 3) 0 43 1 1 -3 30 0 45 compile-recur 3) 0 44 1 43 -4 33 2 0 1 -3 31 0 19 1 3 46 -3 . #0#) 1 -5 17)) 16 compile-args-for-local 10)\n"
+"(9 3 0 (26 3 . #0=(46 0 (1 0 30 6 -2 3 (43 -2 43 1 45 scope-local-has? 2) 6 -3 7 (3 (43 2 44 0 43 -3 44 1 45 list* 4) . #1=(0 43 1 1 0 31 0 19 0 3 . #0#)) 3 (43 -2 43 1 45 scope-frees-has? 2) 6 -4 7 (3 (43 2 44 0 43 -4 44 12 45 list* 4) . #1#) 3 (43 1 43 -2 44 \"something wrong in collect-free [%@](%@)\" 45 compile-error 3) . #1#) 1 2 17)) 16 collect-free 10)\n"
+"(9 2 0 (3 (43 0 45 refer-node? 1) 7 (43 1 3 (43 0 45 refer-node-name 1) 0 2 symbol-can-be-loop? 8 2) 29 17) 16 apply-func-can-be-loop? 10)\n"
+"(9 2 0 (26 2 3 (43 0 43 1 45 var-is-set? 2) 6 -2 7 (3 (43 -2 45 single? 1) 7 (1 -2 30 6 -3 3 (43 -3 45 lambda-node? 1) 7 (1 -3 . #0=(17)) 29 . #0#) 29 . #0#) 11 . #0#) 16 symbol-can-be-loop? 10)\n"
+"(25 declaim (0 -1) 0 (3 (43 0 9 1 0 (26 4 3 (43 0 45 pair? 1) 7 (1 0 30 6 -2 44 inline 1 -2 38 7 (29 6 -3 1 0 31 6 -4 . #0=(3 (43 -4 45 pair? 1) 7 (1 -4 30 6 -5 3 (43 -5 45 declaim-inline 1) 1 -4 31 0 19 2 1 . #0#) 11 5 (values) . #1=(17))) 29 . #1#) 11 . #1#) 0 45 map 2) 0 44 do 2 list* 8 2) 10)\n"
+"(5 0 0 26 1 3 (45 table 0) 6 -2 0 9 1 1 (44 t 43 0 12 0 0 2 table-put! 8 3) 16 declaim-inline 43 -2 9 1 1 (3 (43 0 45 symbol? 1) 7 (43 0 12 0 0 2 table-exists? 8 2) 29 17) 16 inline-function-name? 43 -2 9 3 1 (26 2 3 (29 0 43 2 43 1 45 traverse 3) 6 -2 3 (43 -2 45 lambda-node? 1) 7 (3 (3 (43 -2 45 lambda-scope-get 1) 0 45 scope-frees 1) 6 -3 7 (3 . #0=((43 0 12 0 0 45 table-delete! 2) 29 17)) 3 (43 2 43 1 45 cons 2) 0 43 0 12 0 0 2 table-put! 8 3) 3 . #0#) 16 register-inline-function 43 -2 9 1 1 (3 (43 0 12 0 0 45 table-get 2) 30 17) 16 get-inline-function-body 43 -2 9 1 1 (3 (43 0 12 0 0 45 table-get 2) 31 17) 16 get-inline-function-scope 26 -2 10)\n"
+"(5 0 0 26 6 9 4 0 (43 0 43 2 43 1 43 3 9 3 4 (46 0 (3 (43 0 45 single? 1) 7 (12 0 7 (3 (43 2 12 0 0 45 list* 2) 0 . #0=(43 1 1 0 30 0 2 compile-recur 8 3)) 43 2 . #0#) 43 2 43 1 43 0 12 1 0 2 compile-embed-op 8 4) 12 2 7 (43 2 12 2 0 44 5 2 list* 8 3) 12 3 0 44 \"`%@` requires at least 1 parameter\" 2 compile-error 8 2) 17) 6 -4 9 1 0 (43 0 9 3 1 (43 2 43 1 43 0 12 0 0 2 compile-embed-op-1 8 4) 17) 6 -3 9 1 0 (43 0 9 3 1 (43 2 43 1 43 0 12 0 0 2 compile-embed-op 8 4) 17) 6 -2 29 6 -5 3 (3 (3 (44 31 1 -3 4 1) 0 44 cdr 45 cons 2) 0 3 (3 (44 30 1 -3 4 1) 0 44 car 45 cons 2) 0 3 (3 (44 42 1 -2 4 1) 0 44 >= 45 cons 2) 0 3 (3 (44 40 1 -2 4 1) 0 44 <= 45 cons 2) 0 3 (3 (44 41 1 -2 4 1) 0 44 > 45 cons 2) 0 3 (3 (44 39 1 -2 4 1) 0 44 < 45 cons 2) 0 3 (3 (44 38 1 -3 4 1) 0 44 eq? 45 cons 2) 0 3 (3 (44 37 29 0 44 36 44 / 1 -4 4 4) 0 44 / 45 cons 2) 0 3 (3 (29 0 44 1 44 35 44 * 1 -4 4 4) 0 44 * 45 cons 2) 0 3 (3 (44 34 29 0 44 33 44 - 1 -4 4 4) 0 44 - 45 cons 2) 0 3 (3 (29 0 44 0 44 32 44 + 1 -4 4 4) 0 44 + 45 cons 2) 0 45 list 11) 6 -6 . #1=(3 (43 -6 45 pair? 1) 7 (1 -6 30 6 -7 3 (1 -7 31 0 1 -7 30 0 45 register-embed-func 2) 1 -6 31 0 19 4 1 . #1#) 11 26 -7 10))\n"
+"(5 0 0 26 1 29 6 -2 20 -2 43 -2 9 (0 -1) 1 (12 0 21 7 (3 (43 0 2 *stderr* 0 2 format 0 45 apply 3) 3 (2 *stderr* 0 44 \"\\n\" 45 display 2) 29 0 12 0 21 8 1) 3 (43 0 29 0 2 format 0 45 apply 3) 0 2 error 8 1) 16 compile-error 43 -2 9 1 1 (26 5 22 t 6 -3 14 0 3 (29 0 29 0 45 create-scope 2) 6 -2 3 (29 0 43 -2 43 0 45 traverse 3) 6 -3 3 (43 -2 43 -3 45 optimize-ast 2) 3 (44 10 45 list 1) 6 -4 3 (43 -4 43 -2 43 -3 45 compile-recur 3) 6 -5 3 (43 -2 45 scope-work-size 1) 6 -6 3 (43 -5 45 optimize! 1) 29 14 0 44 0 1 -6 38 7 (1 -5 17) 3 (3 (44 10 43 -6 44 -1 33 2 0 44 26 45 list 3) 0 43 -4 45 copy-pair! 2) 43 -5 43 -6 44 26 44 0 44 0 44 5 2 list* 8 6) 16 compile 26 -2 10)\n"
+"(9 1 0 (3 (43 0 45 compile 1) 0 2 run-binary 8 1) 16 eval 10)\n"
 ;
 }  // namespace yalp
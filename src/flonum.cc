@@ -21,20 +21,22 @@
 namespace yalp {
 
 #ifndef DISABLE_FLONUM
-// !!!
 Value State::flonum(Flonum f) {
+#ifdef IMMEDIATE_FLONUM
+  Value v;
+  if (Value::immediateFlonum(f, &v))
+    return v;
+#endif
   return Value(allocator_->newObject<SFlonum>(f));
 }
 
 //=============================================================================
 
 SFlonum::SFlonum(Flonum v)
-  : Object()
+  : Object(TT_FLONUM)
   , v_(v) {
 }
 
-Type SFlonum::getType() const  { return TT_FLONUM; }
-
 bool SFlonum::equal(const Object* target) const {
   const SFlonum* p = static_cast<const SFlonum*>(target);
   return v_ == p->v_;
@@ -30,16 +30,20 @@
  *
  * Policy:
  *   Policy class determines the behavior of hash table.
- *   it must implement following 2 static functions:
+ *   it must implement following 2 functions of `HashPolicy`:
  *
- *   struct Policy {
- *     static unsigned int hash(const Key a) {
+ *   struct Policy : public HashPolicy<Key> {
+ *     virtual unsigned int hash(const Key a) override {
  *       // return some unsigned integer to distribute keys.
  *     }
- *     static bool equal(const Key a, const Key b) {
+ *     virtual bool equal(const Key a, const Key b) override {
  *       // return true if 2 keys are same.
  *     }
  *   };
+ *
+ * Entries are stored in an array of power of 2 size (open addressing), and
+ * hash values are kept with them: `equal` is called only for same hash,
+ * and growing the array doesn't call `hash`.
  */
 //=============================================================================
 
@@ -66,68 +70,70 @@ struct HashPolicy {
 template <class Key, class Value>
 class HashTable {
 public:
-  static const unsigned int INITIAL_BUFFER_SIZE = 5;
+  static const unsigned int INITIAL_BUFFER_SIZE = 8;  // Power of 2.
 
   explicit HashTable(HashPolicy<Key>* policy, Allocator* allocator)
     : policy_(policy), allocator_(allocator)
-    , array_(NULL), arraySize_(0)
-    , entryCount_(0), conflictCount_(0) {
-  }
-
-  explicit HashTable(HashPolicy<Key>* policy, unsigned int capacity)
-    : policy_(policy), array_(NULL), arraySize_(capacity)
-    , entryCount_(0), conflictCount_(0) {
+    , entries_(NULL), hashes_(NULL), arraySize_(0), entryCount_(0) {
   }
 
   ~HashTable() {
-    if (array_ != NULL) {
-      for (unsigned int i = 0; i < arraySize_; ++i) {
-        for (Link* link = array_[i]; link != NULL; ) {
-          Link* next = link->next;
-          allocator_->free(link);
-          link = next;
-        }
-      }
-      allocator_->free(array_);
-    }
+    if (entries_ != NULL)
+      allocator_->free(entries_);
   }
 
   unsigned int getCapacity() const  { return arraySize_; }
   int getEntryCount() const  { return entryCount_; }
-  int getConflictCount() const  { return conflictCount_; }
+  // Number of entries which are not in their home slot.
+  int getConflictCount() const  { return calcConflictCount(); }
+  // Longest probe sequence to find an entry.
   int getMaxDepth() const  { return calcMaxDepth(); }
 
   void put(const Key key, const Value& value) {
-    Link* link = find(key);
-    if (link == NULL)
-      link = createLink(key);
-    link->value = value;
+    unsigned int hash = hashOf(key);
+    int index = find(key, hash);
+    if (index >= 0) {
+      entries_[index].value = value;
+      return;
+    }
+    if ((entryCount_ + 1) * 4 > arraySize_ * 3)  // Load factor 3/4.
+      expand();
+    Entry entry;
+    entry.key = key;
+    entry.value = value;
+    insert(entry, hash);
+    ++entryCount_;
   }
 
   const Value* get(const Key key) const {
-    Link* link = find(key);
-    if (link == NULL)
+    int index = find(key, hashOf(key));
+    if (index < 0)
       return NULL;
-    return &link->value;
+    return &entries_[index].value;
   }
 
   bool remove(const Key key) {
-    Link* prev;
-    unsigned int index;
-    Link* link = find(key, &prev, &index);
-    if (link == NULL)
+    int index = find(key, hashOf(key));
+    if (index < 0)
       return false;
-    if (prev == NULL)
-      array_[index] = link->next;
-    else
-      prev->next = link->next;
-    allocator_->free(link);
+    removeAt(index);
     return true;
   }
 
+  // Removes entries for which `pred(key, value)` returns true.
+  template <class Pred>
+  void removeIf(Pred pred) {
+    for (unsigned int i = 0; i < arraySize_; ) {
+      // Following entry is shifted into the slot, so it is checked again.
+      if (hashes_[i] != 0 && pred(entries_[i].key, entries_[i].value))
+        removeAt(i);
+      else
+        ++i;
+    }
+  }
+
 private:
-  struct Link {
-    Link* next;
+  struct Entry {
     Key key;
     Value value;
   };
@@ -137,131 +143,146 @@ public:
   class const_iterator {
   public:
     const const_iterator& operator++() {
-      link = link->next;
-      if (link == NULL) {
-        do {
-          if (++index >= ht->arraySize_)
-            break;
-          link = ht->array_[index];
-        } while (link == NULL);
-      }
+      while (++index < ht->arraySize_ && ht->hashes_[index] == 0)
+        ;
       return *this;
     }
 
-    bool operator==(const const_iterator& it) const  { return link == it.link; }
-    bool operator!=(const const_iterator& it) const  { return link != it.link; }
+    bool operator==(const const_iterator& it) const  { return index == it.index; }
+    bool operator!=(const const_iterator& it) const  { return index != it.index; }
 
-    const Link* operator->() const  { return link; }
-    const Link& operator*() const  { return *link; }
+    const Entry* operator->() const  { return &ht->entries_[index]; }
+    const Entry& operator*() const  { return ht->entries_[index]; }
 
   private:
-    const_iterator(const HashTable* ht, unsigned int index, Link* link) {
+    const_iterator(const HashTable* ht, unsigned int index) {
       this->ht = ht;
       this->index = index;
-      this->link = link;
     }
 
     const HashTable* ht;
     unsigned int index;
-    Link* link;
     friend class HashTable;
   };
 
   const_iterator begin() const {
-    Link* link = NULL;
     unsigned int index = 0;
-    for (index = 0; index < arraySize_; ++index) {
-      link = array_[index];
-      if (link != NULL)
-        break;
-    }
-    const_iterator it(this, index, link);
-    return it;
+    while (index < arraySize_ && hashes_[index] == 0)
+      ++index;
+    return const_iterator(this, index);
   }
   const_iterator end() const {
-    return const_iterator(this, arraySize_, NULL);
+    return const_iterator(this, arraySize_);
   }
 
 private:
-  Link* find(const Key key, Link** pPrev = NULL, unsigned int* pIndex = NULL) const {
-    if (array_ == NULL)
-      return NULL;
+  // Open addressing with linear probing, and Robin Hood insertion: an entry
+  // takes the slot of one which is nearer to its home, so probe lengths are
+  // even, and search stops at an entry nearer than the probe.
+  // Hash value is kept for each slot, 0 means empty.
+
+  unsigned int hashOf(const Key key) const {
     unsigned int hash = policy_->hash(key);
-    unsigned int index = hash % arraySize_;
-    Link* prev = NULL;
-    for (Link* link = array_[index]; link != NULL;
-         prev = link, link = link->next) {
-      if (policy_->equal(key, link->key)) {
-        if (pPrev != NULL)
-          *pPrev = prev;
-        if (pIndex != NULL)
-          *pIndex = index;
-        return link;
+    return hash != 0 ? hash : 1;
+  }
+
+  unsigned int homeIndex(unsigned int hash) const {
+    return (hash ^ (hash >> 16)) & (arraySize_ - 1);
+  }
+
+  // Distance from the home slot of the hash.
+  unsigned int probeLength(unsigned int hash, unsigned int index) const {
+    return (index - homeIndex(hash)) & (arraySize_ - 1);
+  }
+
+  int find(const Key key, unsigned int hash) const {
+    if (entryCount_ == 0)
+      return -1;
+    unsigned int mask = arraySize_ - 1;
+    for (unsigned int index = homeIndex(hash), len = 0; ; index = (index + 1) & mask, ++len) {
+      unsigned int h = hashes_[index];
+      if (h == 0 || probeLength(h, index) < len)
+        return -1;
+      if (h == hash && policy_->equal(key, entries_[index].key))
+        return index;
+    }
+  }
+
+  // Inserts the entry, which is not in the table, into free space.
+  void insert(Entry entry, unsigned int hash) {
+    unsigned int mask = arraySize_ - 1;
+    for (unsigned int index = homeIndex(hash), len = 0; ; index = (index + 1) & mask, ++len) {
+      unsigned int h = hashes_[index];
+      if (h == 0) {
+        new(&entries_[index]) Entry(entry);
+        hashes_[index] = hash;
+        return;
+      }
+      unsigned int l = probeLength(h, index);
+      if (l < len) {
+        Entry e = entries_[index];
+        entries_[index] = entry;
+        hashes_[index] = hash;
+        entry = e;
+        hash = h;
+        len = l;
       }
     }
-    return NULL;
   }
 
-  Link* createLink(const Key key) {
-    if (array_ == NULL || entryCount_ >= arraySize_)
-      expand();
-    unsigned int hash = policy_->hash(key);
-    Link* link = new(allocator_->alloc(sizeof(*link))) Link;
-    unsigned int index = hash % arraySize_;
-    link->next = array_[index];
-    link->key = key;
-    if (array_[index] != NULL)
-      ++conflictCount_;
-    array_[index] = link;
-    ++entryCount_;
-    return link;
+  // Shifts following entries back, instead of leaving a tombstone.
+  void removeAt(unsigned int index) {
+    unsigned int mask = arraySize_ - 1;
+    for (;;) {
+      unsigned int next = (index + 1) & mask;
+      unsigned int h = hashes_[next];
+      if (h == 0 || probeLength(h, next) == 0)
+        break;
+      entries_[index] = entries_[next];
+      hashes_[index] = h;
+      index = next;
+    }
+    hashes_[index] = 0;
+    --entryCount_;
   }
 
   void expand() {
-    unsigned int newSize = arraySize_;
-    if (newSize < INITIAL_BUFFER_SIZE)
-      newSize = INITIAL_BUFFER_SIZE;
-    else if (newSize < 128)
-      newSize <<= 1;
-    else
-      newSize = newSize + (newSize >> 1);  // x 1.5
-    newSize += 1 - (newSize & 1);  // Force odd number.
-
-    Link** newArray = static_cast<Link**>(allocator_->alloc(sizeof(Link*) * newSize));
-    for (unsigned int i = 0; i < newSize; ++i)
-      newArray[i] = NULL;
-    rehash(array_, arraySize_, newArray, newSize, policy_);
+    unsigned int newSize = arraySize_ > 0 ? arraySize_ * 2 : INITIAL_BUFFER_SIZE;
 
-    if (array_ != NULL)
-      allocator_->free(array_);
-    array_ = newArray;
+    // Entries and hashes are allocated in a block.
+    Entry* oldEntries = entries_;
+    unsigned int* oldHashes = hashes_;
+    unsigned int oldSize = arraySize_;
+    void* memory = allocator_->alloc((sizeof(Entry) + sizeof(unsigned int)) * newSize);
+    entries_ = static_cast<Entry*>(memory);
+    hashes_ = reinterpret_cast<unsigned int*>(entries_ + newSize);
     arraySize_ = newSize;
-    conflictCount_ = 0;
+    for (unsigned int i = 0; i < newSize; ++i)
+      hashes_[i] = 0;
+    for (unsigned int i = 0; i < oldSize; ++i) {
+      if (oldHashes[i] != 0)
+        insert(oldEntries[i], oldHashes[i]);
+    }
+    if (oldEntries != NULL)
+      allocator_->free(oldEntries);
     // Keeps entryCount_
   }
 
-  static void rehash(Link** oldArray, unsigned int oldSize,
-                     Link** newArray, unsigned int newSize, HashPolicy<Key>* policy) {
-    if (oldArray == NULL || oldSize == 0)
-      return;
-    for (unsigned int i = 0; i < oldSize; ++i) {
-      for (Link* link = oldArray[i]; link != NULL; ) {
-        Link* next = link->next;
-        unsigned int hash = policy->hash(link->key);
-        unsigned int index = hash % newSize;
-        link->next = newArray[index];
-        newArray[index] = link;
-        link = next;
-      }
+  int calcConflictCount() const {
+    int count = 0;
+    for (unsigned int i = 0; i < arraySize_; ++i) {
+      if (hashes_[i] != 0 && probeLength(hashes_[i], i) > 0)
+        ++count;
     }
+    return count;
   }
 
   int calcMaxDepth() const {
     int max = 0;
     for (unsigned int i = 0; i < arraySize_; ++i) {
-      int depth = 0;
-      for (Link* link = array_[i]; link != NULL; link = link->next)
-        ++depth;
+      if (hashes_[i] == 0)
+        continue;
+      int depth = probeLength(hashes_[i], i) + 1;
       if (depth > max)
         max = depth;
     }
@@ -270,10 +291,10 @@ private:
 
   HashPolicy<Key>* policy_;
   Allocator* allocator_;
-  Link** array_;
-  unsigned int arraySize_;
+  Entry* entries_;
+  unsigned int* hashes_;  // Follows entries_, in the same block.
+  unsigned int arraySize_;  // Power of 2.
   unsigned int entryCount_;  // Number of entries.
-  unsigned int conflictCount_;  // Number of hash index conflicts.
 };
 
 }  // namespace yalp
@@ -0,0 +1,471 @@
+//=============================================================================
+/// Jit - Compiles hot closures into native code (x86-64).
+//=============================================================================
+
+#include "build_env.hh"
+#include "jit.hh"
+
+#ifdef ENABLE_JIT
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "JIT is supported only on Linux/x86-64"
+#endif
+
+#include "allocator.hh"
+#include "linker.hh"
+#include "yalp/object.hh"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>  // for memcpy
+#include <sys/mman.h>
+
+namespace yalp {
+
+const size_t EXECUTABLE_CHUNK_SIZE = 64 * 1024;
+
+static uint64_t rawValue(Value v) {
+  uint64_t raw;
+  memcpy(&raw, &v, sizeof(raw));
+  return raw;
+}
+
+static uint64_t rawPointer(const void* p) {
+  return reinterpret_cast<uintptr_t>(p);
+}
+
+// Instructions expanded inline, without helper.
+static bool isInlineOp(int op) {
+  return op == CONST || op == NIL || op == TEST || op == JMP;
+}
+
+// Emits x86-64 machine code into buffer.
+// Uses only rax, rcx, rdx, rsi and rdi as work registers, and r12 holds Vm.
+class Assembler {
+public:
+  enum Reg { RAX = 0, RCX = 1, RDX = 2, RSI = 6, RDI = 7 };
+  enum Cond { CC_O = 0x0, CC_Z = 0x4, CC_NZ = 0x5, CC_L = 0xc, CC_GE = 0xd, CC_LE = 0xe, CC_G = 0xf };
+
+  int getOffset() const  { return static_cast<int>(buffer_.size()); }
+  const unsigned char* getTop() const  { return &buffer_[0]; }
+
+  void byte(unsigned char b)  { buffer_.push_back(b); }
+  void bytes(const unsigned char* p, int n)  { buffer_.insert(buffer_.end(), p, p + n); }
+  void imm32(int32_t x)  { bytes(reinterpret_cast<const unsigned char*>(&x), sizeof(x)); }
+  void imm64(uint64_t x)  { bytes(reinterpret_cast<const unsigned char*>(&x), sizeof(x)); }
+
+  // Jumps: returns offset of rel32 operand to be fixed.
+  int jmp()  { byte(0xe9); return rel32(); }
+  int jcc(Cond cc)  { byte(0x0f); byte(0x80 | cc); return rel32(); }
+  void setRel32(int pos, int target) {
+    int32_t rel = target - (pos + 4);
+    memcpy(&buffer_[pos], &rel, sizeof(rel));
+  }
+  void bind(int pos)  { setRel32(pos, getOffset()); }
+
+  // mov reg, imm64
+  void movImm(Reg r, uint64_t x)  { byte(0x48); byte(0xb8 | r); imm64(x); }
+  // mov reg, reg
+  void mov(Reg dst, Reg src)  { byte(0x48); byte(0x89); byte(0xc0 | (src << 3) | dst); }
+
+  // Access to Vm fields: [r12 + disp]
+  void load64(Reg r, int disp)  { byte(0x49); byte(0x8b); vm(r, disp); }
+  void store64(int disp, Reg r)  { byte(0x49); byte(0x89); vm(r, disp); }
+  void load32(Reg r, int disp)  { byte(0x41); byte(0x8b); vm(r, disp); }
+  void storeImm32(int disp, int32_t x)  { byte(0x41); byte(0xc7); vm(RAX, disp); imm32(x); }
+  void addImm32(int disp, int32_t x)  { byte(0x41); byte(0x81); vm(RAX, disp); imm32(x); }
+
+  // Access to stack element: [rdx + index * 8 + disp]
+  void loadElem(Reg r, int disp, Reg index = RCX)  { byte(0x48); byte(0x8b); elem(r, disp, index); }
+  void storeElem(int disp, Reg r, Reg index = RCX)  { byte(0x48); byte(0x89); elem(r, disp, index); }
+
+  // Operates rax and rsi.
+  void addRaxRsi()  { byte(0x48); byte(0x01); byte(0xf0); }
+  void subRaxRsi()  { byte(0x48); byte(0x29); byte(0xf0); }
+  void cmpRaxRsi()  { byte(0x48); byte(0x39); byte(0xf0); }
+  void addRaxImm8(int8_t x)  { byte(0x48); byte(0x83); byte(0xc0); byte(x); }
+  void cmpRaxRcx()  { byte(0x48); byte(0x39); byte(0xc8); }
+  void cmpMemRaxZero32()  { byte(0x83); byte(0x38); byte(0x00); }  // cmp dword [rax], 0
+  void cmovRaxRdx(Cond cc)  { byte(0x48); byte(0x0f); byte(0x40 | cc); byte(0xc2); }
+  // test (rax & rsi), 1
+  void testFixnums()  {
+    mov(RDI, RAX);
+    byte(0x48); byte(0x21); byte(0xf7);  // and rdi, rsi
+    byte(0xf7); byte(0xc7); imm32(1);     // test edi, 1
+  }
+  void testEax()  { byte(0x85); byte(0xc0); }
+  void movRdiVm()  { byte(0x4c); byte(0x89); byte(0xe7); }  // mov rdi, r12
+  void callRax()  { byte(0xff); byte(0xd0); }
+
+  // push r12; mov r12, vm
+  void prologue(const void* vm)  { byte(0x41); byte(0x54); byte(0x49); byte(0xbc); imm64(rawPointer(vm)); }
+  // pop r12; ret
+  void epilogue()  { byte(0x41); byte(0x5c); byte(0xc3); }
+  // pop r12; jmp rax  (if rax != 0)
+  void epilogueOrJumpRax() {
+    byte(0x48); byte(0x85); byte(0xc0);  // test rax, rax
+    int ret = jcc(CC_Z);
+    byte(0x41); byte(0x5c);
+    byte(0xff); byte(0xe0);
+    bind(ret);
+    epilogue();
+  }
+
+private:
+  int rel32()  { int pos = getOffset(); imm32(0); return pos; }
+  void vm(Reg r, int disp)  { byte(0x84 | (r << 3)); byte(0x24); imm32(disp); }
+  void elem(Reg r, int disp, Reg index)  { byte(0x84 | (r << 3)); byte(0xc2 | (index << 3)); imm32(disp); }
+
+  std::vector<unsigned char> buffer_;
+};
+
+// Translates instructions into native code.
+class Translator {
+public:
+  Translator(const JitInterface& interface, Assembler* as)
+    : if_(interface), as_(as)  {}
+
+  void callHelper(int op, Value* pc) {
+    as_->movRdiVm();
+    as_->movImm(Assembler::RSI, rawPointer(pc));
+    as_->movImm(Assembler::RAX, rawPointer(reinterpret_cast<void*>(if_.helpers[op])));
+    as_->callRax();
+  }
+
+  // Continues to native code for `x_` if it is compiled, otherwise returns
+  // to the interpreter.
+  void next() {
+    as_->movRdiVm();
+    as_->movImm(Assembler::RAX, rawPointer(reinterpret_cast<void*>(if_.next)));
+    as_->callRax();
+    as_->epilogueOrJumpRax();
+  }
+
+  // Returns to the interpreter, continues from `pc`.
+  void exit(Value* pc) {
+    as_->movImm(Assembler::RAX, rawPointer(pc));
+    as_->store64(if_.pc, Assembler::RAX);
+    as_->epilogue();
+  }
+
+  void setAccumulator(Value v) {
+    as_->movImm(Assembler::RAX, rawValue(v));
+    as_->store64(if_.accumulator, Assembler::RAX);
+  }
+
+  // Loads local variable into rax and a_.
+  void lref(int n) {
+    as_->load32(Assembler::RCX, if_.fp);
+    as_->load64(Assembler::RDX, if_.stack);
+    as_->loadElem(Assembler::RAX, -8 * (n + 1));
+    as_->store64(if_.accumulator, Assembler::RAX);
+    as_->storeImm32(if_.valueCount, 1);
+  }
+
+  // Pushes a_ onto stack (reserved at function entry).
+  void push() {
+    as_->load32(Assembler::RCX, if_.sp);
+    as_->load64(Assembler::RDX, if_.stack);
+    as_->load64(Assembler::RAX, if_.accumulator);
+    as_->storeElem(0, Assembler::RAX);
+    as_->addImm32(if_.sp, 1);
+  }
+
+  // Moves arguments into the current frame.
+  void loop(int offset, int n) {
+    as_->load32(Assembler::RCX, if_.sp);
+    as_->load32(Assembler::RDI, if_.fp);
+    as_->load64(Assembler::RDX, if_.stack);
+    for (int i = 0; i < n; ++i) {
+      int j = offset > 0 ? -(offset + i) - 2 : offset + i;
+      as_->loadElem(Assembler::RAX, -8 * (i + 1));
+      as_->storeElem(-8 * (j + 1), Assembler::RAX, Assembler::RDI);
+    }
+    as_->addImm32(if_.sp, -n);
+
+    // Lets profiler take a sample, as the interpreter does.
+    as_->movImm(Assembler::RAX, rawPointer(const_cast<const sig_atomic_t*>(if_.profileRequested)));
+    as_->cmpMemRaxZero32();
+    int skip = as_->jcc(Assembler::CC_Z);
+    as_->movRdiVm();
+    as_->movImm(Assembler::RAX, rawPointer(reinterpret_cast<void*>(if_.checkProfile)));
+    as_->callRax();
+    as_->bind(skip);
+  }
+
+  // Two fixnums case of arithmetic or comparison, calls helper otherwise.
+  void fixnumOp(int op, Value* pc) {
+    if (pc[1].toFixnum() != 2) {
+      callHelper(op, pc);
+      return;
+    }
+    as_->load32(Assembler::RCX, if_.sp);
+    as_->load64(Assembler::RDX, if_.stack);
+    as_->loadElem(Assembler::RAX, -8);   // index(s_, 0)
+    as_->loadElem(Assembler::RSI, -16);  // index(s_, 1)
+    as_->testFixnums();
+    int slow1 = as_->jcc(Assembler::CC_Z), slow2 = -1;
+    switch (op) {
+    case ADD:
+      // (2x + 1) - 1 + (2y + 1)
+      as_->addRaxImm8(-1);
+      as_->addRaxRsi();
+      slow2 = as_->jcc(Assembler::CC_O);
+      break;
+    case SUB:
+      // (2x + 1) - (2y + 1) + 1
+      as_->subRaxRsi();
+      slow2 = as_->jcc(Assembler::CC_O);
+      as_->addRaxImm8(1);
+      break;
+    default:
+      {
+        // Tagged fixnums keep their order.
+        Assembler::Cond cc = (op == LT ? Assembler::CC_L : op == LE ? Assembler::CC_LE :
+                              op == GT ? Assembler::CC_G : Assembler::CC_GE);
+        as_->cmpRaxRsi();
+        as_->movImm(Assembler::RAX, rawValue(Value::NIL));
+        as_->movImm(Assembler::RDX, rawValue(if_.t));
+        as_->cmovRaxRdx(cc);
+      }
+      break;
+    }
+    as_->store64(if_.accumulator, Assembler::RAX);
+    as_->addImm32(if_.sp, -2);
+    int done = as_->jmp();
+    as_->bind(slow1);
+    if (slow2 >= 0)
+      as_->bind(slow2);
+    callHelper(op, pc);
+    as_->bind(done);
+  }
+
+private:
+  const JitInterface& if_;
+  Assembler* as_;
+};
+
+//=============================================================================
+
+Jit* Jit::create(State* state, Vm* vm, const JitInterface& interface) {
+  void* memory = state->alloc(sizeof(Jit));
+  return new(memory) Jit(state, vm, interface);
+}
+
+void Jit::release() {
+  State* state = state_;
+  this->~Jit();
+  state->free(this);
+}
+
+Jit::Jit(State* state, Vm* vm, const JitInterface& interface)
+  : state_(state), vm_(vm), interface_(interface)
+  , chunks_(), ptr_(NULL), rest_(0) {
+  assert(sizeof(Value) == sizeof(uint64_t));
+}
+
+Jit::~Jit() {
+  for (auto chunk : chunks_)
+    munmap(chunk.first, chunk.second);
+}
+
+void* Jit::allocExecutable(size_t size) {
+  if (size > rest_) {
+    size_t chunkSize = size > EXECUTABLE_CHUNK_SIZE ? size : EXECUTABLE_CHUNK_SIZE;
+    void* memory = mmap(NULL, chunkSize, PROT_READ | PROT_WRITE | PROT_EXEC,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+      return NULL;
+    chunks_.push_back(std::make_pair(memory, chunkSize));
+    ptr_ = static_cast<unsigned char*>(memory);
+    rest_ = chunkSize;
+  }
+  void* result = ptr_;
+  ptr_ += size;
+  rest_ -= size;
+  return result;
+}
+
+void Jit::compile(Closure* closure) {
+  assert(closure->getCode().getType() == TT_CODE);
+  Code* code = static_cast<Code*>(closure->getCode().toObject());
+  Value* top = code->getTop();
+  int size = code->getSize();
+  int body = closure->getBody() - top;
+  if (top[body].toFixnum() == JIT)
+    return;  // Already compiled (shared with other closure).
+
+  auto isCompilable = [this](int op) {
+    return isInlineOp(op) || interface_.helpers[op] != NULL;
+  };
+  if (!isCompilable(code->getOriginalOp(&top[body])))
+    return;
+
+  // Collects reachable instructions from the body.
+  std::vector<bool> visited(size, false);
+  std::vector<int> entries(1, body);
+  std::vector<int> work(1, body);
+  while (!work.empty()) {
+    int i = work.back();
+    work.pop_back();
+    if (visited[i])
+      continue;
+    visited[i] = true;
+    int op = code->getOriginalOp(&top[i]);
+    if (op == JMP) {
+      work.push_back(getJumpTarget(&top[i + 1]) - top);
+      continue;
+    }
+    if (!isCompilable(op))
+      continue;  // Exits to the interpreter.
+
+    int n;
+    switch (getLayout(op, &n)) {
+    case LAYOUT_NEXT:
+      work.push_back(i + 1 + n);
+      break;
+    case LAYOUT_TERM:
+      break;
+    case LAYOUT_BRANCH:
+      work.push_back(i + 2 + n);
+      if (op != CLOSE)  // Closure body is not a part of this function.
+        work.push_back(getJumpTarget(&top[i + 1 + n]) - top);
+      break;
+    case LAYOUT_CALL:
+      {
+        int ret = getJumpTarget(&top[i + 1 + n]) - top;
+        work.push_back(i + 2 + n);
+        work.push_back(ret);
+        entries.push_back(ret);
+      }
+      break;
+    }
+  }
+
+  // Emits instructions in address order.
+  Assembler as;
+  Translator tr(interface_, &as);
+  std::vector<int> labels(size, -1);
+  std::vector<std::pair<int, int> > fixups;  // rel32 offset -> instruction index.
+  int fallthrough = -1;
+  for (int i = 0; i < size; ++i) {
+    if (!visited[i])
+      continue;
+    if (fallthrough >= 0 && fallthrough != i)
+      fixups.push_back(std::make_pair(as.jmp(), fallthrough));
+    fallthrough = -1;
+    labels[i] = as.getOffset();
+
+    Value* pc = &top[i];
+    int op = code->getOriginalOp(pc);
+    if (!isCompilable(op)) {
+      tr.exit(pc);
+      continue;
+    }
+
+    int n = 0;
+    switch (op) {
+    case CONST: case NIL:
+      tr.setAccumulator(op == CONST ? pc[1] : Value::NIL);
+      fallthrough = i + (op == CONST ? 2 : 1);
+      break;
+    case TEST:
+      as.load64(Assembler::RAX, interface_.accumulator);
+      as.movImm(Assembler::RCX, rawValue(Value::NIL));
+      as.cmpRaxRcx();
+      fixups.push_back(std::make_pair(as.jcc(Assembler::CC_NZ), getJumpTarget(&pc[1]) - top));
+      fallthrough = i + 2;
+      break;
+    case JMP:
+      fallthrough = getJumpTarget(&pc[1]) - top;
+      break;
+    case LREF: case LREF_PUSH:
+      tr.lref(pc[1].toFixnum());
+      if (op == LREF_PUSH)
+        tr.push();
+      fallthrough = i + 2;
+      break;
+    case CONST_PUSH:
+      tr.setAccumulator(pc[1]);
+      tr.push();
+      fallthrough = i + 2;
+      break;
+    case PUSH:
+      tr.push();
+      fallthrough = i + 1;
+      break;
+    case LREF_TEST:
+      tr.lref(pc[1].toFixnum());
+      as.movImm(Assembler::RCX, rawValue(Value::NIL));
+      as.cmpRaxRcx();
+      fixups.push_back(std::make_pair(as.jcc(Assembler::CC_NZ), getJumpTarget(&pc[2]) - top));
+      fallthrough = i + 3;
+      break;
+    case LOOP:
+      tr.loop(pc[1].toFixnum(), pc[2].toFixnum());
+      fallthrough = i + 3;
+      break;
+    case ADD: case SUB: case LT: case LE: case GT: case GE:
+      tr.fixnumOp(op, pc);
+      fallthrough = i + 2;
+      break;
+    default:
+      tr.callHelper(op, pc);
+      switch (getLayout(op, &n)) {
+      case LAYOUT_NEXT:
+        fallthrough = i + 1 + n;
+        break;
+      case LAYOUT_TERM:
+        // Helper sets next instruction into `x_`.
+        tr.next();
+        break;
+      case LAYOUT_BRANCH:
+        if (op != CLOSE) {
+          as.testEax();
+          fixups.push_back(std::make_pair(as.jcc(Assembler::CC_NZ),
+                                          getJumpTarget(&pc[1 + n]) - top));
+        }
+        fallthrough = i + 2 + n;
+        break;
+      case LAYOUT_CALL:
+        fallthrough = i + 2 + n;
+        break;
+      }
+      break;
+    }
+  }
+  if (fallthrough >= 0)
+    fixups.push_back(std::make_pair(as.jmp(), fallthrough));
+
+  // Entry stubs.
+  std::vector<std::pair<int, int> > stubs;  // Instruction index -> stub offset.
+  for (int i : entries) {
+    int op = top[i].toFixnum();
+    if (op == JIT || op == RET || !isCompilable(op) || labels[i] < 0)
+      continue;
+    bool exist = false;
+    for (auto stub : stubs)
+      exist = exist || stub.first == i;
+    if (exist)
+      continue;
+    stubs.push_back(std::make_pair(i, as.getOffset()));
+    as.prologue(vm_);
+    fixups.push_back(std::make_pair(as.jmp(), i));
+  }
+
+  for (auto fixup : fixups)
+    as.setRel32(fixup.first, labels[fixup.second]);
+
+  unsigned char* native = static_cast<unsigned char*>(allocExecutable(as.getOffset()));
+  if (native == NULL)
+    return;  // Keep running on the interpreter.
+  memcpy(native, as.getTop(), as.getOffset());
+
+  Allocator* allocator = state_->getAllocator();
+  for (auto stub : stubs)
+    code->setJitEntry(allocator, &top[stub.first], native + stub.second);
+}
+
+}  // namespace yalp
+
+#endif
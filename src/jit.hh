@@ -0,0 +1,96 @@
+//=============================================================================
+/// Jit - Compiles hot closures into native code (x86-64).
+/*
+ * Template JIT: each instruction of a closure body is translated into
+ * a native call to its helper function which is supplied by Vm.
+ * Simple instructions, and fixnum case of arithmetic and comparison, are
+ * expanded inline. It removes dispatch and operand decoding of the
+ * interpreter. Native code keeps Vm in `r12`, and reads/writes registers
+ * of Vm through it.
+ *
+ * Native code runs until it reaches an instruction which is not supported,
+ * then it returns to `Vm::runLoop` with `x_` register set. Instructions
+ * which change frame (APPLY, TAPPLY, GREF_APPLY, RET) jump into native
+ * code of the destination directly if it is compiled, otherwise return
+ * to the interpreter as well.
+ *
+ * Entry points (closure body and return addresses of frames) in linked
+ * code are replaced with `JIT` instruction, so the interpreter enters
+ * native code from them.
+ */
+//=============================================================================
+
+#ifndef _JIT_HH_
+#define _JIT_HH_
+
+#include "yalp.hh"
+
+#ifdef ENABLE_JIT
+
+#include "linker.hh"
+#include <signal.h>  // for sig_atomic_t
+#include <vector>
+
+namespace yalp {
+
+class Closure;
+class Code;
+class Vm;
+
+// Helper function called from native code, runs the instruction at `pc`.
+// Returns non-zero if branch is taken (for branch instructions).
+typedef int (*JitHelperFunc)(Vm* vm, Value* pc);
+// Returns native code for the next instruction, or NULL if not compiled.
+typedef void* (*JitNextFunc)(Vm* vm);
+// Takes a profile sample.
+typedef void (*JitProfileFunc)(Vm* vm);
+
+// Interface to Vm, for native code.
+struct JitInterface {
+  // Indexed by opcode, NULL for unsupported instruction.
+  JitHelperFunc helpers[NUMBER_OF_OPCODE];
+  JitNextFunc next;
+  JitProfileFunc checkProfile;
+  const volatile sig_atomic_t* profileRequested;  // Checked at loops.
+  // Offsets of registers in Vm.
+  int accumulator;  // a_
+  int pc;           // x_
+  int fp;           // f_
+  int sp;           // s_
+  int stack;        // stack_
+  int valueCount;   // valueCount_
+  Value t;          // Value for true.
+};
+
+class Jit {
+public:
+  static Jit* create(State* state, Vm* vm, const JitInterface& interface);
+  void release();
+
+  // Compiles the closure body, and marks its entries in the linked code.
+  void compile(Closure* closure);
+
+  // Runs native code until it exits to the interpreter.
+  static void run(void* native)  { reinterpret_cast<void (*)()>(native)(); }
+
+private:
+  Jit(State* state, Vm* vm, const JitInterface& interface);
+  ~Jit();
+
+  void* allocExecutable(size_t size);
+
+  State* state_;
+  Vm* vm_;
+  JitInterface interface_;
+
+  // Executable memory.
+  std::vector<std::pair<void*, size_t> > chunks_;
+  unsigned char* ptr_;
+  size_t rest_;
+};
+
+}  // namespace yalp
+
+#endif
+
+#endif
@@ -0,0 +1,425 @@
+//=============================================================================
+/// Linker - Converts compiled code into flat instruction array.
+//=============================================================================
+
+#include "build_env.hh"
+#include "linker.hh"
+#include "allocator.hh"
+#include "hash_table.hh"
+#include "vm.hh"
+#include "yalp/stream.hh"
+
+#include <assert.h>
+#include <string.h>  // for memcpy
+
+namespace yalp {
+
+//=============================================================================
+// Code class.
+
+Code::Code(Allocator* allocator, const Value* words, int size, int stackDepth)
+  : Object(TT_CODE)
+  , size_(size), stackDepth_(stackDepth) {
+  void* memory = allocator->alloc(sizeof(Value) * size_);
+  words_ = static_cast<Value*>(memory);
+  memcpy(words_, words, sizeof(Value) * size_);
+#ifdef ENABLE_JIT
+  jitEntries_ = NULL;
+#endif
+}
+
+void Code::destruct(Allocator* allocator) {
+#ifdef ENABLE_JIT
+  if (jitEntries_ != NULL)
+    allocator->free(jitEntries_);
+#endif
+  allocator->free(words_);
+}
+
+void Code::output(State*, Stream* o, bool) const {
+  // This should not be output, but debug purpose.
+  o->write("#<code>");
+}
+
+void Code::trace() {
+  for (int n = size_, i = 0; i < n; ++i)
+    words_[i].mark();
+}
+
+#ifdef ENABLE_JIT
+void Code::setJitEntry(Allocator* allocator, Value* p, void* native) {
+  assert(contains(p) && p->toFixnum() != JIT);
+  if (jitEntries_ == NULL) {
+    void* memory = allocator->alloc(sizeof(JitEntry) * size_);
+    jitEntries_ = static_cast<JitEntry*>(memory);
+  }
+  JitEntry& entry = jitEntries_[p - words_];
+  entry.native = native;
+  entry.op = p->toFixnum();
+  *p = Value(JIT);
+}
+
+int Code::getOriginalOp(const Value* p) const {
+  int op = p->toFixnum();
+  return op == JIT ? jitEntries_[p - words_].op : op;
+}
+#endif
+
+//=============================================================================
+// Linker.
+
+Layout getLayout(int op, int* pOperandNum) {
+  switch (op) {
+  case PUSH: case VOID: case UNBOX: case NIL: case CAR: case CDR:
+  case NEG: case INV: case EQ:
+    *pOperandNum = 0;
+    return LAYOUT_NEXT;
+  case LREF: case GREF: case CONST: case LOCAL: case FREF: case LSET:
+  case FSET: case GSET: case DEF: case BOX: case CONTI: case ADDSP:
+  case VALS: case ADD: case SUB: case MUL: case DIV:
+  case LT: case LE: case GT: case GE:
+    *pOperandNum = 1;
+    return LAYOUT_NEXT;
+  case LREF_PUSH: case CONST_PUSH:
+    *pOperandNum = 1;
+    return LAYOUT_NEXT;
+  case LOOP: case RECV:
+    *pOperandNum = 2;
+    return LAYOUT_NEXT;
+  case HALT: case RET: case UNFRAME: case LONGJMP:
+    *pOperandNum = 0;
+    return LAYOUT_TERM;
+  case APPLY: case TAPPLY:
+    *pOperandNum = 1;
+    return LAYOUT_TERM;
+  case GREF_APPLY:
+    *pOperandNum = 2;
+    return LAYOUT_TERM;
+  case TEST:
+    *pOperandNum = 0;
+    return LAYOUT_BRANCH;
+  case LREF_TEST:
+    *pOperandNum = 1;
+    return LAYOUT_BRANCH;
+  case CLOSE:
+    *pOperandNum = 3;
+    return LAYOUT_BRANCH;
+  case MACRO:
+    *pOperandNum = 4;
+    return LAYOUT_BRANCH;
+  case FRAME:
+    *pOperandNum = 0;
+    return LAYOUT_CALL;
+  case SETJMP:
+    *pOperandNum = 1;
+    return LAYOUT_CALL;
+  default:
+    assert(!"Must not happen");
+    *pOperandNum = 0;
+    return LAYOUT_TERM;
+  }
+}
+
+// Code is shared by cell identity, not by its contents.
+struct CellPolicy : public HashPolicy<const Cell*> {
+  virtual unsigned int hash(const Cell* a) override  {
+    return static_cast<unsigned int>(reinterpret_cast<long>(a) >> 4);
+  }
+  virtual bool equal(const Cell* a, const Cell* b) override  { return a == b; }
+};
+
+class Linker {
+public:
+  Linker(Allocator* allocator, Vm* vm)
+    : allocator_(allocator), vm_(vm), linked_(&policy_, allocator)
+    , words_(NULL), size_(0), capacity_(0)
+    , fixups_(NULL), fixupCount_(0), fixupCapacity_(0)
+    , depths_(NULL), owners_(NULL), work_(NULL), funcs_(NULL), funcCount_(0)
+    , stackDepth_(0)  {}
+  ~Linker() {
+    if (words_ != NULL)
+      allocator_->free(words_);
+    if (fixups_ != NULL)
+      allocator_->free(fixups_);
+    if (depths_ != NULL)
+      allocator_->free(depths_);
+  }
+
+  bool link(Value code) {
+    if (!linkSequence(code))
+      return false;
+    while (fixupCount_ > 0) {
+      Fixup fixup = fixups_[--fixupCount_];
+      if (fixup.target.getType() != TT_CELL)
+        return false;
+      const int* p = linked_.get(static_cast<Cell*>(fixup.target.toObject()));
+      int pos = size_;
+      if (p != NULL)
+        pos = *p;
+      else if (!linkSequence(fixup.target))
+        return false;
+      words_[fixup.slot] = Value(pos - fixup.slot);
+    }
+    return calcStackDepths();
+  }
+
+  const Value* getWords() const  { return words_; }
+  int getSize() const  { return size_; }
+  int getStackDepth() const  { return stackDepth_; }
+
+private:
+  struct Fixup {
+    int slot;
+    Value target;
+  };
+
+  // Emits instructions until the sequence ends, or reaches linked code.
+  bool linkSequence(Value code) {
+    for (;;) {
+      if (code.getType() != TT_CELL)
+        return false;
+      const Cell* cell = static_cast<Cell*>(code.toObject());
+      Value opv = cell->car();
+      if (!opv.isFixnum() || opv.toFixnum() < 0 || opv.toFixnum() >= NUMBER_OF_OPCODE ||
+          opv.toFixnum() == JMP || opv.toFixnum() == JIT)
+        return false;
+      int op = opv.toFixnum();
+      int operandNum;
+      Layout layout = getLayout(op, &operandNum);
+
+      const int* p = linked_.get(cell);
+      if (p != NULL) {
+        if (layout == LAYOUT_TERM && operandNum == 0) {
+          // Duplicate terminal instruction instead of jumping to it.
+          emit(opv);
+        } else {
+          emit(Value(JMP));
+          emit(Value(*p - size_));
+        }
+        return true;
+      }
+      linked_.put(cell, size_);
+      emit(opv);
+
+      // Stack depth of CLOSE/MACRO is not in compiled code.
+      bool hasDepth = op == CLOSE || op == MACRO;
+      Value x = cell->cdr();
+      for (int i = 0; i < operandNum - (hasDepth ? 1 : 0); ++i) {
+        if (x.getType() != TT_CELL)
+          return false;
+        Value operand = static_cast<Cell*>(x.toObject())->car();
+        if ((op == GREF || op == GSET || op == DEF || op == GREF_APPLY) && i == 0) {
+          if (operand.getType() != TT_SYMBOL)
+            return false;
+          operand = Value(vm_->getGlobalCell(operand));
+        }
+        emit(operand);
+        x = static_cast<Cell*>(x.toObject())->cdr();
+      }
+      if (hasDepth)
+        emit(Value(-1));  // Placeholder, set after link.
+
+      switch (layout) {
+      case LAYOUT_NEXT:
+        code = x;
+        break;
+      case LAYOUT_TERM:
+        return true;
+      case LAYOUT_BRANCH:
+      case LAYOUT_CALL:
+        {
+          if (x.getType() != TT_CELL)
+            return false;
+          const Cell* c = static_cast<Cell*>(x.toObject());
+          Value jump = layout == LAYOUT_BRANCH ? c->car() : c->cdr();
+          code = layout == LAYOUT_BRANCH ? c->cdr() : c->car();
+          addFixup(size_, jump);
+          emit(Value::NIL);  // Placeholder.
+        }
+        break;
+      }
+    }
+  }
+
+  // Calculates maximum stack depth of each function, and stores it into
+  // CLOSE/MACRO operand. Returns false if stack is unbalanced.
+  bool calcStackDepths() {
+    depths_ = static_cast<int*>(allocator_->alloc(sizeof(int) * size_ * 4));
+    owners_ = depths_ + size_;
+    work_ = owners_ + size_;
+    funcs_ = work_ + size_;
+    for (int i = 0; i < size_; ++i)
+      owners_[i] = -1;
+    funcCount_ = 0;
+    if (!calcStackDepth(0, &stackDepth_))
+      return false;
+    while (funcCount_ > 0) {
+      Value* slot = &words_[funcs_[--funcCount_]];
+      int depth;
+      if (!calcStackDepth(getJumpTarget(slot) - words_, &depth))
+        return false;
+      slot[-1] = Value(depth);
+    }
+    return true;
+  }
+
+  // Walks instructions of a function from the entry, with stack depth.
+  bool calcStackDepth(int entry, int* pDepth) {
+    int n = 0;
+    int maxDepth = 0;
+    if (!addWork(entry, entry, 0, &n))
+      return false;
+    while (n > 0) {
+      int i = work_[--n];
+      int d = depths_[i];
+      int op = words_[i].toFixnum();
+      if (op == JMP) {
+        if (!addWork(getJumpTarget(&words_[i + 1]) - words_, entry, d, &n))
+          return false;
+        continue;
+      }
+
+      int operandNum;
+      Layout layout = getLayout(op, &operandNum);
+      const Value* operands = &words_[i + 1];
+      int peak = 0, delta = 0;
+      switch (op) {
+      case PUSH: case LREF_PUSH: case CONST_PUSH:
+        delta = 1;
+        break;
+      case ADDSP:
+        delta = operands[0].toFixnum();
+        break;
+      case LOOP:
+        delta = -operands[1].toFixnum();
+        break;
+      case VALS:
+        delta = -operands[0].toFixnum();
+        break;
+      case EQ:
+        delta = -1;
+        break;
+      case ADD: case SUB: case MUL: case DIV:
+      case LT: case LE: case GT: case GE:
+        peak = 1;  // Argument number pushed for embedded function.
+        delta = -operands[0].toFixnum();
+        break;
+      case CLOSE:
+        delta = -operands[1].toFixnum();
+        break;
+      case MACRO:
+        delta = -operands[2].toFixnum();
+        break;
+      case FRAME:
+        delta = 3;  // Closure, frame pointer and return address.
+        break;
+      default:
+        break;
+      }
+      if (d + peak > maxDepth)
+        maxDepth = d + peak;
+      if (d + delta > maxDepth)
+        maxDepth = d + delta;
+
+      int next = i + 1 + operandNum;
+      switch (layout) {
+      case LAYOUT_NEXT:
+        if (!addWork(next, entry, d + delta, &n))
+          return false;
+        break;
+      case LAYOUT_TERM:
+        break;
+      case LAYOUT_BRANCH:
+        if (!addWork(next + 1, entry, d + delta, &n))
+          return false;
+        if (op == CLOSE || op == MACRO) {
+          // Function body is walked separately.
+          if (words_[next - 1].toFixnum() < 0) {
+            words_[next - 1] = Value(static_cast<Fixnum>(0));
+            funcs_[funcCount_++] = next;
+          }
+        } else if (!addWork(getJumpTarget(&words_[next]) - words_, entry, d + delta, &n)) {
+          return false;
+        }
+        break;
+      case LAYOUT_CALL:
+        // Body runs on the frame, and stack is restored at the return address.
+        if (!addWork(next + 1, entry, d + delta, &n) ||
+            !addWork(getJumpTarget(&words_[next]) - words_, entry, d, &n))
+          return false;
+        break;
+      }
+    }
+    *pDepth = maxDepth;
+    return true;
+  }
+
+  bool addWork(int i, int owner, int depth, int* pn) {
+    if (i < 0 || i >= size_ || depth < 0)
+      return false;
+    if (owners_[i] == owner)
+      return depths_[i] == depth;
+    owners_[i] = owner;
+    depths_[i] = depth;
+    work_[(*pn)++] = i;
+    return true;
+  }
+
+  void emit(Value v) {
+    if (size_ >= capacity_) {
+      int newCapacity = capacity_ > 0 ? capacity_ * 2 : 64;
+      void* memory = allocator_->realloc(words_, sizeof(Value) * newCapacity);
+      words_ = static_cast<Value*>(memory);
+      capacity_ = newCapacity;
+    }
+    words_[size_++] = v;
+  }
+
+  void addFixup(int slot, Value target) {
+    if (fixupCount_ >= fixupCapacity_) {
+      int newCapacity = fixupCapacity_ > 0 ? fixupCapacity_ * 2 : 16;
+      void* memory = allocator_->realloc(fixups_, sizeof(Fixup) * newCapacity);
+      fixups_ = static_cast<Fixup*>(memory);
+      fixupCapacity_ = newCapacity;
+    }
+    Fixup fixup = { slot, target };
+    fixups_[fixupCount_++] = fixup;
+  }
+
+  Allocator* allocator_;
+  Vm* vm_;
+  CellPolicy policy_;
+  HashTable<const Cell*, int> linked_;  // Cell -> position in words.
+
+  Value* words_;
+  int size_;
+  int capacity_;
+
+  Fixup* fixups_;
+  int fixupCount_;
+  int fixupCapacity_;
+
+  // Work area for stack depth calculation, allocated at once.
+  int* depths_;  // Stack depth at each instruction.
+  int* owners_;  // Entry of function which the depth belongs to.
+  int* work_;
+  int* funcs_;   // Body slots of CLOSE/MACRO to be calculated.
+  int funcCount_;
+  int stackDepth_;
+};
+
+Code* linkCode(State* state, Vm* vm, Value code) {
+  Allocator* allocator = state->getAllocator();
+  Code* result = NULL;
+  {
+    Linker linker(allocator, vm);
+    if (linker.link(code))
+      result = allocator->newObject<Code>(allocator, linker.getWords(), linker.getSize(),
+                                          linker.getStackDepth());
+  }
+  if (result == NULL)
+    state->runtimeError("Illegal code");
+  return result;
+}
+
+}  // namespace yalp
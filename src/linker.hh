@@ -0,0 +1,106 @@
+//=============================================================================
+/// Linker - Converts compiled code into flat instruction array.
+/*
+ * Compiler emits code as cons cells (S-expression), which is easy to
+ * generate and to manipulate, but slow to run: every instruction needs
+ * pointer chasing. Linker flattens it into an array of `Value`s.
+ *
+ * Each instruction is an opcode (fixnum) followed by its operands.
+ * Jump operands are stored as fixnum which holds relative offset from
+ * the operand slot itself:
+ *
+ *   TEST    then             ; else follows.
+ *   FRAME   ret              ; body follows.
+ *   SETJMP  offset ret       ; body follows.
+ *   CLOSE   nparam nfree depth body
+ *   MACRO   name nparam nfree depth body
+ *   JMP     target
+ *
+ * `depth` of CLOSE/MACRO is maximum stack depth of the function body,
+ * calculated by linker, so VM reserves the stack once at function entry.
+ * Shared tails and loops in original code are converted into `JMP`.
+ * Symbol operands of GREF/GSET/DEF/GREF_APPLY are resolved into global cells.
+ *
+ * When JIT is enabled, entry points of compiled native code are marked by
+ * replacing its opcode with `JIT`, and the original one is kept in Code.
+ */
+//=============================================================================
+
+#ifndef _LINKER_HH_
+#define _LINKER_HH_
+
+#include "yalp.hh"
+#include "yalp/object.hh"
+
+namespace yalp {
+
+class Vm;
+
+enum Opcode {
+#define OP(name)  name,
+# include "opcodes.hh"
+#undef OP
+  NUMBER_OF_OPCODE
+};
+
+// Operand layout of instructions in compiled code.
+enum Layout {
+  LAYOUT_NEXT,    // (operands... . next)
+  LAYOUT_TERM,    // (operands...)
+  LAYOUT_BRANCH,  // (operands... jump . next)
+  LAYOUT_CALL,    // (operands... next . jump)
+};
+
+// Gets layout and operand number for the opcode (except JMP and JIT).
+Layout getLayout(int op, int* pOperandNum);
+
+// Linked code.
+class Code : public Object {
+public:
+  Code(Allocator* allocator, const Value* words, int size, int stackDepth);
+
+  Value* getTop() const  { return words_; }
+  int getSize() const  { return size_; }
+  // Maximum stack depth of top level code.
+  int getStackDepth() const  { return stackDepth_; }
+  bool contains(const Value* p) const  { return words_ <= p && p < words_ + size_; }
+
+#ifdef ENABLE_JIT
+  // Replaces the instruction with JIT op which enters the native code.
+  void setJitEntry(Allocator* allocator, Value* p, void* native);
+  void* getJitEntry(const Value* p) const  { return jitEntries_[p - words_].native; }
+  // Gets opcode for the instruction, even if it is replaced by JIT.
+  int getOriginalOp(const Value* p) const;
+#endif
+
+  void output(State* state, Stream* o, bool inspect) const;
+
+protected:
+  ~Code()  {}
+  void destruct(Allocator* allocator);
+  void trace();
+
+  Value* words_;
+  int size_;
+  int stackDepth_;
+
+#ifdef ENABLE_JIT
+  struct JitEntry {
+    void* native;
+    int op;  // Original opcode.
+  };
+  JitEntry* jitEntries_;  // Allocated at first entry, indexed by word position.
+#endif
+
+  friend class GcObject;
+};
+
+// Links compiled code, raises runtime error for illegal code.
+Code* linkCode(State* state, Vm* vm, Value code);
+
+// Gets jump target for the operand slot.
+inline Value* getJumpTarget(Value* slot)  { return slot + slot->toFixnum(); }
+
+}  // namespace yalp
+
+#endif
@@ -7,8 +7,9 @@
 #include "yalp/stream.hh"
 #include "yalp/util.hh"
 #include "hash_table.hh"
+#include "linker.hh"  // for Code
 #include "symbol_manager.hh"
-#include "vm.hh"  // for CallStack
+#include "vm.hh"  // for CallStack, Box and GlobalCell
 
 #include <assert.h>
 #include <new>
@@ -17,21 +18,104 @@
 namespace yalp {
 
 //=============================================================================
+// Dispatches with the type tag, instead of virtual functions.
+// Classes which have no own method for the type are not listed.
+
+void GcObject::destruct(Allocator* allocator) {
+  switch (typeTag_) {
+  case TT_CLOSURE: case TT_MACRO:
+    static_cast<Closure*>(this)->destruct(allocator); break;
+  case TT_CONTINUATION:  static_cast<Continuation*>(this)->destruct(allocator); break;
+  case TT_VECTOR:  static_cast<Vector*>(this)->destruct(allocator); break;
+  case TT_HASH_TABLE:  static_cast<SHashTable*>(this)->destruct(allocator); break;
+  case TT_STREAM:  static_cast<SStream*>(this)->destruct(allocator); break;
+  case TT_CODE:  static_cast<Code*>(this)->destruct(allocator); break;
+  default:  break;
+  }
+}
+
+void GcObject::trace() {
+  switch (typeTag_) {
+  case TT_CELL:  static_cast<Cell*>(this)->trace(); break;
+  case TT_CLOSURE: case TT_MACRO:
+    static_cast<Closure*>(this)->trace(); break;
+  case TT_CONTINUATION:  static_cast<Continuation*>(this)->trace(); break;
+  case TT_VECTOR:  static_cast<Vector*>(this)->trace(); break;
+  case TT_HASH_TABLE:  static_cast<SHashTable*>(this)->trace(); break;
+  case TT_STREAM:  static_cast<SStream*>(this)->trace(); break;
+  case TT_BOX:  static_cast<Box*>(this)->trace(); break;
+  case TT_GLOBAL_CELL:  static_cast<GlobalCell*>(this)->trace(); break;
+  case TT_CODE:  static_cast<Code*>(this)->trace(); break;
+  default:  break;
+  }
+}
+
+void GcObject::clearWeak() {
+  switch (typeTag_) {
+  case TT_HASH_TABLE:  static_cast<SHashTable*>(this)->clearWeak(); break;
+  case TT_WEAK_REF:  static_cast<WeakRef*>(this)->clearWeak(); break;
+  default:  break;
+  }
+}
+
 bool Object::equal(const Object* o) const {
-  return this == o;  // Simple pointer equality.
+  switch (getType()) {
+  case TT_CELL:  return static_cast<const Cell*>(this)->equal(o);
+  case TT_STRING:  return static_cast<const String*>(this)->equal(o);
+#ifndef DISABLE_FLONUM
+  case TT_FLONUM:  return static_cast<const SFlonum*>(this)->equal(o);
+#endif
+  case TT_VECTOR:  return static_cast<const Vector*>(this)->equal(o);
+  default:
+    return this == o;  // Simple pointer equality.
+  }
+}
+
+unsigned int Object::calcHash(State* state) const {
+  switch (getType()) {
+  case TT_CELL:  return static_cast<const Cell*>(this)->calcHash(state);
+  case TT_STRING:  return static_cast<const String*>(this)->calcHash(state);
+  default:
+    return (reinterpret_cast<long>(this) >> 4) * 23;
+  }
 }
 
-unsigned int Object::calcHash(State*) const {
-  return (reinterpret_cast<long>(this) >> 4) * 23;
+void Object::output(State* state, Stream* o, bool inspect) const {
+  switch (getType()) {
+  case TT_CELL:  static_cast<const Cell*>(this)->output(state, o, inspect); break;
+  case TT_STRING:  static_cast<const String*>(this)->output(state, o, inspect); break;
+#ifndef DISABLE_FLONUM
+  case TT_FLONUM:  static_cast<const SFlonum*>(this)->output(state, o, inspect); break;
+#endif
+  case TT_CLOSURE:  static_cast<const Closure*>(this)->output(state, o, inspect); break;
+  case TT_NATIVEFUNC:  static_cast<const NativeFunc*>(this)->output(state, o, inspect); break;
+  case TT_CONTINUATION:  static_cast<const Continuation*>(this)->output(state, o, inspect); break;
+  case TT_VECTOR:  static_cast<const Vector*>(this)->output(state, o, inspect); break;
+  case TT_HASH_TABLE:  static_cast<const SHashTable*>(this)->output(state, o, inspect); break;
+  case TT_STREAM:  static_cast<const SStream*>(this)->output(state, o, inspect); break;
+  case TT_MACRO:  static_cast<const Macro*>(this)->output(state, o, inspect); break;
+  case TT_WEAK_REF:  static_cast<const WeakRef*>(this)->output(state, o, inspect); break;
+  case TT_BOX:  static_cast<const Box*>(this)->output(state, o, inspect); break;
+  case TT_GLOBAL_CELL:  static_cast<const GlobalCell*>(this)->output(state, o, inspect); break;
+  case TT_CODE:  static_cast<const Code*>(this)->output(state, o, inspect); break;
+  default:
+    assert(!"Must not happen");
+    break;
+  }
 }
 
-bool Object::isCallable() const  { return false; }
+bool Object::isCallable() const {
+  switch (getType()) {
+  case TT_CLOSURE: case TT_NATIVEFUNC: case TT_CONTINUATION: case TT_MACRO:
+    return true;
+  default:
+    return false;
+  }
+}
 
 //=============================================================================
 Cell::Cell(Value a, Value d)
-  : Object(), car_(a), cdr_(d) {}
-
-Type Cell::getType() const  { return TT_CELL; }
+  : Object(TT_CELL), car_(a), cdr_(d) {}
 
 bool Cell::equal(const Object* target) const {
   const Cell* p = static_cast<const Cell*>(target);
@@ -89,17 +173,18 @@ void Cell::output(State* state, Stream* o, bool inspect) const {
   o->write(')');
 }
 
-void Cell::mark() {
-  Object::mark();
+void Cell::trace() {
   car_.mark();
   cdr_.mark();
 }
 
 void Cell::setCar(Value a) {
+  writeBarrier(a);
   car_ = a;
 }
 
 void Cell::setCdr(Value d) {
+  writeBarrier(d);
   cdr_ = d;
 }
 
@@ -128,41 +213,38 @@ const char* Cell::isAbbrev(State* state) const {
 //=============================================================================
 
 String::String(const char* string, size_t len)
-  : Object()
-  , string_(string), len_(len) {
-}
-
-void String::destruct(Allocator* allocator) {
-  allocator->free(const_cast<char*>(string_));
-  Object::destruct(allocator);
+  : Object(TT_STRING)
+  , len_(len) {
+  char* p = reinterpret_cast<char*>(this + 1);
+  memcpy(p, string, len);
+  p[len] = '\0';
 }
 
-Type String::getType() const  { return TT_STRING; }
-
 bool String::equal(const Object* target) const {
   const String* p = static_cast<const String*>(target);
   return len_ == p->len_ &&
-    memcmp(string_, p->string_, len_) == 0;
+    memcmp(c_str(), p->c_str(), len_) == 0;
 }
 
 unsigned int String::calcHash(State*) const {
   unsigned int v = 0;
-  for (const unsigned char* p = reinterpret_cast<const unsigned char*>(string_);
+  for (const unsigned char* p = reinterpret_cast<const unsigned char*>(c_str());
        *p != '\0'; ++p)
     v = v * 23 + 1 + *p;
   return v;
 }
 
 void String::output(State*, Stream* o, bool inspect) const {
+  const char* str = c_str();
   if (!inspect) {
-    o->write(string_, len_);
+    o->write(str, len_);
     return;
   }
 
   o->write('"');
   size_t prev = 0;
   for (size_t n = len_, i = 0; i < n; ++i) {
-    unsigned char c = reinterpret_cast<const unsigned char*>(string_)[i];
+    unsigned char c = reinterpret_cast<const unsigned char*>(str)[i];
     const char* s = NULL;
     char buffer[8];
     switch (c) {
@@ -182,19 +264,19 @@ void String::output(State*, Stream* o, bool inspect) const {
     }
 
     if (prev != i)
-      o->write(&string_[prev], i - prev);
+      o->write(&str[prev], i - prev);
     o->write(s);
     prev = i + 1;
   }
   if (prev != len_)
-    o->write(&string_[prev], len_ - prev);
+    o->write(&str[prev], len_ - prev);
   o->write('"');
 }
 
 //=============================================================================
 
 Vector::Vector(Allocator* allocator, int size)
-  : Object()
+  : Object(TT_VECTOR)
   , size_(size) {
   void* memory = allocator->alloc(sizeof(Value) * size_);
   buffer_ = new(memory) Value[size_];
@@ -204,11 +286,8 @@ Vector::Vector(Allocator* allocator, int size)
 
 void Vector::destruct(Allocator* allocator) {
   allocator->free(buffer_);
-  Object::destruct(allocator);
 }
 
-Type Vector::getType() const { return TT_VECTOR; }
-
 bool Vector::equal(const Object* target) const {
   const Vector* p = static_cast<const Vector*>(target);
   int n = size();
@@ -232,8 +311,7 @@ void Vector::output(State* state, Stream* o, bool inspect) const {
   o->write(')');
 }
 
-void Vector::mark() {
-  Object::mark();
+void Vector::trace() {
   for (int n = size_, i = 0; i < n; ++i)
     buffer_[i].mark();
 }
@@ -245,13 +323,15 @@ Value Vector::get(int index)  {
 
 void Vector::set(int index, Value x)  {
   assert(0 <= index && index < size_);
+  writeBarrier(x);
   buffer_[index] = x;
 }
 
 //=============================================================================
 
-SHashTable::SHashTable(Allocator* allocator, HashPolicy<Value>* policy)
-  : Object() {
+SHashTable::SHashTable(Allocator* allocator, HashPolicy<Value>* policy,
+                       State::Weakness weakness)
+  : Object(TT_HASH_TABLE), weakness_(weakness), readOnly_(false) {
   void* memory = allocator->alloc(sizeof(*table_));
   table_ = new(memory) TableType(policy, allocator);
 }
@@ -259,22 +339,41 @@ SHashTable::SHashTable(Allocator* allocator, HashPolicy<Value>* policy)
 void SHashTable::destruct(Allocator* allocator) {
   table_->~TableType();
   allocator->free(table_);
-  Object::destruct(allocator);
 }
 
-Type SHashTable::getType() const  { return TT_HASH_TABLE; }
-
 void SHashTable::output(State*, Stream* o, bool) const {
   char buffer[16 + sizeof(this) * 2];
   snprintf(buffer, sizeof(buffer), "#<table %p>", this);
   o->write(buffer);
 }
 
-void SHashTable::mark() {
-  Object::mark();
+static bool isWeakKey(State::Weakness weakness) {
+  return weakness == State::WEAK_KEY || weakness == State::WEAK_KEY_VALUE;
+}
+
+static bool isWeakValue(State::Weakness weakness) {
+  return weakness == State::WEAK_VALUE || weakness == State::WEAK_KEY_VALUE;
+}
+
+void SHashTable::trace() {
+  bool markKey = !isWeakKey(weakness_), markValue = !isWeakValue(weakness_);
   TableType& table = *table_;
-  for (auto kv : table)
-    const_cast<Value*>(&kv.value)->mark();
+  for (auto kv : table) {
+    if (markKey)
+      const_cast<Value*>(&kv.key)->mark();
+    if (markValue)
+      const_cast<Value*>(&kv.value)->mark();
+  }
+}
+
+// Removes entries whose weak key or value is going to be swept.
+void SHashTable::clearWeak() {
+  bool weakKey = isWeakKey(weakness_), weakValue = isWeakValue(weakness_);
+  if (!weakKey && !weakValue)
+    return;
+  table_->removeIf([weakKey, weakValue](Value key, Value value) {
+      return (weakKey && !key.isMarked()) || (weakValue && !value.isMarked());
+    });
 }
 
 int SHashTable::getCapacity() const  { return table_->getCapacity(); }
@@ -283,6 +382,10 @@ int SHashTable::getConflictCount() const  { return table_->getConflictCount(); }
 int SHashTable::getMaxDepth() const  { return table_->getMaxDepth(); }
 
 void SHashTable::put(Value key, Value value) {
+  if (!isWeakKey(weakness_))
+    writeBarrier(key);
+  if (!isWeakValue(weakness_))
+    writeBarrier(value);
   table_->put(key, value);
 }
 
@@ -295,21 +398,40 @@ bool SHashTable::remove(Value key) {
 }
 
 //=============================================================================
-Callable::Callable()
-  : Object()
-  , name_(NULL)  {}
 
-bool Callable::isCallable() const  { return true; }
+void WeakRef::output(State*, Stream* o, bool) const {
+  char buffer[20 + sizeof(this) * 2];
+  snprintf(buffer, sizeof(buffer), "#<weak-ref %p>", this);
+  o->write(buffer);
+}
+
+void WeakRef::clearWeak() {
+  if (!x_.isMarked())
+    x_ = Value::NIL;
+}
+
+//=============================================================================
+Callable::Callable(Type type)
+  : Object(type)
+  , name_(NULL)  {}
 
 void Callable::setName(const Symbol* name)  { name_ = name; }
 
 //=============================================================================
 // Closure class.
-Closure::Closure(State* state, Value body, int freeVarCount,
-                 int minArgNum, int maxArgNum)
-  : Callable()
-  , body_(body), freeVariables_(NULL), freeVarCount_(freeVarCount)
-  , minArgNum_(minArgNum), maxArgNum_(maxArgNum) {
+Closure::Closure(State* state, Value code, Value* body, int freeVarCount,
+                 int minArgNum, int maxArgNum, int stackDepth)
+  : Closure(TT_CLOSURE, state, code, body, freeVarCount, minArgNum, maxArgNum, stackDepth)  {}
+
+Closure::Closure(Type type, State* state, Value code, Value* body, int freeVarCount,
+                 int minArgNum, int maxArgNum, int stackDepth)
+  : Callable(type)
+  , code_(code), body_(body), freeVariables_(NULL), freeVarCount_(freeVarCount)
+  , minArgNum_(minArgNum), maxArgNum_(maxArgNum), stackDepth_(stackDepth)
+#ifdef ENABLE_JIT
+  , callCount_(0)
+#endif
+{
   if (freeVarCount > 0) {
     void* memory = state->alloc(sizeof(Value) * freeVarCount);
     freeVariables_ = new(memory) Value[freeVarCount];
@@ -319,11 +441,8 @@ Closure::Closure(State* state, Value body, int freeVarCount,
 void Closure::destruct(Allocator* allocator) {
   if (freeVariables_ != NULL)
     allocator->free(freeVariables_);
-  Callable::destruct(allocator);
 }
 
-Type Closure::getType() const  { return TT_CLOSURE; }
-
 void Closure::output(State*, Stream* o, bool) const {
   const char* name = "(noname)";
   if (name_ != NULL)
@@ -333,18 +452,17 @@ void Closure::output(State*, Stream* o, bool) const {
   o->write('>');
 }
 
-void Closure::mark() {
-  Callable::mark();
-  body_.mark();
+void Closure::trace() {
+  code_.mark();
   for (int n = freeVarCount_, i = 0; i < n; ++i)
     freeVariables_[i].mark();
 }
 
 //=============================================================================
 
-Macro::Macro(State* state, Value name, Value body, int freeVarCount,
-      int minArgNum, int maxArgNum)
-  : Closure(state, body, freeVarCount, minArgNum, maxArgNum) {
+Macro::Macro(State* state, Value name, Value code, Value* body, int freeVarCount,
+      int minArgNum, int maxArgNum, int stackDepth)
+  : Closure(TT_MACRO, state, code, body, freeVarCount, minArgNum, maxArgNum, stackDepth) {
   setName(name.toSymbol(state));
 }
 
@@ -360,13 +478,11 @@ void Macro::output(State*, Stream* o, bool) const {
 //=============================================================================
 
 NativeFunc::NativeFunc(NativeFuncType func, int minArgNum, int maxArgNum)
-  : Callable()
+  : Callable(TT_NATIVEFUNC)
   , func_(func)
   , minArgNum_(minArgNum)
   , maxArgNum_(maxArgNum) {}
 
-Type NativeFunc::getType() const  { return TT_NATIVEFUNC; }
-
 void NativeFunc::output(State*, Stream* o, bool) const {
   const char* name = "(noname)";
   if (name_ != NULL)
@@ -379,7 +495,7 @@ void NativeFunc::output(State*, Stream* o, bool) const {
 //=============================================================================
 Continuation::Continuation(State* state, const Value* stack, int size,
                            const CallStack* callStack, int callStackSize)
-  : Callable(), copiedStack_(NULL), callStack_(NULL)
+  : Callable(TT_CONTINUATION), copiedStack_(NULL), callStack_(NULL)
   , stackSize_(0), callStackSize_(0) {
   if (size > 0) {
     copiedStack_ = static_cast<Value*>(state->alloc(sizeof(Value) * size));
@@ -400,41 +516,34 @@ void Continuation::destruct(Allocator* allocator) {
     allocator->free(callStack_);
   if (copiedStack_ != NULL)
     allocator->free(copiedStack_);
-  Callable::destruct(allocator);
 }
 
-Type Continuation::getType() const  { return TT_CONTINUATION; }
-
 void Continuation::output(State*, Stream* o, bool) const {
   char buffer[20 + sizeof(this) * 2];
   snprintf(buffer, sizeof(buffer), "#<continuation %p>", this);
   o->write(buffer);
 }
 
-void Continuation::mark() {
-  Callable::mark();
+void Continuation::trace() {
   for (int n = stackSize_, i = 0; i < n; ++i)
     copiedStack_[i].mark();
 }
 
 //=============================================================================
 SStream::SStream(Stream* stream)
-  : Object(), stream_(stream), save_(Value::NIL)  {}
+  : Object(TT_STREAM), stream_(stream), save_(Value::NIL)  {}
 
 SStream::SStream(Stream* stream, Value save)
-  : Object(), stream_(stream), save_(save)  {}
+  : Object(TT_STREAM), stream_(stream), save_(save)  {}
 
 void SStream::destruct(Allocator* allocator) {
   allocator->free(stream_);
 }
 
-void SStream::mark() {
-  Object::mark();
+void SStream::trace() {
   save_.mark();
 }
 
-Type SStream::getType() const  { return TT_STREAM; }
-
 void SStream::output(State*, Stream* o, bool) const {
   char buffer[16 + sizeof(this) * 2];
   snprintf(buffer, sizeof(buffer), "#<stream %p>", this);
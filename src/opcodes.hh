@@ -44,3 +44,9 @@ OP(LT)
 OP(LE)
 OP(GT)
 OP(GE)
+OP(LREF_PUSH)
+OP(CONST_PUSH)
+OP(GREF_APPLY)
+OP(LREF_TEST)
+OP(JMP)
+OP(JIT)
@@ -0,0 +1,240 @@
+//=============================================================================
+/// Profiler - Sampling profiler for VM.
+//=============================================================================
+
+#include "build_env.hh"
+#include "profiler.hh"
+#include "allocator.hh"
+#include "symbol_manager.hh"
+#include "vm.hh"
+#include "yalp/object.hh"
+#include "yalp/stream.hh"
+#include "yalp/util.hh"
+
+#include <algorithm>
+#include <string.h>  // for memset
+
+#ifndef _MSC_VER
+#include <sys/time.h>
+#endif
+
+namespace yalp {
+
+const int PROFILE_BUFFER_SIZE = 16384;  // Number of samples kept.
+const int PROFILE_MAX_DEPTH = 32;  // Innermost frames kept for a sample.
+
+struct Profiler::Sample {
+  int depth;
+  bool truncated;  // Outer frames are dropped.
+  const Symbol* names[PROFILE_MAX_DEPTH];  // Root first, NULL for no name.
+};
+
+volatile sig_atomic_t Profiler::requested_;
+Profiler* Profiler::running_;
+
+#ifndef _MSC_VER
+static struct sigaction oldAction;
+#endif
+
+static const char* getName(const Symbol* name) {
+  return name != NULL ? name->c_str() : "(noname)";
+}
+
+Profiler* Profiler::create(State* state) {
+  void* memory = state->alloc(sizeof(Profiler));
+  return new(memory) Profiler(state);
+}
+
+void Profiler::release() {
+  State* state = state_;
+  this->~Profiler();
+  state->free(this);
+}
+
+Profiler::Profiler(State* state)
+  : state_(state), samples_(NULL), head_(0), count_(0) {
+}
+
+Profiler::~Profiler() {
+  stop();
+  if (samples_ != NULL)
+    state_->free(samples_);
+}
+
+bool Profiler::start(int intervalUsec) {
+#ifdef _MSC_VER
+  (void)intervalUsec;
+  return false;
+#else
+  if (running_ != NULL)
+    return false;
+
+  if (samples_ == NULL)
+    samples_ = static_cast<Sample*>(state_->alloc(sizeof(Sample) * PROFILE_BUFFER_SIZE));
+  head_ = count_ = 0;
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, &oldAction) != 0)
+    return false;
+
+  struct itimerval timer;
+  timer.it_interval.tv_sec = intervalUsec / 1000000;
+  timer.it_interval.tv_usec = intervalUsec % 1000000;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, NULL) != 0) {
+    sigaction(SIGPROF, &oldAction, NULL);
+    return false;
+  }
+  requested_ = 0;
+  running_ = this;
+  return true;
+#endif
+}
+
+void Profiler::stop() {
+#ifndef _MSC_VER
+  if (running_ != this)
+    return;
+
+  struct itimerval timer;
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, NULL);
+  sigaction(SIGPROF, &oldAction, NULL);
+  requested_ = 0;
+  running_ = NULL;
+#endif
+}
+
+void Profiler::onSignal(int) {
+  // Only raises the flag: VM state might be inconsistent here.
+  requested_ = 1;
+}
+
+void Profiler::sample(int depth, const CallStack* callStack) {
+  requested_ = 0;
+  if (running_ != this || depth <= 0)
+    return;
+
+  Sample* sample = &samples_[head_];
+  int n = depth < PROFILE_MAX_DEPTH ? depth : PROFILE_MAX_DEPTH;
+  int offset = depth - n;
+  for (int i = 0; i < n; ++i)
+    sample->names[i] = callStack[offset + i].callable->getName();
+  sample->depth = n;
+  sample->truncated = offset > 0;
+
+  head_ = (head_ + 1) % PROFILE_BUFFER_SIZE;
+  if (count_ < PROFILE_BUFFER_SIZE)
+    ++count_;
+}
+
+// Orders samples by their frames, to gather same stacks.
+bool Profiler::lessSample(const Sample* a, const Sample* b) {
+  if (a->truncated != b->truncated)
+    return a->truncated < b->truncated;
+  for (int i = 0; i < a->depth && i < b->depth; ++i) {
+    if (a->names[i] != b->names[i])
+      return a->names[i] < b->names[i];
+  }
+  return a->depth < b->depth;
+}
+
+const Profiler::Sample* Profiler::getSample(int i) const {
+  // Oldest first.
+  int index = (head_ - count_ + i + PROFILE_BUFFER_SIZE) % PROFILE_BUFFER_SIZE;
+  return &samples_[index];
+}
+
+// Stores samples into the array, sorted to gather same stacks.
+int Profiler::collectSamples(const Sample** samples) const {
+  for (int i = 0; i < count_; ++i)
+    samples[i] = getSample(i);
+  std::sort(samples, samples + count_, lessSample);
+  return count_;
+}
+
+void Profiler::outputCollapsed(Stream* o) const {
+  if (count_ == 0)
+    return;
+
+  const Sample** samples = static_cast<const Sample**>(state_->alloc(sizeof(Sample*) * count_));
+  int n = collectSamples(samples);
+  for (int i = 0; i < n; ) {
+    const Sample* sample = samples[i];
+    int j = i + 1;
+    while (j < n && !lessSample(sample, samples[j]))
+      ++j;
+
+    if (sample->truncated)
+      o->write("...;");
+    for (int k = 0; k < sample->depth; ++k) {
+      if (k > 0)
+        o->write(';');
+      o->write(getName(sample->names[k]));
+    }
+    format(state_, o, " %d\n", j - i);
+    i = j;
+  }
+  state_->free(samples);
+}
+
+// Counts samples for each leaf function into the buffer (`count_` entries),
+// in ascending order of count. Returns the number of functions.
+int Profiler::countLeaves(LeafCount* counts) const {
+  for (int i = 0; i < count_; ++i) {
+    const Sample* sample = getSample(i);
+    counts[i] = LeafCount(0, sample->names[sample->depth - 1]);
+  }
+  std::sort(counts, counts + count_);
+
+  int n = 0;
+  for (int i = 0; i < count_; ) {
+    int j = i + 1;
+    while (j < count_ && counts[j].second == counts[i].second)
+      ++j;
+    counts[n++] = LeafCount(j - i, counts[i].second);
+    i = j;
+  }
+  std::sort(counts, counts + n);
+  return n;
+}
+
+Value Profiler::getCounts() const {
+  if (count_ == 0)
+    return Value::NIL;
+
+  // Allocating objects can raise error, and the buffer must not be held
+  // then: counts are copied into a vector, which is sized in first pass.
+  LeafCount* counts = static_cast<LeafCount*>(state_->alloc(sizeof(LeafCount) * count_));
+  int n = countLeaves(counts);
+  state_->free(counts);
+
+  int arena = state_->saveArena();
+  Allocator* allocator = state_->getAllocator();
+  Vector* vector = allocator->newObject<Vector>(allocator, n * 2);
+  counts = static_cast<LeafCount*>(state_->alloc(sizeof(LeafCount) * count_));
+  countLeaves(counts);
+  for (int i = 0; i < n; ++i) {
+    // Symbol exists, so interning it doesn't allocate.
+    Value name = counts[i].second != NULL ? state_->intern(counts[i].second->c_str()) : Value::NIL;
+    vector->set(i * 2, name);
+    vector->set(i * 2 + 1, Value(counts[i].first));
+  }
+  state_->free(counts);
+
+  // Ascending order, to be consed.
+  Value result = Value::NIL;
+  for (int i = 0; i < n; ++i) {
+    result = state_->cons(state_->cons(vector->get(i * 2), vector->get(i * 2 + 1)),
+                          result);
+    state_->restoreArenaWith(arena + 1, result);
+  }
+  state_->restoreArenaWith(arena, result);
+  return result;
+}
+
+}  // namespace yalp
@@ -0,0 +1,71 @@
+//=============================================================================
+/// Profiler - Sampling profiler for VM.
+/*
+ * Interval timer (SIGPROF) raises a request flag periodically, and VM
+ * takes a sample at the next function call or loop: the call stack at the
+ * point (names of callables) is recorded into a ring buffer, so the oldest
+ * samples are overwritten when it becomes full.
+ * Samples can be output as collapsed stacks (`root;...;leaf count`),
+ * which is the input format of flamegraph tools.
+ */
+//=============================================================================
+
+#ifndef _PROFILER_HH_
+#define _PROFILER_HH_
+
+#include "yalp.hh"
+#include <utility>  // for pair
+#include <signal.h>
+
+namespace yalp {
+
+class CallStack;
+class Symbol;
+
+class Profiler {
+public:
+  static Profiler* create(State* state);
+  void release();
+
+  // Starts sampling, clears previous samples.
+  // Returns false if not supported, or another profiler is running.
+  bool start(int intervalUsec);
+  void stop();
+  bool isRunning() const  { return running_ == this; }
+
+  // Whether timer requests a sample.
+  static bool isRequested()  { return requested_ != 0; }
+  static const volatile sig_atomic_t* getRequestFlag()  { return &requested_; }
+  void sample(int depth, const CallStack* callStack);
+
+  // Outputs samples as collapsed stacks.
+  void outputCollapsed(Stream* o) const;
+  // Returns sample counts for each leaf function: ((name . count) ...),
+  // in descending order of count.
+  Value getCounts() const;
+
+private:
+  struct Sample;
+  typedef std::pair<int, const Symbol*> LeafCount;
+
+  Profiler(State* state);
+  ~Profiler();
+
+  static void onSignal(int sig);
+  static bool lessSample(const Sample* a, const Sample* b);
+  const Sample* getSample(int i) const;
+  int collectSamples(const Sample** samples) const;
+  int countLeaves(LeafCount* counts) const;
+
+  static volatile sig_atomic_t requested_;
+  static Profiler* running_;
+
+  State* state_;
+  Sample* samples_;  // Ring buffer.
+  int head_;   // Next index to write.
+  int count_;
+};
+
+}  // namespace yalp
+
+#endif
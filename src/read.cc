@@ -7,6 +7,7 @@
 #include "yalp/object.hh"
 #include "yalp/stream.hh"
 #include "yalp/util.hh"
+#include "allocator.hh"
 #include "hash_table.hh"
 
 #include <ctype.h>  // for isdigit
@@ -73,6 +74,18 @@ Reader::~Reader() {
   }
 }
 
+// Calls macro function with a stream object for the reader as the first
+// argument: the object refers the stream, but doesn't own it.
+bool Reader::callMacro(Value fn, int argNum, Value* args, Value* pValue) {
+  int arena = state_->saveArena();
+  SStream* ss = state_->getAllocator()->newObject<SStream>(stream_);
+  args[0] = Value(ss);
+  bool result = state_->funcall(fn, argNum, args, pValue);
+  ss->stream_ = NULL;
+  state_->restoreArena(arena);
+  return result;
+}
+
 ErrorCode Reader::read(Value* pValue) {
   skipSpaces();
   lineNo_ = stream_->getLineNumber();
@@ -89,9 +102,8 @@ ErrorCode Reader::read(Value* pValue) {
   Value fn = state_->getMacroCharacter(c);
   if (fn.isTrue()) {
     if (fn.getType() != TT_HASH_TABLE) {  // Single macro character.
-      SStream ss(stream_);
-      Value args[] = { Value(&ss), state_->character(c) };
-      if (!state_->funcall(fn, sizeof(args) / sizeof(*args), args, pValue))
+      Value args[] = { Value::NIL, state_->character(c) };
+      if (!callMacro(fn, sizeof(args) / sizeof(*args), args, pValue))
         return ILLEGAL_CHAR;
       if (state_->getResultNum() == 0)
         return read(pValue);
@@ -101,9 +113,8 @@ ErrorCode Reader::read(Value* pValue) {
     int c2 = getc();
     fn = state_->getDispatchMacroCharacter(c, c2);
     if (fn.isTrue()) {
-      SStream ss(stream_);
-      Value args[] = { Value(&ss), state_->character(c), state_->character(c2) };
-      if (state_->funcall(fn, sizeof(args) / sizeof(*args), args, pValue)) {
+      Value args[] = { Value::NIL, state_->character(c), state_->character(c2) };
+      if (callMacro(fn, sizeof(args) / sizeof(*args), args, pValue)) {
         if (state_->getResultNum() == 0)
           return read(pValue);
         return SUCCESS;
@@ -8,14 +8,17 @@
 #include "yalp/read.hh"
 #include "yalp/stream.hh"
 #include "yalp/util.hh"
+#include "alloc_profiler.hh"
 #include "basic.hh"
 #include "flonum.hh"
+#include "profiler.hh"
 #include "symbol_manager.hh"
 #include "sys.hh"
 #include "vm.hh"
 
 #include <assert.h>
-#include <string.h>  // for strlen
+#include <stdint.h>
+#include <string.h>  // for memcpy, strlen
 
 namespace yalp {
 
@@ -26,6 +29,8 @@ namespace yalp {
     XXXXXX00 : Object
     XXXX0010 : Symbol
     XXXX0110 : Character
+    XXXX1010 : Flonum (IMMEDIATE_FLONUM): float in upper 32 bits, or
+               double whose lowest 4 bits of mantissa are zero.
  */
 
 #define TAG2_TYPE(x)  (((x) << TAG_SHIFT) | TAG_OTHER)
@@ -33,6 +38,7 @@ const Fixnum TAG2_SHIFT = 4;
 const Fixnum TAG2_MASK = (1 << TAG2_SHIFT) - 1;
 const Fixnum TAG2_SYMBOL = TAG2_TYPE(0);
 const Fixnum TAG2_CHAR = TAG2_TYPE(1);
+const Fixnum TAG2_FLONUM = TAG2_TYPE(2);
 
 // Assumes that first symbol is nil.
 const Value Value::NIL = Value(0, TAG2_SYMBOL);
@@ -40,6 +46,39 @@ const Value Value::NIL = Value(0, TAG2_SYMBOL);
 Value::Value(Fixnum i, int tag2)
   : v_((i << TAG2_SHIFT) | tag2) {}
 
+#ifdef IMMEDIATE_FLONUM
+static_assert(sizeof(Fixnum) == 8, "IMMEDIATE_FLONUM needs 64-bit Value");
+
+bool Value::immediateFlonum(Flonum f, Value* pValue) {
+#ifdef USE_FLOAT
+  uint64_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  if ((bits & TAG2_MASK) != 0)
+    return false;  // Needs full precision.
+#else
+  uint32_t fbits;
+  memcpy(&fbits, &f, sizeof(fbits));
+  uint64_t bits = static_cast<uint64_t>(fbits) << 32;
+#endif
+  pValue->v_ = static_cast<Fixnum>(bits | TAG2_FLONUM);
+  return true;
+}
+
+Flonum Value::getImmediateFlonum() const {
+  assert((v_ & TAG2_MASK) == TAG2_FLONUM);
+  uint64_t bits = static_cast<uint64_t>(v_);
+  Flonum f;
+#ifdef USE_FLOAT
+  bits &= ~static_cast<uint64_t>(TAG2_MASK);
+  memcpy(&f, &bits, sizeof(f));
+#else
+  uint32_t fbits = static_cast<uint32_t>(bits >> 32);
+  memcpy(&f, &fbits, sizeof(f));
+#endif
+  return f;
+}
+#endif
+
 Type Value::getType() const {
   if (isFixnum())
     return TT_FIXNUM;
@@ -53,6 +92,10 @@ Type Value::getType() const {
       return TT_SYMBOL;
     case TAG2_CHAR:
       return TT_CHAR;
+#ifdef IMMEDIATE_FLONUM
+    case TAG2_FLONUM:
+      return TT_FLONUM;
+#endif
     }
   }
   assert(!"Must not happen");
@@ -74,6 +117,16 @@ unsigned int Value::calcHash(State* state) const {
       return (v_ >> TAG2_SHIFT) * 29;
     case TAG2_CHAR:
       return (v_ >> TAG2_SHIFT) * 41;
+#ifdef IMMEDIATE_FLONUM
+    case TAG2_FLONUM:
+      {
+        Flonum f = getImmediateFlonum();
+        if (f == 0)
+          return 0;  // 0.0 and -0.0 are equal.
+        uint64_t bits = static_cast<uint64_t>(v_) >> TAG2_SHIFT;
+        return static_cast<unsigned int>(bits ^ (bits >> 32)) * 43;
+      }
+#endif
     }
   }
   assert(!"Must not happen");
@@ -81,10 +134,12 @@ unsigned int Value::calcHash(State* state) const {
 }
 
 void Value::mark() {
-  Object* obj;
-  if (!isObject() || (obj = toObject())->isMarked())
-    return;
-  obj->mark();
+  if (isObject())
+    toObject()->mark();
+}
+
+bool Value::isMarked() const {
+  return !isObject() || toObject()->isMarked();
 }
 
 void Value::output(State* state, Stream* o, bool inspect) const {
@@ -110,6 +165,15 @@ void Value::output(State* state, Stream* o, bool inspect) const {
     case TAG2_CHAR:
       outputCharacter(o, inspect);
       break;
+#ifdef IMMEDIATE_FLONUM
+    case TAG2_FLONUM:
+      {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%f", getImmediateFlonum());
+        o->write(buffer);
+      }
+      break;
+#endif
     }
   }
 }
@@ -179,6 +243,10 @@ void Value::outputCharacter(Stream* o, bool inspect) const {
 Flonum Value::toFlonum(State* state) const {
   switch (getType()) {
   case TT_FLONUM:
+#ifdef IMMEDIATE_FLONUM
+    if (!isObject())
+      return getImmediateFlonum();
+#endif
     return static_cast<SFlonum*>(toObject())->toFlonum();
   case TT_FIXNUM:
     return static_cast<Flonum>(toFixnum());
@@ -227,6 +295,12 @@ bool Value::equal(Value target) const {
     case TAG2_SYMBOL:
     case TAG2_CHAR:
       return false;
+#ifdef IMMEDIATE_FLONUM
+    case TAG2_FLONUM:
+      // Same value is always encoded in same way, but 0.0 equals -0.0.
+      return (target.v_ & TAG2_MASK) == TAG2_FLONUM &&
+          getImmediateFlonum() == target.getImmediateFlonum();
+#endif
     }
   }
   assert(!"Must not happen");
@@ -243,6 +317,16 @@ struct StateAllocatorCallback : public Allocator::Callback {
     State* state = static_cast<State*>(userdata);
     state->markRoot();
   }
+  virtual void gcFinished(const GcEvent& event, void* userdata) override {
+    State* state = static_cast<State*>(userdata);
+    if (state->gcCallback_ != NULL)
+      state->gcCallback_(state, &event, state->gcCallbackData_);
+  }
+  virtual void allocSampled(int typeTag, size_t bytes, void* userdata) override {
+    State* state = static_cast<State*>(userdata);
+    if (state->vm_ != NULL)
+      state->vm_->sampleAllocation(typeTag, bytes);
+  }
 };
 
 static StateAllocatorCallback stateAllocatorCallback;
@@ -272,7 +356,17 @@ State* State::create() {
 }
 
 State* State::create(AllocFunc allocFunc) {
-  Allocator* allocator = Allocator::create(allocFunc, &stateAllocatorCallback);
+  return create(allocFunc, 1);
+}
+
+State* State::create(AllocFunc allocFunc, int gcThreadNum) {
+  return create(allocFunc, gcThreadNum, 0);
+}
+
+State* State::create(AllocFunc allocFunc, int gcThreadNum, size_t heapBudget) {
+  Allocator* allocator = Allocator::create(allocFunc, &stateAllocatorCallback,
+                                           gcThreadNum);
+  allocator->setHeapBudget(heapBudget);
   void* memory = allocator->alloc(sizeof(State));
   return new(memory) State(allocator);
 }
@@ -290,7 +384,8 @@ State::State(Allocator* allocator)
   , hashPolicyEq_(new(allocator_->alloc(sizeof(*hashPolicyEq_))) HashPolicyEq(this))
   , hashPolicyEqual_(new(allocator_->alloc(sizeof(*hashPolicyEqual_))) HashPolicyEqual(this))
   , readTable_(NULL), vm_(NULL), jmp_(NULL)
-  , gensymIndex_(0) {
+  , gensymIndex_(0), outOfMemory_(false)
+  , gcCallback_(NULL), gcCallbackData_(NULL) {
   int arena = saveArena();
   allocator->setUserData(this);
 
@@ -307,7 +402,7 @@ State::State(Allocator* allocator)
     "flonum",
 #endif
     "closure", "subr", "continuation", "vector", "table", "stream", "macro",
-    "box",
+    "weak-ref", "box", "code", "global",
   };
   for (int i = 0; i < NUMBER_OF_TYPES; ++i)
     typeSymbols_[i] = intern(TypeSymbolStrings[i]);
@@ -407,9 +502,9 @@ ErrorCode State::run(Stream* stream, Value* pResult) {
     }
     Value code;
     if (!compile(exp, &code) || code.isFalse())
-      return COMPILE_ERROR;
+      return runFailed(COMPILE_ERROR, arena);
     if (!runBinary(code, pResult))
-      return RUNTIME_ERROR;
+      return runFailed(RUNTIME_ERROR, arena);
     allocator_->restoreArena(arena);
   }
 }
@@ -439,7 +534,7 @@ ErrorCode State::runBinary(Stream* stream, Value* pResult) {
       return err;
     }
     if (!runBinary(bin, pResult))
-      return RUNTIME_ERROR;
+      return runFailed(RUNTIME_ERROR, arena);
     allocator_->restoreArena(arena);
   }
 }
@@ -486,13 +581,22 @@ Value State::character(int c) const {
   return Value(c, TAG2_CHAR);
 }
 
-SHashTable* State::createHashTable(bool equal) {
+SHashTable* State::createHashTable(bool equal, Weakness weakness) {
   HashPolicy<Value>* policy;
   if (equal)
     policy = hashPolicyEqual_;
   else
     policy = hashPolicyEq_;
-  return allocator_->newObject<SHashTable>(allocator_, policy);
+  SHashTable* table = allocator_->newObject<SHashTable>(allocator_, policy, weakness);
+  if (weakness != NOT_WEAK)
+    allocator_->addWeakObject(table);
+  return table;
+}
+
+Value State::createWeakRef(Value v) {
+  WeakRef* ref = allocator_->newObject<WeakRef>(v);
+  allocator_->addWeakObject(ref);
+  return Value(ref);
 }
 
 Value State::string(const char* str) {
@@ -500,15 +604,13 @@ Value State::string(const char* str) {
 }
 
 Value State::string(const char* str, size_t len) {
-  void* stringBuffer = allocator_->alloc(sizeof(char) * (len + 1));
-  char* copiedString = new(stringBuffer) char[len + 1];
-  memcpy(copiedString, str, len);
-  copiedString[len] = '\0';
-  return allocatedString(copiedString, len);
+  return Value(allocator_->newSizedObject<String>(String::getAllocSize(len), str, len));
 }
 
 Value State::allocatedString(const char* str, size_t len) {
-  return Value(allocator_->newObject<String>(str, len));
+  Value s = string(str, len);
+  allocator_->free(const_cast<char*>(str));
+  return s;
 }
 
 Value State::createFileStream(FILE* fp) {
@@ -558,6 +660,10 @@ void State::restoreArenaWith(int index, Value v) {
   else
     allocator_->restoreArena(index);
 }
+void State::pushArena(Value v) {
+  if (v.isObject())
+    allocator_->pushArena(v.toObject());
+}
 
 void State::runtimeError(const char* msg, ...) {
   FileStream errout(stderr);
@@ -684,17 +790,97 @@ void State::collectGarbage() {
   allocator_->collectGarbage();
 }
 
+void State::setGcStepSize(int size) {
+  allocator_->setGcStepSize(size);
+}
+
+void State::setGcGrowthFactor(double factor) {
+  allocator_->setGcGrowthFactor(factor);
+}
+
+void State::setGcHeapLimit(size_t limit) {
+  allocator_->setGcHeapLimit(limit);
+}
+
+size_t State::getHeapBytes() const {
+  return allocator_->getHeapBytes();
+}
+
+void State::getGcStats(GcStats* stats) const {
+  allocator_->getGcStats(stats);
+}
+
+void State::setGcCallback(GcCallback callback, void* userdata) {
+  gcCallback_ = callback;
+  gcCallbackData_ = userdata;
+}
+
 void State::setVmTrace(bool b) {
   vm_->setTrace(b);
 }
 
+bool State::startProfile() {
+  return vm_->startProfile();
+}
+
+void State::stopProfile() {
+  vm_->stopProfile();
+}
+
+void State::outputProfile(Stream* o) const {
+  const Profiler* profiler = vm_->getProfiler();
+  if (profiler != NULL)
+    profiler->outputCollapsed(o);
+}
+
+Value State::getProfileCounts() {
+  const Profiler* profiler = vm_->getProfiler();
+  return profiler != NULL ? profiler->getCounts() : Value::NIL;
+}
+
+void State::startAllocProfile(int interval) {
+  vm_->startAllocProfile(interval);
+}
+
+void State::stopAllocProfile() {
+  vm_->stopAllocProfile();
+}
+
+void State::outputAllocProfile(Stream* o) const {
+  const AllocProfiler* profiler = vm_->getAllocProfiler();
+  if (profiler != NULL)
+    profiler->output(o);
+}
+
+Value State::getAllocProfileCounts() {
+  const AllocProfiler* profiler = vm_->getAllocProfiler();
+  return profiler != NULL ? profiler->getCounts() : Value::NIL;
+}
+
 void State::markRoot() {
-  readTable_->mark();
-  vm_->markRoot();
+  // GC might run while constructing.
+  if (readTable_ != NULL)
+    readTable_->mark();
+  if (vm_ != NULL)
+    vm_->markRoot();
 }
 
 void State::allocFailed(void*, size_t) {
-  runtimeError("allocFailed");
+  if (jmp_ == NULL)
+    return;  // Can't raise, allocation goes over budget.
+  outOfMemory_ = true;
+  allocator_->discardConstructing();
+  runtimeError("Out of memory");
+}
+
+// Releases objects allocated in the failed run.
+ErrorCode State::runFailed(ErrorCode err, int arena) {
+  allocator_->restoreArena(arena);
+  if (outOfMemory_) {
+    outOfMemory_ = false;
+    return OUT_OF_MEMORY;
+  }
+  return err;
 }
 
 void State::reportDebugInfo() const {
@@ -27,6 +27,82 @@ static Value s_gettimeofday(State* state) {
   return state->multiValues(Value(tv.tv_sec), Value(tv.tv_usec));
 }
 
+// Starts sampling profiler.
+static Value s_profileStart(State* state) {
+  if (!state->startProfile())
+    state->runtimeError("Can't start profiler");
+  return Value::NIL;
+}
+
+// Stops sampling profiler, and returns sample counts for each function.
+static Value s_profileStop(State* state) {
+  state->stopProfile();
+  return state->getProfileCounts();
+}
+
+// ((type objects . bytes) ...), for types which have objects.
+static Value typeCounts(State* state, const size_t* objects, const size_t* bytes) {
+  Value result = Value::NIL;
+  for (int i = NUMBER_OF_TYPES; --i >= 0; ) {
+    if (objects[i] == 0)
+      continue;
+    Value counts = state->cons(Value(static_cast<Fixnum>(objects[i])),
+                               Value(static_cast<Fixnum>(bytes[i])));
+    result = state->cons(state->cons(state->getTypeSymbol(static_cast<Type>(i)), counts),
+                         result);
+  }
+  return result;
+}
+
+// Returns GC statistics as an association list, see `GcStats`.
+static Value s_gcStats(State* state) {
+  GcStats stats;
+  state->getGcStats(&stats);
+
+  Value histogram = Value::NIL;
+  for (int i = GcStats::PAUSE_BUCKETS; --i >= 0; )
+    histogram = state->cons(Value(stats.pauseHistogram[i]), histogram);
+  struct {
+    const char* key;
+    Value value;
+  } const entries[] = {
+    { "minor-gc", Value(stats.minorCount) },
+    { "full-gc", Value(stats.fullCount) },
+    { "gc-steps", Value(stats.stepCount) },
+    { "pause-total", Value(stats.totalPauseUsec) },
+    { "pause-max", Value(stats.maxPauseUsec) },
+    { "pause-histogram", histogram },
+    { "heap-bytes", Value(static_cast<Fixnum>(stats.heapBytes)) },
+    { "allocated-bytes", Value(static_cast<Fixnum>(stats.totalAllocatedBytes)) },
+    { "allocation-rate", Value(static_cast<Fixnum>(stats.allocationRate)) },
+    { "allocated", typeCounts(state, stats.allocatedObjects, stats.allocatedBytes) },
+    { "live", typeCounts(state, stats.liveObjects, stats.liveBytes) },
+  };
+
+  Value result = Value::NIL;
+  for (int i = sizeof(entries) / sizeof(*entries); --i >= 0; )
+    result = state->cons(state->cons(state->intern(entries[i].key), entries[i].value), result);
+  return result;
+}
+
+// Starts allocation profiler, with optional sampling interval.
+static Value s_allocProfileStart(State* state) {
+  int interval = ALLOC_PROFILE_INTERVAL;
+  if (state->getArgNum() > 0) {
+    Value v = state->getArg(0);
+    state->checkType(v, TT_FIXNUM);
+    interval = v.toFixnum();
+  }
+  state->startAllocProfile(interval);
+  return Value::NIL;
+}
+
+// Stops allocation profiler, and returns counts for each site.
+static Value s_allocProfileStop(State* state) {
+  state->stopAllocProfile();
+  return state->getAllocProfileCounts();
+}
+
 void installSystemFunctions(State* state) {
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
   struct {
@@ -35,6 +111,11 @@ void installSystemFunctions(State* state) {
     int minArgNum, maxArgNum;
   } static const FuncTable[] = {
     { "gettimeofday", s_gettimeofday, 0 },
+    { "profile-start", s_profileStart, 0 },
+    { "profile-stop", s_profileStop, 0 },
+    { "alloc-profile-start", s_allocProfileStart, 0, 1 },
+    { "alloc-profile-stop", s_allocProfileStop, 0 },
+    { "gc-stats", s_gcStats, 0 },
   };
 
   for (auto it : FuncTable) {
@@ -5,6 +5,10 @@
 #include "build_env.hh"
 #include "vm.hh"
 #include "allocator.hh"
+#include "alloc_profiler.hh"
+#include "jit.hh"
+#include "linker.hh"
+#include "profiler.hh"
 #include "yalp/object.hh"
 #include "yalp/stream.hh"
 #include "yalp/util.hh"
@@ -18,13 +22,25 @@
 #include <iostream>
 #include <string.h>  // for memcpy, memmove
 
+#if defined(COUNT_OPCODE_SEQUENCE) || defined(LAZY_CALL_STACK)
+#include <algorithm>  // for sort, reverse
+#endif
+
+#ifdef ENABLE_JIT
+#include <functional>  // for less, greater
+#endif
+
 #ifdef __GNUC__
 #define DIRECT_THREADED
 #endif
 
 #define OPCVAL(op)  (Value(op))
 
-#define FETCH_OP  (x = CDR(x_), CAR(x_).toFixnum())
+#ifdef COUNT_OPCODE_SEQUENCE
+#define FETCH_OP  (x = x_ + 1, opcodeCounter_->count(x_->toFixnum()))
+#else
+#define FETCH_OP  (x = x_ + 1, x_->toFixnum())
+#endif
 
 #ifdef DIRECT_THREADED
 #define INIT_DISPATCH  NEXT;
@@ -44,25 +60,18 @@
 #define VMTRACE                                                         \
   if (trace_) {                                                         \
     FileStream out(stdout);                                             \
-    Value op = car(x_), d = car(cdr(x_));                               \
-    if (d.getType() == TT_CELL) d = Value::NIL;                         \
-    format(state_, &out, "run: s=%d, f=%d, x=%s %@\n", s_, f_, OpcodeNameTable[op.toFixnum()], &d); \
+    int op = x_->toFixnum(), operandNum = 0;                            \
+    if (op != JMP && op != JIT)                                         \
+      getLayout(op, &operandNum);                                       \
+    Value d = operandNum > 0 ? x_[1] : Value::NIL;                      \
+    format(state_, &out, "run: s=%d, f=%d, x=%s %@\n", s_, f_, OpcodeNameTable[op], &d); \
   }                                                                     \
 
 namespace yalp {
 
-const int STACK_EXPAND_SIZE = 16;
-
 //=============================================================================
 
-enum Opcode {
-#define OP(name)  name,
-# include "opcodes.hh"
-#undef OP
-  NUMBER_OF_OPCODE
-};
-
-#ifndef DIRECT_THREADED
+#if !defined(DIRECT_THREADED) || defined(COUNT_OPCODE_SEQUENCE)
 static const char* OpcodeNameTable[NUMBER_OF_OPCODE] = {
 #define OP(name)  #name,
 # include "opcodes.hh"
@@ -70,13 +79,87 @@ static const char* OpcodeNameTable[NUMBER_OF_OPCODE] = {
 };
 #endif
 
+#ifdef COUNT_OPCODE_SEQUENCE
+// Counts executed opcode sequences, to find superinstruction candidates.
+class OpcodeCounter {
+public:
+  static const int N = NUMBER_OF_OPCODE;
+
+  OpcodeCounter() : prev1_(N), prev2_(N) {
+    memset(pairs_, 0, sizeof(pairs_));
+    memset(triples_, 0, sizeof(triples_));
+  }
+
+  int count(int op) {
+    if (prev1_ < N) {
+      ++pairs_[prev1_][op];
+      if (prev2_ < N)
+        ++triples_[prev2_][prev1_][op];
+    }
+    prev2_ = prev1_;
+    prev1_ = op;
+    return op;
+  }
+
+  void report(int n) const {
+    std::vector<std::pair<long, int> > v;
+    for (int i = 0; i < N * N; ++i)
+      if (pairs_[i / N][i % N] > 0)
+        v.push_back(std::make_pair(pairs_[i / N][i % N], i));
+    std::sort(v.rbegin(), v.rend());
+    std::cout << "Opcode pairs:" << std::endl;
+    for (int i = 0; i < n && i < static_cast<int>(v.size()); ++i)
+      std::cout << "  " << v[i].first << "\t" << OpcodeNameTable[v[i].second / N]
+                << " " << OpcodeNameTable[v[i].second % N] << std::endl;
+
+    v.clear();
+    for (int i = 0; i < N * N * N; ++i)
+      if (triples_[i / (N * N)][i / N % N][i % N] > 0)
+        v.push_back(std::make_pair(triples_[i / (N * N)][i / N % N][i % N], i));
+    std::sort(v.rbegin(), v.rend());
+    std::cout << "Opcode triples:" << std::endl;
+    for (int i = 0; i < n && i < static_cast<int>(v.size()); ++i)
+      std::cout << "  " << v[i].first << "\t" << OpcodeNameTable[v[i].second / (N * N)]
+                << " " << OpcodeNameTable[v[i].second / N % N]
+                << " " << OpcodeNameTable[v[i].second % N] << std::endl;
+  }
+
+private:
+  long pairs_[N][N];
+  long triples_[N][N][N];
+  int prev1_, prev2_;
+};
+#endif
+
 #define CELL(x)  (static_cast<Cell*>(x.toObject()))
 #define CAR(x)  (CELL(x)->car())
 #define CDR(x)  (CELL(x)->cdr())
 #define CADR(x)  (CAR(CDR(x)))
 
-// Watch out! You must use in form: `Value n = POP(x);`
-#define POP(x)  CELL(x)->car(); x = CELL(x)->cdr()
+#define POP(x)  (*(x)++)
+
+// Return address is stored in stack as fixnum, so GC doesn't follow it.
+// Linked code is kept alive by the closure stored in the same frame.
+static inline Value encodeAddress(const Value* p) {
+  return Value(reinterpret_cast<Fixnum>(p) >> 1);
+}
+static inline Value* decodeAddress(Value v) {
+  return reinterpret_cast<Value*>(v.toFixnum() << 1);
+}
+
+static inline Value referGlobalCell(State* state, Value cell) {
+  GlobalCell* p = static_cast<GlobalCell*>(cell.toObject());
+  if (!p->isBound()) {
+    Value sym = p->getSymbol();
+    state->runtimeError("Unbound `%@`", &sym);
+  }
+  return p->get();
+}
+
+// Reads jump operand.
+static inline Value* popJumpTarget(Value*& x) {
+  return getJumpTarget(x++);
+}
 
 static inline void moveStackElems(Value* stack, int dst, int src, int n) {
   if (n > 0)
@@ -102,21 +185,27 @@ static bool checkArgNum(State* state, Value fn, int argNum, int min, int max) {
   return true;
 }
 
-class Box : public Object {
-public:
-  Box(Value x) : Object(), x_(x) {}
-  virtual Type getType() const override  { return TT_BOX; }
-  void set(Value x)  { x_ = x; }
-  Value get()  { return x_; }
-  virtual void output(State* state, Stream* o, bool inspect) const override {
-    // This should not be output, but debug purpose.
-    o->write("#<box ");
-    x_.output(state, o, inspect);
-    o->write('>');
-  }
-protected:
-  Value x_;
-};
+void GlobalCell::output(State* state, Stream* o, bool inspect) const {
+  // This should not be output, but debug purpose.
+  o->write("#<global ");
+  sym_.output(state, o, inspect);
+  o->write('>');
+}
+
+void Box::output(State* state, Stream* o, bool inspect) const {
+  // This should not be output, but debug purpose.
+  o->write("#<box ");
+  x_.output(state, o, inspect);
+  o->write('>');
+}
+
+void Box::trace() {
+  x_.mark();
+}
+
+void GlobalCell::trace() {
+  value_.mark();
+}
 
 //=============================================================================
 // Embedded opcode.
@@ -139,6 +228,65 @@ protected:
     a_ = callEmbedFunction(func, n.toFixnum()); \
   } NEXT
 
+// Calculates two fixnums inline, otherwise calls embedded function.
+#define FIXNUM_BINOP_INST(OP, Op, func)                 \
+  CASE(OP) {                                            \
+    Value n = POP(x);                                   \
+    x_ = x;                                             \
+    if (n.toFixnum() == 2) {                            \
+      Value a = index(s_, 0), b = index(s_, 1);         \
+      Fixnum r;                                         \
+      if (a.isFixnum() && b.isFixnum() &&               \
+          Op::calc(a.toFixnum(), b.toFixnum(), &r)) {   \
+        a_ = Value(r);                                  \
+        s_ -= 2;                                        \
+        NEXT;                                           \
+      }                                                 \
+    }                                                   \
+    a_ = callEmbedFunction(func, n.toFixnum());         \
+  } NEXT
+
+#define FIXNUM_COMPARE_INST(OP, op, func)                       \
+  CASE(OP) {                                                    \
+    Value n = POP(x);                                           \
+    x_ = x;                                                     \
+    if (n.toFixnum() == 2) {                                    \
+      Value a = index(s_, 0), b = index(s_, 1);                 \
+      if (a.isFixnum() && b.isFixnum()) {                       \
+        a_ = state_->boolean(a.toFixnum() op b.toFixnum());     \
+        s_ -= 2;                                                \
+        NEXT;                                                   \
+      }                                                         \
+    }                                                           \
+    a_ = callEmbedFunction(func, n.toFixnum());                 \
+  } NEXT
+
+const Fixnum FIXNUM_MAX = (static_cast<Fixnum>(1) << (sizeof(Fixnum) * 8 - 2)) - 1;
+const Fixnum FIXNUM_MIN = -FIXNUM_MAX - 1;
+
+static inline bool isFixnumRange(Fixnum x)  { return FIXNUM_MIN <= x && x <= FIXNUM_MAX; }
+
+// Fixnum operations: return false if the result overflows.
+struct FixnumAdd {
+  static bool calc(Fixnum x, Fixnum y, Fixnum* r)  { *r = x + y; return isFixnumRange(*r); }
+};
+struct FixnumSub {
+  static bool calc(Fixnum x, Fixnum y, Fixnum* r)  { *r = x - y; return isFixnumRange(*r); }
+};
+struct FixnumMul {
+  static bool calc(Fixnum x, Fixnum y, Fixnum* r) {
+#ifdef __GNUC__
+    return !__builtin_mul_overflow(x, y, r) && isFixnumRange(*r);
+#else
+    const Fixnum LIMIT = static_cast<Fixnum>(1) << (sizeof(Fixnum) * 4 - 1);
+    if (x <= -LIMIT || LIMIT <= x || y <= -LIMIT || LIMIT <= y)
+      return false;
+    *r = x * y;
+    return isFixnumRange(*r);
+#endif
+  }
+};
+
 template <class Op>
 struct UnaryOp {
   static Value calc(State* state, Value a) {
@@ -169,8 +317,14 @@ struct Inv {
 Value Vm::callEmbedFunction(NativeFuncType func, Fixnum n) {
   int oldF = f_;
   f_ = s_;
-  s_ = push(Value(n), s_);
+  s_ = pushReserved(Value(n), s_);
+#ifdef LAZY_CALL_STACK
+  embedCallerF_ = oldF;
+  Value a = (*func)(state_);
+  embedCallerF_ = -1;
+#else
   Value a = (*func)(state_);
+#endif
   s_ -= n + 1;
   f_ = oldF;
   return a;
@@ -182,17 +336,26 @@ int Vm::push(Value x, int s) {
   return s + 1;
 }
 
+int Vm::pushReserved(Value x, int s) {
+  assert(s < stackSize_);
+  stack_[s] = x;
+  return s + 1;
+}
+
 int Vm::shiftArgs(int n, int m, int s, int f) {
   moveStackElems(stack_, f - m, s - n, n);
   return f - m + n;
 }
 
-bool Vm::isTailCall(Value x) const  { return CAR(x).eq(OPCVAL(RET)); }
-int Vm::pushCallFrame(Value ret, int s) {
-  return push(ret, push(Value(f_), push(c_, s)));
+bool Vm::isTailCall(const Value* x) const  { return x->eq(OPCVAL(RET)); }
+int Vm::pushCallFrame(const Value* ret, int s) {
+  return push(encodeAddress(ret), push(Value(f_), push(c_, s)));
+}
+int Vm::pushCallFrameReserved(const Value* ret, int s) {
+  return pushReserved(encodeAddress(ret), pushReserved(Value(f_), pushReserved(c_, s)));
 }
 int Vm::popCallFrame(int s) {
-  x_ = index(s, 0);
+  x_ = decodeAddress(index(s, 0));
   f_ = index(s, 1).toFixnum();
   c_ = index(s, 2);
   return s - 3;
@@ -202,6 +365,307 @@ Value Vm::box(Value x) {
   return Value(state_->getAllocator()->newObject<Box>(x));
 }
 
+Value Vm::getCurrentCode() const {
+  if (c_.getType() == TT_CODE)
+    return c_;
+  assert(c_.getType() == TT_CLOSURE || c_.getType() == TT_MACRO);
+  return static_cast<Closure*>(c_.toObject())->getCode();
+}
+
+void Vm::checkProfile() {
+  if (Profiler::isRequested() && profiler_ != NULL) {
+    int depth = getCallStackDepth();  // Builds call stack first.
+    profiler_->sample(depth, getCallStack());
+  }
+}
+
+#ifdef ENABLE_JIT
+void Vm::countCall(Value fn) {
+  if (fn.getType() != TT_CLOSURE)
+    return;
+  Closure* closure = static_cast<Closure*>(fn.toObject());
+  if (closure->countCall() == JIT_CALL_THRESHOLD)
+    jit_->compile(closure);
+}
+#endif
+
+void Vm::closeInst(Value* pc) {
+  int arena = state_->saveArena();
+  Value nparam = pc[1];  // Fixnum (fixed parameters function) or Cell (arbitrary number of parameters function).
+  int nfree = pc[2].toFixnum();
+  int depth = pc[3].toFixnum();
+  Value* body = getJumpTarget(&pc[4]);
+  int min, max;
+  if (nparam.getType() == TT_CELL) {
+    min = CAR(nparam).toFixnum();
+    max = CADR(nparam).toFixnum();
+  } else {
+    min = max = nparam.toFixnum();
+  }
+  a_ = createClosure(body, nfree, s_, min, max, depth);
+  s_ -= nfree;
+
+  if (nfree == 0 && pc[0].eq(OPCVAL(CLOSE))) {
+    // If no free variable, the closure has no reference to environment.
+    // So bytecode can be replaced to reuse it (unless it is replaced by JIT).
+    // CLOSE nparam nfree depth body ... => CONST closure JMP +2 ...
+    a_.mark();  // Promoted, because code might be old.
+    pc[0] = OPCVAL(CONST);
+    pc[1] = a_;
+    pc[2] = OPCVAL(JMP);
+    pc[3] = Value(2);
+  }
+  state_->restoreArena(arena);
+}
+
+void Vm::loopInst(Value* pc) {
+  // Tail self recursive call (goto): Like SHIFT.
+  int offset = pc[1].toFixnum(), n = pc[2].toFixnum();
+  // TODO: Remove this conditional.
+  if (offset > 0) {
+    for (int i = 0; i < n; ++i)
+      indexSet(f_, -(offset + i) - 2, index(s_, i));
+  } else {
+    for (int i = 0; i < n; ++i)
+      indexSet(f_, offset + i, index(s_, i));
+  }
+  s_ -= n;
+  checkProfile();
+}
+
+void Vm::tapplyInst(Value* pc) {
+  // SHIFT
+  int n = pc[1].toFixnum();
+  int calleeArgNum = index(f_, -1).toFixnum();
+  s_ = shiftArgs(n, calleeArgNum, s_, f_);
+  shiftCallStack();
+  // APPLY
+  apply(a_, n);
+}
+
+void Vm::retInst() {
+  int argNum = index(f_, -1).toFixnum();
+  s_ = popCallFrame(f_ - argNum);
+  popCallStack();
+}
+
+void Vm::boxInst(Value* pc) {
+  int arena = state_->saveArena();
+  int n = pc[1].toFixnum();
+  indexSet(f_, n, box(index(f_, n)));
+  state_->restoreArena(arena);
+}
+
+void Vm::contiInst(Value* pc) {
+  int arena = state_->saveArena();
+  int s = s_;
+  if (pc[1].isTrue()) {  // Tail call.
+    int calleeArgNum = index(f_, -1).toFixnum();
+    s = f_ - calleeArgNum;
+  }
+  a_ = createContinuation(s);
+  state_->restoreArena(arena);
+}
+
+void Vm::addspInst(Value* pc) {
+  int n = pc[1].toFixnum();
+  int s = s_;
+  assert(s + n <= stackSize_);
+  for (int i = 0; i < n; ++i)
+    stack_[s + i] = Value::NIL;
+  s_ += n;
+}
+
+#ifdef ENABLE_JIT
+//=============================================================================
+// JIT helpers: Called from native code, runs the instruction at `pc`.
+// Instructions which are not listed here exit to the interpreter.
+
+struct JitHelper {
+  static void setup(Vm* vm, JitInterface* interface) {
+    const char* base = reinterpret_cast<const char*>(vm);
+    interface->accumulator = reinterpret_cast<const char*>(&vm->a_) - base;
+    interface->pc = reinterpret_cast<const char*>(&vm->x_) - base;
+    interface->fp = reinterpret_cast<const char*>(&vm->f_) - base;
+    interface->sp = reinterpret_cast<const char*>(&vm->s_) - base;
+    interface->stack = reinterpret_cast<const char*>(&vm->stack_) - base;
+    interface->valueCount = reinterpret_cast<const char*>(&vm->valueCount_) - base;
+    interface->t = vm->state_->getConstant(State::T);
+
+    interface->next = &next;
+    interface->checkProfile = &checkProfile;
+    interface->profileRequested = Profiler::getRequestFlag();
+
+    JitHelperFunc* table = interface->helpers;
+    for (int i = 0; i < NUMBER_OF_OPCODE; ++i)
+      table[i] = NULL;
+#define HELPER(name)  table[name] = &name ## _
+    HELPER(VOID); HELPER(LREF); HELPER(FREF); HELPER(GREF); HELPER(LSET);
+    HELPER(FSET); HELPER(GSET); HELPER(DEF); HELPER(PUSH); HELPER(CLOSE);
+    HELPER(FRAME); HELPER(APPLY); HELPER(RET); HELPER(LOOP); HELPER(TAPPLY);
+    HELPER(BOX); HELPER(UNBOX); HELPER(CONTI); HELPER(ADDSP); HELPER(LOCAL);
+    HELPER(CAR); HELPER(CDR); HELPER(NEG); HELPER(INV); HELPER(EQ);
+    HELPER(LREF_PUSH); HELPER(CONST_PUSH); HELPER(GREF_APPLY); HELPER(LREF_TEST);
+#undef HELPER
+    table[ADD] = &binop<FixnumAdd, s_add>;
+    table[SUB] = &binop<FixnumSub, s_sub>;
+    table[MUL] = &binop<FixnumMul, s_mul>;
+    table[DIV] = &embed<s_div>;
+    table[LT] = &compare<std::less<Fixnum>, s_lessThan>;
+    table[LE] = &compare<std::less_equal<Fixnum>, s_lessEqual>;
+    table[GT] = &compare<std::greater<Fixnum>, s_greaterThan>;
+    table[GE] = &compare<std::greater_equal<Fixnum>, s_greaterEqual>;
+  }
+
+  static void* next(Vm* vm) {
+    if (!vm->x_->eq(OPCVAL(JIT)))
+      return NULL;
+    Code* code = static_cast<Code*>(vm->getCurrentCode().toObject());
+    return code->getJitEntry(vm->x_);
+  }
+
+  static void checkProfile(Vm* vm)  { vm->checkProfile(); }
+
+  static int VOID_(Vm* vm, Value*) {
+    vm->a_ = Value::NIL;
+    vm->valueCount_ = 0;
+    return 0;
+  }
+  static int LREF_(Vm* vm, Value* pc) {
+    vm->a_ = vm->index(vm->f_, pc[1].toFixnum());
+    vm->valueCount_ = 1;
+    return 0;
+  }
+  static int FREF_(Vm* vm, Value* pc) {
+    vm->a_ = static_cast<Closure*>(vm->c_.toObject())->getFreeVariable(pc[1].toFixnum());
+    vm->valueCount_ = 1;
+    return 0;
+  }
+  static int GREF_(Vm* vm, Value* pc) {
+    vm->a_ = referGlobalCell(vm->state_, pc[1]);
+    vm->valueCount_ = 1;
+    return 0;
+  }
+  static int LSET_(Vm* vm, Value* pc) {
+    Value box = vm->index(vm->f_, pc[1].toFixnum());
+    static_cast<Box*>(box.toObject())->set(vm->a_);
+    return 0;
+  }
+  static int FSET_(Vm* vm, Value* pc) {
+    Value box = static_cast<Closure*>(vm->c_.toObject())->getFreeVariable(pc[1].toFixnum());
+    static_cast<Box*>(box.toObject())->set(vm->a_);
+    return 0;
+  }
+  static int GSET_(Vm* vm, Value* pc) {
+    GlobalCell* p = static_cast<GlobalCell*>(pc[1].toObject());
+    if (!p->isBound()) {
+      Value sym = p->getSymbol();
+      vm->state_->runtimeError("Global variable `%@` not defined", &sym);
+    }
+    p->set(vm->a_);
+    return 0;
+  }
+  static int DEF_(Vm* vm, Value* pc) {
+    vm->defineGlobal(static_cast<GlobalCell*>(pc[1].toObject()), vm->a_);
+    return 0;
+  }
+  static int PUSH_(Vm* vm, Value*) {
+    vm->s_ = vm->pushReserved(vm->a_, vm->s_);
+    return 0;
+  }
+  static int CLOSE_(Vm* vm, Value* pc) {
+    if (pc[0].eq(OPCVAL(CONST)))  // Replaced after compiled.
+      vm->a_ = pc[1];
+    else
+      vm->closeInst(pc);
+    return 0;
+  }
+  static int FRAME_(Vm* vm, Value* pc) {
+    vm->s_ = vm->pushCallFrameReserved(getJumpTarget(&pc[1]), vm->s_);
+    return 0;
+  }
+  static int APPLY_(Vm* vm, Value* pc) {
+    vm->apply(vm->a_, pc[1].toFixnum());
+    return 0;
+  }
+  static int RET_(Vm* vm, Value*) {
+    vm->retInst();
+    return 0;
+  }
+  static int LOOP_(Vm* vm, Value* pc)  { vm->loopInst(pc); return 0; }
+  static int TAPPLY_(Vm* vm, Value* pc)  { vm->tapplyInst(pc); return 0; }
+  static int BOX_(Vm* vm, Value* pc)  { vm->boxInst(pc); return 0; }
+  static int UNBOX_(Vm* vm, Value*) {
+    vm->a_ = static_cast<Box*>(vm->a_.toObject())->get();
+    return 0;
+  }
+  static int CONTI_(Vm* vm, Value* pc)  { vm->contiInst(pc); return 0; }
+  static int ADDSP_(Vm* vm, Value* pc)  { vm->addspInst(pc); return 0; }
+  static int LOCAL_(Vm* vm, Value* pc) {
+    vm->indexSet(vm->f_, pc[1].toFixnum(), vm->a_);
+    return 0;
+  }
+  static int CAR_(Vm* vm, Value*)  { vm->a_ = car(vm->a_); return 0; }
+  static int CDR_(Vm* vm, Value*)  { vm->a_ = cdr(vm->a_); return 0; }
+  static int NEG_(Vm* vm, Value*)  { vm->a_ = UnaryOp<Neg>::calc(vm->state_, vm->a_); return 0; }
+  static int INV_(Vm* vm, Value*)  { vm->a_ = UnaryOp<Inv>::calc(vm->state_, vm->a_); return 0; }
+  static int EQ_(Vm* vm, Value*) {
+    Value b = vm->index(vm->s_, 0);
+    vm->a_ = vm->state_->boolean(vm->a_.eq(b));
+    --vm->s_;
+    return 0;
+  }
+  static int LREF_PUSH_(Vm* vm, Value* pc) {
+    LREF_(vm, pc);
+    return PUSH_(vm, pc);
+  }
+  static int CONST_PUSH_(Vm* vm, Value* pc) {
+    vm->a_ = pc[1];
+    return PUSH_(vm, pc);
+  }
+  static int GREF_APPLY_(Vm* vm, Value* pc) {
+    vm->a_ = referGlobalCell(vm->state_, pc[1]);
+    vm->apply(vm->a_, pc[2].toFixnum());
+    return 0;
+  }
+  static int LREF_TEST_(Vm* vm, Value* pc) {
+    LREF_(vm, pc);
+    return vm->a_.isTrue();
+  }
+
+  template <NativeFuncType func>
+  static int embed(Vm* vm, Value* pc) {
+    vm->a_ = vm->callEmbedFunction(func, pc[1].toFixnum());
+    return 0;
+  }
+  template <class Op, NativeFuncType func>
+  static int binop(Vm* vm, Value* pc) {
+    if (pc[1].toFixnum() == 2) {
+      Value a = vm->index(vm->s_, 0), b = vm->index(vm->s_, 1);
+      Fixnum r;
+      if (a.isFixnum() && b.isFixnum() && Op::calc(a.toFixnum(), b.toFixnum(), &r)) {
+        vm->a_ = Value(r);
+        vm->s_ -= 2;
+        return 0;
+      }
+    }
+    return embed<func>(vm, pc);
+  }
+  template <class Cmp, NativeFuncType func>
+  static int compare(Vm* vm, Value* pc) {
+    if (pc[1].toFixnum() == 2) {
+      Value a = vm->index(vm->s_, 0), b = vm->index(vm->s_, 1);
+      if (a.isFixnum() && b.isFixnum()) {
+        vm->a_ = vm->state_->boolean(Cmp()(a.toFixnum(), b.toFixnum()));
+        vm->s_ -= 2;
+        return 0;
+      }
+    }
+    return embed<func>(vm, pc);
+  }
+};
+#endif
+
 //=============================================================================
 
 Vm* Vm::create(State* state) {
@@ -216,6 +680,17 @@ void Vm::release() {
 }
 
 Vm::~Vm() {
+  if (profiler_ != NULL)
+    profiler_->release();
+  if (allocProfiler_ != NULL)
+    allocProfiler_->release();
+#ifdef ENABLE_JIT
+  jit_->release();
+#endif
+#ifdef COUNT_OPCODE_SEQUENCE
+  opcodeCounter_->~OpcodeCounter();
+  state_->free(opcodeCounter_);
+#endif
   if (values_ != NULL)
     state_->free(values_);
   if (stack_ != NULL)
@@ -227,13 +702,27 @@ Vm::Vm(State* state)
   , stack_(NULL), stackSize_(0)
   , trace_(false)
   , values_(NULL), valuesSize_(0), valueCount_(0)
-  , callStack_() {
+  , callStack_()
+#ifdef LAZY_CALL_STACK
+  , embedCallerF_(-1)
+#endif
+  , profiler_(NULL), allocProfiler_(NULL)
+{
   int arena = state_->saveArena();
 
+#ifdef COUNT_OPCODE_SEQUENCE
+  opcodeCounter_ = new(state_->alloc(sizeof(OpcodeCounter))) OpcodeCounter();
+#endif
+#ifdef ENABLE_JIT
+  JitInterface interface;
+  JitHelper::setup(this, &interface);
+  jit_ = Jit::create(state_, this, interface);
+#endif
+
   globalVariableTable_ = state_->createHashTable(false);
 
-  endOfCode_ = list(state_, OPCVAL(HALT));
-  return_ = list(state_, OPCVAL(RET));
+  endOfCode_[0] = OPCVAL(HALT);
+  return_[0] = OPCVAL(RET);
 
   a_ = c_ = Value::NIL;
   x_ = endOfCode_;
@@ -245,12 +734,44 @@ void Vm::setTrace(bool b) {
   trace_ = b;
 }
 
+bool Vm::startProfile() {
+  if (profiler_ == NULL)
+    profiler_ = Profiler::create(state_);
+  return profiler_->start(PROFILE_INTERVAL_USEC);
+}
+
+void Vm::stopProfile() {
+  if (profiler_ != NULL)
+    profiler_->stop();
+}
+
+void Vm::startAllocProfile(int interval) {
+  if (allocProfiler_ == NULL)
+    allocProfiler_ = AllocProfiler::create(state_);
+  allocProfiler_->start(interval);
+}
+
+void Vm::stopAllocProfile() {
+  if (allocProfiler_ != NULL)
+    allocProfiler_->stop();
+}
+
+void Vm::sampleAllocation(int type, size_t bytes) {
+  if (allocProfiler_ == NULL)
+    return;
+  int depth = getCallStackDepth();  // Builds call stack first.
+  allocProfiler_->sample(depth, depth > 0 ? getCallStack() : NULL, type, bytes);
+}
+
 void Vm::resetError() {
   a_ = Value::NIL;
   x_ = endOfCode_;
   c_ = Value::NIL;
   f_ = s_ = 0;
   callStack_.clear();
+#ifdef LAZY_CALL_STACK
+  embedCallerF_ = -1;
+#endif
 }
 
 void Vm::markRoot() {
@@ -264,9 +785,6 @@ void Vm::markRoot() {
   // Mark registers.
   a_.mark();
   c_.mark();
-  x_.mark();
-  endOfCode_.mark();
-  return_.mark();
 }
 
 void Vm::reportDebugInfo() const {
@@ -275,30 +793,56 @@ void Vm::reportDebugInfo() const {
   std::cout << "  entry:    #" << globalVariableTable_->getEntryCount() << std::endl;
   std::cout << "  conflict: #" << globalVariableTable_->getConflictCount() << std::endl;
   std::cout << "  maxdepth: #" << globalVariableTable_->getMaxDepth() << std::endl;
+#ifdef COUNT_OPCODE_SEQUENCE
+  opcodeCounter_->report(20);
+#endif
 }
 
 Value Vm::referGlobal(Value sym, bool* pExist) const {
   const Value* result = globalVariableTable_->get(sym);
+  GlobalCell* cell = NULL;
+  if (result != NULL && static_cast<GlobalCell*>(result->toObject())->isBound())
+    cell = static_cast<GlobalCell*>(result->toObject());
   if (pExist != NULL)
-    *pExist = result != NULL;
-  return result != NULL ? *result : Value::NIL;
+    *pExist = cell != NULL;
+  return cell != NULL ? cell->get() : Value::NIL;
 }
 
-void Vm::defineGlobal(Value sym, Value value) {
+GlobalCell* Vm::getGlobalCell(Value sym) {
   state_->checkType(sym, TT_SYMBOL);
-  globalVariableTable_->put(sym, value);
+  const Value* result = globalVariableTable_->get(sym);
+  if (result != NULL)
+    return static_cast<GlobalCell*>(result->toObject());
+
+  int arena = state_->saveArena();
+  GlobalCell* cell = state_->getAllocator()->newObject<GlobalCell>(sym);
+  globalVariableTable_->put(sym, Value(cell));
+  state_->restoreArena(arena);
+  return cell;
+}
+
+void Vm::defineGlobal(Value sym, Value value) {
+  defineGlobal(getGlobalCell(sym), value);
+}
+
+void Vm::defineGlobal(GlobalCell* cell, Value value) {
+  cell->set(value);
 
   if (value.isObject() && value.toObject()->isCallable()) {
-    const Symbol* name = sym.toSymbol(state_);
+    const Symbol* name = cell->getSymbol().toSymbol(state_);
     static_cast<Callable*>(value.toObject())->setName(name);
   }
 }
 
 bool Vm::assignGlobal(Value sym, Value value) {
   state_->checkType(sym, TT_SYMBOL);
-  if (globalVariableTable_->get(sym) == NULL)
+  const Value* result = globalVariableTable_->get(sym);
+  if (result == NULL)
     return false;
-  globalVariableTable_->put(sym, value);
+  GlobalCell* cell = static_cast<GlobalCell*>(result->toObject());
+  if (!cell->isBound())
+    return false;
+  cell->set(value);
   return true;
 }
 
@@ -315,6 +859,47 @@ int Vm::pushArgs(int argNum, const Value* args, int s) {
   return s;
 }
 
+#ifdef LAZY_CALL_STACK
+int Vm::getCallStackDepth() {
+  buildCallStack();
+  return callStack_.size();
+}
+
+const CallStack* Vm::getCallStack() {
+  return &callStack_[0];
+}
+
+// Reconstructs call stack from frames: each frame holds its argument
+// number at `f`, and the caller's closure, frame pointer and return
+// address are saved under the arguments.
+// Stops at a slot which doesn't look like a frame.
+void Vm::buildCallStack() {
+  callStack_.clear();
+  Value c = c_;
+  int f = embedCallerF_ >= 0 ? embedCallerF_ : f_;
+  for (;;) {
+    if (c.isObject() && c.toObject()->isCallable()) {
+      CallStack cs = { static_cast<Callable*>(c.toObject()), false };
+      callStack_.push_back(cs);
+    }
+    if (f < 0 || f >= s_ || !stack_[f].isFixnum())
+      break;
+    int base = f - stack_[f].toFixnum();  // Stack pointer before arguments are pushed.
+    if (base < 3 || base > f || !stack_[base - 2].isFixnum())
+      break;
+    int callerF = stack_[base - 2].toFixnum();
+    if (callerF >= f)
+      break;
+    c = stack_[base - 3];
+    f = callerF;
+  }
+  std::reverse(callStack_.begin(), callStack_.end());  // Bottom first.
+}
+
+#else
+int Vm::getCallStackDepth()  { return callStack_.size(); }
+const CallStack* Vm::getCallStack()  { return &callStack_[0]; }
+
 void Vm::pushCallStack(Callable* callable) {
   CallStack s = { callable, false };
   callStack_.push_back(s);
@@ -338,6 +923,7 @@ void Vm::shiftCallStack() {
     callStack_[n - 1].isTailCall = true;
   }
 }
+#endif
 
 Value Vm::funcall(Value fn, int argNum, const Value* args) {
   switch (fn.getType()) {
@@ -345,7 +931,7 @@ Value Vm::funcall(Value fn, int argNum, const Value* args) {
   case TT_CONTINUATION:
   case TT_MACRO:
     {
-      Value oldX = x_;
+      Value* oldX = x_;
       x_ = endOfCode_;
       funcallSetup(fn, argNum, args, false);
       Value result = runLoop();
@@ -380,8 +966,12 @@ Value Vm::funcallSetup(Value fn, int argNum, const Value* args, bool tailcall) {
       // Save to local variable, instead of creating call frame.
       int oldS = s_;
       int oldF = f_;
-      Value oldX = x_;
+      Value* oldX = x_;
 
+#ifdef LAZY_CALL_STACK
+      // Makes frame, to be traced in backtrace.
+      s_ = pushCallFrame(x_, s_);
+#endif
       s_ = pushArgs(argNum, args, s_);
       apply(fn, argNum);
 
@@ -419,15 +1009,20 @@ void Vm::apply(Value fn, int argNum) {
       int min = closure->getMinArgNum(), max = closure->getMaxArgNum();
       checkArgNum(state_, fn, argNum, min, max);
       pushCallStack(closure);
+#ifdef ENABLE_JIT
+      countCall(fn);
+#endif
 
       int ds = 0;
       if (closure->hasRestParam())
         ds = modifyRestParams(argNum, min);
       argNum += ds;
+      reserveStack(s_ + 1 + closure->getStackDepth());
       x_ = closure->getBody();
       f_ = s_;
       c_ = fn;
-      s_ = push(Value(argNum), s_);
+      s_ = pushReserved(Value(argNum), s_);
+      checkProfile();
     }
     break;
   case TT_NATIVEFUNC:
@@ -442,6 +1037,7 @@ void Vm::apply(Value fn, int argNum) {
       f_ = s_;
       s_ = push(Value(argNum), s_);
       x_ = return_;
+      checkProfile();
       a_ = native->call(state_);
       // x_ might be updated in the above call using #tailcall method.
       state_->restoreArena(arena);
@@ -458,6 +1054,7 @@ void Vm::apply(Value fn, int argNum) {
       const Value* savedStack = continuation->getStack();
       memcpy(stack_, savedStack, sizeof(Value) * savedStackSize);
 
+#ifndef LAZY_CALL_STACK
       int callStackSize = continuation->getCallStackSize();
       if (callStackSize == 0)
         callStack_.clear();
@@ -466,6 +1063,7 @@ void Vm::apply(Value fn, int argNum) {
         callStack_.resize(callStackSize);
         memcpy(&callStack_[0], callStack, sizeof(CallStack) * callStackSize);
       }
+#endif
       s_ = popCallFrame(savedStackSize);
     }
     break;
@@ -562,36 +1160,47 @@ Value Vm::applyFunctionClosure() {
   }
 
   pushCallStack(closure);
+  reserveStack(s_ + 1 + closure->getStackDepth());
   x_ = closure->getBody();
   f_ = s_;
   c_ = fn;
-  s_ = push(Value(argNum), s_);
+  s_ = pushReserved(Value(argNum), s_);
+  checkProfile();
 
   // runLoop will run after this function exited.
   return Value::NIL;
 }
 
-Value Vm::createClosure(Value body, int nfree, int s, int minArgNum, int maxArgNum) {
-  Closure* closure = state_->getAllocator()->newObject<Closure>(state_, body, nfree,
-                                                                minArgNum, maxArgNum);
+Value Vm::createClosure(Value* body, int nfree, int s, int minArgNum, int maxArgNum,
+                        int stackDepth) {
+  Closure* closure = state_->getAllocator()->newObject<Closure>(state_, getCurrentCode(), body,
+                                                                nfree, minArgNum, maxArgNum,
+                                                                stackDepth);
   for (int i = 0; i < nfree; ++i)
     closure->setFreeVariable(i, index(s, i));
   return Value(closure);
 }
 
-void Vm::defineMacro(Value name, Value body, int nfree, int s,
-                     int minArgNum, int maxArgNum) {
+void Vm::defineMacro(Value name, Value* body, int nfree, int s,
+                     int minArgNum, int maxArgNum, int stackDepth) {
   state_->checkType(name, TT_SYMBOL);
-  Macro* macro = state_->getAllocator()->newObject<Macro>(state_, name, body, nfree,
-                                                          minArgNum, maxArgNum);
+  Macro* macro = state_->getAllocator()->newObject<Macro>(state_, name, getCurrentCode(), body,
+                                                          nfree, minArgNum, maxArgNum,
+                                                          stackDepth);
   for (int i = 0; i < nfree; ++i)
     macro->setFreeVariable(i, index(s, i));
   defineGlobal(name, Value(macro));
 }
 
 Value Vm::createContinuation(int s) {
+#ifdef LAZY_CALL_STACK
+  // Call stack is reconstructed from the saved stack.
+  Continuation* cont = state_->getAllocator()->newObject<Continuation>(
+      state_, stack_, s, static_cast<const CallStack*>(NULL), 0);
+#else
   Continuation* cont = state_->getAllocator()->newObject<Continuation>(
       state_, stack_, s, &callStack_[0], callStack_.size());
+#endif
   return Value(cont);
 }
 
@@ -599,7 +1208,15 @@ void Vm::reserveStack(int n) {
   if (n <= stackSize_)
     return;
 
-  int newSize = n + STACK_EXPAND_SIZE;
+  if (n > MAX_STACK_SIZE)
+    state_->runtimeError("Stack overflow");
+
+  // Grows geometrically, to avoid reallocation at every deep call.
+  int newSize = stackSize_ > 0 ? stackSize_ : INITIAL_STACK_SIZE;
+  while (newSize < n)
+    newSize *= 2;
+  if (newSize > MAX_STACK_SIZE)
+    newSize = MAX_STACK_SIZE;
   void* memory = state_->realloc(stack_, sizeof(Value) * newSize);
   Value* newStack = static_cast<Value*>(memory);
   stack_ = newStack;
@@ -670,12 +1287,21 @@ int Vm::restoreValues(int min, int max) {
 }
 
 Value Vm::run(Value code) {
-  Value oldX = x_;
-  a_ = c_ = Value::NIL;
-  x_ = code;
+  int arena = state_->saveArena();
+  state_->restoreArenaWith(arena, code);
+  Code* linked = linkCode(state_, this, code);
+
+  Value* oldX = x_;
+  Value oldC = c_;
+  a_ = Value::NIL;
+  reserveStack(s_ + linked->getStackDepth());
+  c_ = Value(linked);
+  x_ = linked->getTop();
+  state_->restoreArena(arena);
   Value result = runLoop();
 
   x_ = oldX;
+  c_ = oldC;
   return result;
 }
 
@@ -689,7 +1315,7 @@ Value Vm::runLoop() {
   };
 #endif
 
-  Value x;
+  Value* x;
   INIT_DISPATCH {
     CASE(HALT) {
       x_ = endOfCode_;
@@ -722,14 +1348,9 @@ Value Vm::runLoop() {
       valueCount_ = 1;
     } NEXT;
     CASE(GREF) {
-      Value sym = POP(x);
+      Value cell = POP(x);
       x_ = x;
-      assert(sym.getType() == TT_SYMBOL);
-      bool exist;
-      Value aa = referGlobal(sym, &exist);
-      if (!exist)
-        state_->runtimeError("Unbound `%@`", &sym);
-      a_ = aa;
+      a_ = referGlobalCell(state_, cell);
       valueCount_ = 1;
     } NEXT;
     CASE(LSET) {
@@ -748,105 +1369,67 @@ Value Vm::runLoop() {
       static_cast<Box*>(box.toObject())->set(a_);
     } NEXT;
     CASE(GSET) {
-      Value sym = POP(x);
+      Value cell = POP(x);
       x_ = x;
-      assert(sym.getType() == TT_SYMBOL);
-      if (!assignGlobal(sym, a_))
+      GlobalCell* p = static_cast<GlobalCell*>(cell.toObject());
+      if (!p->isBound()) {
+        Value sym = p->getSymbol();
         state_->runtimeError("Global variable `%@` not defined", &sym);
+      }
+      p->set(a_);
     } NEXT;
     CASE(DEF) {
-      Value sym = POP(x);
+      Value cell = POP(x);
       x_ = x;
-      assert(sym.getType() == TT_SYMBOL);
-      defineGlobal(sym, a_);
+      defineGlobal(static_cast<GlobalCell*>(cell.toObject()), a_);
     } NEXT;
     CASE(PUSH) {
       x_ = x;
-      s_ = push(a_, s_);
+      s_ = pushReserved(a_, s_);
     } NEXT;
     CASE(TEST) {
-      Value thn = POP(x);
-      Value els = x;
+      Value* thn = popJumpTarget(x);
+      Value* els = x;
       x_ = a_.isTrue() ? thn : els;
     } NEXT;
+    CASE(JMP) {
+      x_ = popJumpTarget(x);
+    } NEXT;
     CASE(CLOSE) {
-      Value prex = x_;
-      int arena = state_->saveArena();
-      Value nparam = POP(x);  // Fixnum (fixed parameters function) or Cell (arbitrary number of parameters function).
-      Value snfree = POP(x);
-      Value body = POP(x);
-      x_ = x;
-      int nfree = snfree.toFixnum();
-      int min, max;
-      if (nparam.getType() == TT_CELL) {
-        min = CAR(nparam).toFixnum();
-        max = CADR(nparam).toFixnum();
-      } else {
-        min = max = nparam.toFixnum();
-      }
-      a_ = createClosure(body, nfree, s_, min, max);
-      s_ -= nfree;
-
-      if (nfree == 0) {
-        // If no free variable, the closure has no reference to environment.
-        // So bytecode can be replaced to reuse it.
-        // (CLOSE nparam nfree body ...) => (CONST closure ...)
-        CELL(prex)->setCar(OPCVAL(CONST));
-        CELL(CDR(prex))->setCar(a_);
-        CELL(CDR(prex))->setCdr(x_);
-      }
-      state_->restoreArena(arena);
+      Value* pc = x_;
+      x_ = x + 4;
+      closeInst(pc);
     } NEXT;
     CASE(FRAME) {
-      x_ = POP(x);
-      Value ret = x;
-      s_ = pushCallFrame(ret, s_);
+      Value* ret = popJumpTarget(x);
+      x_ = x;
+      s_ = pushCallFrameReserved(ret, s_);
     } NEXT;
     CASE(APPLY) {
       Value argNum = POP(x);
       apply(a_, argNum.toFixnum());
     } NEXT;
     CASE(RET) {
-      int argNum = index(f_, -1).toFixnum();
-      s_ = popCallFrame(f_ - argNum);
-      popCallStack();
+      retInst();
     } NEXT;
     CASE(UNFRAME) {
       s_ = popCallFrame(s_);
     } NEXT;
     CASE(LOOP) {
-      // Tail self recursive call (goto): Like SHIFT.
-      Value soffset = POP(x);
-      Value sn = POP(x);
-      x_ = x;
-      int offset = soffset.toFixnum(), n = sn.toFixnum();
-      // TODO: Remove this conditional.
-      if (offset > 0) {
-        for (int i = 0; i < n; ++i)
-          indexSet(f_, -(offset + i) - 2, index(s_, i));
-      } else {
-        for (int i = 0; i < n; ++i)
-          indexSet(f_, offset + i, index(s_, i));
-      }
-      s_ -= n;
+      Value* pc = x_;
+      x_ = x + 2;
+      loopInst(pc);
+#ifdef ENABLE_JIT
+      countCall(c_);
+#endif
     } NEXT;
     CASE(TAPPLY) {
-      // SHIFT
-      Value sn = POP(x);
-      int n = sn.toFixnum();
-      int calleeArgNum = index(f_, -1).toFixnum();
-      s_ = shiftArgs(n, calleeArgNum, s_, f_);
-      shiftCallStack();
-      // APPLY
-      apply(a_, n);
+      tapplyInst(x_);
     } NEXT;
     CASE(BOX) {
-      int arena = state_->saveArena();
-      Value sn = POP(x);
-      int n = sn.toFixnum();
-      x_ = x;
-      indexSet(f_, n, box(index(f_, n)));
-      state_->restoreArena(arena);
+      Value* pc = x_;
+      x_ = x + 1;
+      boxInst(pc);
     } NEXT;
     CASE(UNBOX) {
       x_ = x;
@@ -854,22 +1437,15 @@ Value Vm::runLoop() {
       a_ = static_cast<Box*>(a_.toObject())->get();
     } NEXT;
     CASE(CONTI) {
-      int arena = state_->saveArena();
-      Value tail = POP(x);
-      x_ = x;
-      int s = s_;
-      if (tail.isTrue()) {
-        int calleeArgNum = index(f_, -1).toFixnum();
-        s = f_ - calleeArgNum;
-      }
-      a_ = createContinuation(s);
-      state_->restoreArena(arena);
+      Value* pc = x_;
+      x_ = x + 1;
+      contiInst(pc);
     } NEXT;
     CASE(SETJMP) {
       // Setjmp stores current closure and stack/frame pointer onto stack.
       Value soffset = POP(x);
-      x_ = POP(x);
-      Value ret = x;
+      Value* ret = popJumpTarget(x);
+      x_ = x;
       // Encode frame pointer and stack pointer value into single integer
       // for setjmp continuation.
       const int shiftBits = sizeof(Fixnum) / 2 * 8;
@@ -878,7 +1454,7 @@ Value Vm::runLoop() {
       indexSet(f_, -offset - 2, Value(f_ + offset + 1));  // Pointer.
       indexSet(f_, -offset - 3, Value(v));
       indexSet(f_, -offset - 4, c_);
-      indexSet(f_, -offset - 5, ret);
+      indexSet(f_, -offset - 5, encodeAddress(ret));
     } NEXT;
     CASE(LONGJMP) {
       int p = a_.toFixnum();
@@ -887,7 +1463,7 @@ Value Vm::runLoop() {
       const Fixnum mask = (static_cast<Fixnum>(1) << shiftBits) - 1;
       Fixnum v = stack_[p + 1].toFixnum();
       c_ = stack_[p + 2];
-      x_ = stack_[p + 3];
+      x_ = decodeAddress(stack_[p + 3]);
       s_ = v & mask;
       f_ = v >> shiftBits;
     } NEXT;
@@ -896,7 +1472,8 @@ Value Vm::runLoop() {
       Value name = POP(x);
       Value nparam = POP(x);
       Value snfree = POP(x);
-      Value body = POP(x);
+      Value depth = POP(x);
+      Value* body = popJumpTarget(x);
       x_ = x;
       int nfree = snfree.toFixnum();
       int min, max;
@@ -906,20 +1483,15 @@ Value Vm::runLoop() {
       } else {
         min = max = nparam.toFixnum();
       }
-      defineMacro(name, body, nfree, s_, min, max);
+      defineMacro(name, body, nfree, s_, min, max, depth.toFixnum());
       s_ -= nfree;
       state_->restoreArena(arena);
       valueCount_ = 0;
     } NEXT;
     CASE(ADDSP) {
-      Value sn = POP(x);
-      x_ = x;
-      int n = sn.toFixnum();
-      int s = s_;
-      reserveStack(s + n);
-      for (int i = 0; i < n; ++i)
-        stack_[s + i] = Value::NIL;
-      s_ += n;
+      Value* pc = x_;
+      x_ = x + 1;
+      addspInst(pc);
     } NEXT;
     CASE(LOCAL) {
       Value offset = POP(x);
@@ -958,20 +1530,45 @@ Value Vm::runLoop() {
       x_ = x;
       a_ = cdr(a_);
     } NEXT;
-    SIMPLE_EMBED_INST(ADD, s_add);
-    SIMPLE_EMBED_INST(SUB, s_sub);
-    SIMPLE_EMBED_INST(MUL, s_mul);
+    FIXNUM_BINOP_INST(ADD, FixnumAdd, s_add);
+    FIXNUM_BINOP_INST(SUB, FixnumSub, s_sub);
+    FIXNUM_BINOP_INST(MUL, FixnumMul, s_mul);
     SIMPLE_EMBED_INST(DIV, s_div);
-    SIMPLE_EMBED_INST(LT, s_lessThan);
-    SIMPLE_EMBED_INST(LE, s_lessEqual);
-    SIMPLE_EMBED_INST(GT, s_greaterThan);
-    SIMPLE_EMBED_INST(GE, s_greaterEqual);
+    FIXNUM_COMPARE_INST(LT, <, s_lessThan);
+    FIXNUM_COMPARE_INST(LE, <=, s_lessEqual);
+    FIXNUM_COMPARE_INST(GT, >, s_greaterThan);
+    FIXNUM_COMPARE_INST(GE, >=, s_greaterEqual);
     CASE(EQ) {
       x_ = x;
       Value b = index(s_, 0);
       a_ = state_->boolean(a_.eq(b));
       --s_;
     } NEXT;
+    CASE(LREF_PUSH) {
+      Value n = POP(x);
+      x_ = x;
+      a_ = index(f_, n.toFixnum());
+      valueCount_ = 1;
+      s_ = pushReserved(a_, s_);
+    } NEXT;
+    CASE(CONST_PUSH) {
+      a_ = POP(x);
+      x_ = x;
+      s_ = pushReserved(a_, s_);
+    } NEXT;
+    CASE(GREF_APPLY) {
+      Value cell = POP(x);
+      Value argNum = POP(x);
+      a_ = referGlobalCell(state_, cell);
+      apply(a_, argNum.toFixnum());
+    } NEXT;
+    CASE(LREF_TEST) {
+      Value n = POP(x);
+      a_ = index(f_, n.toFixnum());
+      valueCount_ = 1;
+      Value* thn = popJumpTarget(x);
+      x_ = a_.isTrue() ? thn : x;
+    } NEXT;
     CASE(NEG) {
       x_ = x;
       a_ = UnaryOp<Neg>::calc(state_, a_);
@@ -980,8 +1577,17 @@ Value Vm::runLoop() {
       x_ = x;
       a_ = UnaryOp<Inv>::calc(state_, a_);
     } NEXT;
+    CASE(JIT) {
+#ifdef ENABLE_JIT
+      Code* code = static_cast<Code*>(getCurrentCode().toObject());
+      Jit::run(code->getJitEntry(x_));
+#else
+      Value op = *x_;
+      state_->runtimeError("Unknown op `%@`", &op);
+#endif
+    } NEXT;
     OTHERWISE {
-      Value op = car(x_);
+      Value op = *x_;
       state_->runtimeError("Unknown op `%@`", &op);
     } NEXT;
   } END_DISPATCH;
@@ -6,12 +6,17 @@
 #define _VM_HH_
 
 #include "yalp.hh"
+#include "yalp/object.hh"
 #include <assert.h>
 #include <vector>
 
 namespace yalp {
 
+class AllocProfiler;
 class Callable;
+class Jit;
+class OpcodeCounter;
+class Profiler;
 class SHashTable;
 
 class CallStack {
@@ -20,6 +25,50 @@ public:
   bool isTailCall;
 };
 
+// Box for local variable which is modified and captured by closures.
+class Box : public Object {
+public:
+  explicit Box(Value x) : Object(TT_BOX), x_(x)  {}
+
+  void set(Value x)  { writeBarrier(x); x_ = x; }
+  Value get() const  { return x_; }
+
+  void output(State* state, Stream* o, bool inspect) const;
+
+protected:
+  ~Box()  {}
+  void trace();
+
+  Value x_;
+
+  friend class GcObject;
+};
+
+// Binding for global variable.
+// Linked code refers this directly, instead of looking up the symbol.
+class GlobalCell : public Object {
+public:
+  explicit GlobalCell(Value sym)
+    : Object(TT_GLOBAL_CELL), sym_(sym), value_(Value::NIL), bound_(false)  {}
+
+  Value getSymbol() const  { return sym_; }
+  bool isBound() const  { return bound_; }
+  Value get() const  { return value_; }
+  void set(Value x)  { writeBarrier(x); value_ = x; bound_ = true; }
+
+  void output(State* state, Stream* o, bool inspect) const;
+
+protected:
+  ~GlobalCell()  {}
+  void trace();
+
+  Value sym_;
+  Value value_;
+  bool bound_;
+
+  friend class GcObject;
+};
+
 // Vm class.
 class Vm {
 public:
@@ -49,6 +98,9 @@ public:
   void defineGlobal(Value sym, Value value);
   bool assignGlobal(Value sym, Value value);
   Value getMacro(Value name);
+  // Gets global cell for the symbol, creates unbound one if not exists.
+  GlobalCell* getGlobalCell(Value sym);
+  // Maps symbol to GlobalCell.
   SHashTable* getGlobalVariableTable() const  { return globalVariableTable_; }
 
   // Calls function.
@@ -60,30 +112,46 @@ public:
 
   void resetError();
 
-  inline int getCallStackDepth() const;
-  inline const CallStack* getCallStack() const;
+  // Gets call stack, reconstructed from frames if LAZY_CALL_STACK.
+  int getCallStackDepth();
+  const CallStack* getCallStack();
 
   void setTrace(bool b);
 
+  // Sampling profiler.
+  bool startProfile();
+  void stopProfile();
+  const Profiler* getProfiler() const  { return profiler_; }
+  // Allocation profiler.
+  void startAllocProfile(int interval);
+  void stopAllocProfile();
+  const AllocProfiler* getAllocProfiler() const  { return allocProfiler_; }
+  // Attributes the sampled object to current call stack.
+  void sampleAllocation(int type, size_t bytes);
+
   void markRoot();
 
   void reportDebugInfo() const;
 
 private:
+  friend struct JitHelper;
+
   Vm(State* state);
   ~Vm();
   void installNativeFunctions();
   Value runLoop();
-  Value createClosure(Value body, int nfree, int s, int minArgNum, int maxArgNum);
+  Value createClosure(Value* body, int nfree, int s, int minArgNum, int maxArgNum,
+                      int stackDepth);
   Value createContinuation(int s);
   Value funcallSetup(Value fn, int argNum, const Value* args, bool tailcall);
   void apply(Value fn, int argNum);
   Value applyFunctionClosure();
 
-  void defineMacro(Value name, Value body, int nfree, int s,
-                   int minArgNum, int maxArgNum);
+  void defineMacro(Value name, Value* body, int nfree, int s,
+                   int minArgNum, int maxArgNum, int stackDepth);
+  void defineGlobal(GlobalCell* cell, Value value);
 
-  void reserveStack(int n);  // Ensure the stack has enough size of n
+  void reserveStack(int n);  // Ensure the stack has enough size of n, or raise overflow.
   int modifyRestParams(int argNum, int minArgNum);
   Value createRestParams(int argNum, int minArgNum, int s);
   void reserveValuesBuffer(int n);
@@ -92,18 +160,46 @@ private:
   int pushArgs(int argNum, const Value* args, int s);
   inline Value callEmbedFunction(NativeFuncType func, Fixnum n);
 
+#ifdef LAZY_CALL_STACK
+  void pushCallStack(Callable*)  {}
+  void popCallStack()  {}
+  void shiftCallStack()  {}
+  void buildCallStack();
+#else
   void pushCallStack(Callable* callable);
   void popCallStack();
   void shiftCallStack();
+#endif
 
   inline Value index(int s, int i) const;
   inline void indexSet(int s, int i, Value v);
   inline int push(Value x, int s);
+  // Pushes without checking stack size: the space must be reserved
+  // at function entry.
+  inline int pushReserved(Value x, int s);
   inline int shiftArgs(int n, int m, int s, int f);
-  inline bool isTailCall(Value x) const;
-  inline int pushCallFrame(Value ret, int s);
+  inline bool isTailCall(const Value* x) const;
+  inline int pushCallFrame(const Value* ret, int s);
+  inline int pushCallFrameReserved(const Value* ret, int s);
   inline int popCallFrame(int s);
   inline Value box(Value x);
+  inline Value getCurrentCode() const;
+  // Takes a profile sample if requested.
+  inline void checkProfile();
+#ifdef ENABLE_JIT
+  // Counts up calls of the closure (including self tail calls), and
+  // compiles it when it gets hot.
+  inline void countCall(Value fn);
+#endif
+
+  // Instructions shared with JIT helpers: `pc` points the opcode.
+  inline void closeInst(Value* pc);
+  inline void loopInst(Value* pc);
+  inline void tapplyInst(Value* pc);
+  inline void retInst();
+  inline void boxInst(Value* pc);
+  inline void contiInst(Value* pc);
+  inline void addspInst(Value* pc);
 
   State* state_;
   Value* stack_;
@@ -114,19 +210,32 @@ private:
   int valuesSize_;
   int valueCount_;
 
-  // Global variables
+  // Global variables: symbol -> GlobalCell
   SHashTable* globalVariableTable_;
 
-  Value endOfCode_;
-  Value return_;
+  Value endOfCode_[1];
+  Value return_[1];
 
   Value a_;  // Accumulator.
-  Value x_;  // Running code.
+  Value* x_;  // Running code, points into linked code of c_.
   int f_;     // Frame pointer.
   Value c_;  // Current closure.
   int s_;     // Stack pointer.
 
   std::vector<CallStack> callStack_;
+#ifdef LAZY_CALL_STACK
+  int embedCallerF_;  // Frame pointer of the caller of embedded function, or -1.
+#endif
+
+  Profiler* profiler_;  // Created at first use.
+  AllocProfiler* allocProfiler_;  // Same as above.
+
+#ifdef COUNT_OPCODE_SEQUENCE
+  OpcodeCounter* opcodeCounter_;
+#endif
+#ifdef ENABLE_JIT
+  Jit* jit_;
+#endif
 };
 
 Value Vm::index(int s, int i) const {
@@ -157,9 +266,6 @@ Value Vm::tailcall(Value fn, int argNum, const Value* args) {
   return funcallSetup(fn, argNum, args, true);
 }
 
-int Vm::getCallStackDepth() const  { return callStack_.size(); }
-const CallStack* Vm::getCallStack() const  { return &callStack_[0]; }
-
 }  // namespace yalp
 
 #endif
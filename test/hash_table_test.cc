@@ -4,7 +4,7 @@
 using namespace yalp;
 
 typedef const char* Key;
-typedef const char* Value;
+typedef const char* Val;
 
 #ifdef DISABLE_OVERRIDE
 #define override  // Disable C++11 `override` keyword
@@ -34,7 +34,7 @@ protected:
 };
 
 TEST_F(HashTableTest, PutGet) {
-  HashTable<Key, Value> ht = HashTable<Key, Value>(&policy_, allocator_);
+  HashTable<Key, Val> ht = HashTable<Key, Val>(&policy_, allocator_);
 
   ASSERT_TRUE(NULL == ht.get("foo")) << "get is failed for empty table";
 
@@ -58,13 +58,13 @@ TEST_F(HashTableTest, PutGet) {
 }
 
 TEST_F(HashTableTest, Each) {
-  HashTable<Key, Value> ht = HashTable<Key, Value>(&policy_, allocator_);
+  HashTable<Key, Val> ht = HashTable<Key, Val>(&policy_, allocator_);
 
   ht.put("1", "one");
   ht.put("22", "two");
   ht.put("333", "three");
 
-  HashTable<Key, Value>::const_iterator it = ht.begin();
+  HashTable<Key, Val>::const_iterator it = ht.begin();
   ASSERT_NE(ht.end(), it);
   ASSERT_STREQ("1", it->key);
   ASSERT_STREQ("one", it->value);
@@ -82,3 +82,51 @@ TEST_F(HashTableTest, Each) {
   ++it;
   ASSERT_EQ(ht.end(), it);
 }
+
+TEST_F(HashTableTest, RemoveIf) {
+  HashTable<Key, Val> ht = HashTable<Key, Val>(&policy_, allocator_);
+
+  ht.put("foo", "hoge");
+  ht.put("bar", "fuga");
+  ht.put("baz", "hoge");
+  ht.put("qux", "piyo");
+
+  ht.removeIf([](Key, Val value) { return strcmp(value, "hoge") == 0; });
+  ASSERT_EQ(2, ht.getEntryCount());
+  ASSERT_TRUE(NULL == ht.get("foo"));
+  ASSERT_TRUE(NULL == ht.get("baz"));
+  ASSERT_STREQ("fuga", *ht.get("bar"));
+  ASSERT_STREQ("piyo", *ht.get("qux"));
+}
+
+TEST_F(HashTableTest, Grow) {
+  HashTable<Key, Val> ht = HashTable<Key, Val>(&policy_, allocator_);
+
+  // Hash function gives few values, so keys conflict heavily.
+  const int N = 1000;
+  static char keys[N][8];
+  for (int i = 0; i < N; ++i) {
+    snprintf(keys[i], sizeof(keys[i]), "%d", i);
+    ht.put(keys[i], keys[i]);
+  }
+  ASSERT_EQ(N, ht.getEntryCount());
+  ASSERT_EQ(0u, ht.getCapacity() & (ht.getCapacity() - 1)) << "power of 2";
+
+  for (int i = 0; i < N; i += 2)
+    ASSERT_TRUE(ht.remove(keys[i]));
+  ASSERT_EQ(N / 2, ht.getEntryCount());
+  for (int i = 0; i < N; ++i) {
+    const Val* p = ht.get(keys[i]);
+    if (i % 2 == 0)
+      ASSERT_TRUE(NULL == p) << keys[i];
+    else
+      ASSERT_TRUE(NULL != p && *p == keys[i]) << keys[i];
+  }
+
+  int count = 0;
+  for (auto kv : ht) {
+    ASSERT_EQ(1, atoi(kv.key) % 2);
+    ++count;
+  }
+  ASSERT_EQ(N / 2, count);
+}
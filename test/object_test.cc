@@ -25,3 +25,23 @@ TEST_F(ObjectTest, cell) {
   ASSERT_TRUE(p->car().eq(a));
   ASSERT_TRUE(p->cdr().eq(d));
 }
+
+TEST_F(ObjectTest, string) {
+  Value s = state_->string("foo\0bar", 7);
+  ASSERT_EQ(TT_STRING, s.getType());
+  String* p = static_cast<String*>(s.toObject());
+  ASSERT_EQ(7u, p->len());
+  ASSERT_EQ(0, memcmp("foo\0bar", p->c_str(), 8));
+
+  // Larger than pooled objects.
+  const size_t LEN = 5000;
+  char* buffer = static_cast<char*>(state_->alloc(LEN + 1));
+  memset(buffer, 'x', LEN);
+  buffer[LEN] = '\0';
+  Value large = state_->allocatedString(buffer, LEN);
+  state_->collectGarbage();
+  String* q = static_cast<String*>(large.toObject());
+  ASSERT_EQ(LEN, q->len());
+  ASSERT_EQ(LEN, strlen(q->c_str()));
+  ASSERT_TRUE(large.equal(state_->string(q->c_str())));
+}
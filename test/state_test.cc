@@ -4,6 +4,8 @@
 #include "yalp/util.hh"
 #include "symbol_manager.hh"
 
+#include <stdlib.h>
+
 using namespace yalp;
 
 class StateTest : public ::testing::Test {
@@ -63,3 +65,263 @@ TEST_F(StateTest, Funcall) {
   ASSERT_EQ(TT_FIXNUM, result.getType());
   ASSERT_EQ(6, result.toFixnum());
 }
+
+TEST_F(StateTest, HandleScope) {
+  int arena = state_->saveArena();
+  Value outer;
+  {
+    HandleScope scope(state_);
+    // More objects than initial arena size.
+    Value v = Value::NIL;
+    for (int i = 0; i < 1000; ++i)
+      v = state_->cons(Value(i), v);
+    state_->collectGarbage();
+    ASSERT_EQ(1000, length(v));
+    ASSERT_TRUE(Value(999).eq(car(v)));
+
+    outer = scope.escape(v);
+    ASSERT_EQ(arena + 1, state_->saveArena());
+    state_->cons(Value(1), Value(2));
+  }
+  ASSERT_EQ(arena + 1, state_->saveArena());
+  state_->collectGarbage();
+  ASSERT_EQ(1000, length(outer));
+  int i = 999;
+  for (Value p = outer; !p.eq(Value::NIL); p = cdr(p), --i)
+    ASSERT_TRUE(Value(i).eq(car(p)));
+  state_->restoreArena(arena);
+}
+
+static bool allocFails;
+
+static void* failableAllocFunc(void* p, size_t size) {
+  if (size <= 0) {
+    free(p);
+    return NULL;
+  }
+  if (allocFails)
+    return NULL;
+  return realloc(p, size);
+}
+
+TEST(GcTest, MarkStackOverflow) {
+  State* state = State::create(failableAllocFunc);
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(def *v* (make-vector 10000))"
+      "(let loop ((i 0))"
+      "  (when (< i 10000)"
+      "    (vector-set! *v* i (list i i))"
+      "    (loop (+ i 1))))"));
+
+  // Mark stack can't grow, so marked objects are rescanned.
+  allocFails = true;
+  state->collectGarbage();
+  allocFails = false;
+
+  Value result;
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(let loop ((i 0))"
+      "  (cond ((>= i 10000) t)"
+      "        ((equal? (vector-get *v* i) (list i i)) (loop (+ i 1)))"
+      "        (t i)))", &result));
+  ASSERT_TRUE(result.eq(state->getConstant(State::T)));
+  state->release();
+}
+
+TEST(GcTest, ParallelCollect) {
+  State* state = State::create(failableAllocFunc, 4);
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(def *v* (make-vector 10000))"
+      "(def *l* ())"
+      "(let loop ((i 0))"
+      "  (when (< i 10000)"
+      "    (vector-set! *v* i (list i (make-vector 3 i)))"
+      "    (set! *l* (cons i *l*))"
+      "    (loop (+ i 1))))"));
+
+  for (int i = 0; i < 4; ++i) {
+    // Mark stacks can't grow in the last time.
+    allocFails = i == 3;
+    state->collectGarbage();
+    allocFails = false;
+    ASSERT_EQ(SUCCESS, state->runFromString(
+        "(let loop ((i 0))"
+        "  (when (< i 100)"
+        "    (set! *l* (cons (car *l*) (cdr *l*)))"
+        "    (loop (+ i 1))))"));
+  }
+
+  Value result;
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(let loop ((i 0) (l (reverse *l*)))"
+      "  (cond ((>= i 10000) (null? l))"
+      "        ((and (equal? (vector-get *v* i) (list i (make-vector 3 i)))"
+      "              (eq? (car l) i))"
+      "         (loop (+ i 1) (cdr l)))"
+      "        (t i)))", &result));
+  ASSERT_TRUE(result.eq(state->getConstant(State::T)));
+  state->release();
+}
+
+TEST(GcTest, PacedOnHeapBytes) {
+  State* state = State::create();
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  const char* script =
+      "(let loop ((i 0))"
+      "  (when (< i 200)"
+      "    (make-vector 125000)"  // 1MB buffer.
+      "    (loop (+ i 1))))";
+
+  // Few objects, but their buffers trigger GC.
+  ASSERT_EQ(SUCCESS, state->runFromString(script));
+  ASSERT_GT(size_t(GC_MIN_HEAP_SIZE * 2), state->getHeapBytes());
+
+  // Incremental GC lags behind the limit, by its steps.
+  state->setGcStepSize(0);
+  state->collectGarbage();
+  state->setGcHeapLimit(4 * 1024 * 1024);
+  ASSERT_EQ(SUCCESS, state->runFromString(script));
+  ASSERT_GT(size_t(5 * 1024 * 1024), state->getHeapBytes());
+  state->release();
+}
+
+TEST(GcTest, IncrementalMutation) {
+  State* state = State::create();
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(def *v* (make-vector 100))"
+      "(def *t* (table))"
+      "(let loop ((i 0))"
+      "  (when (< i 100)"
+      "    (vector-set! *v* i (list 'v i))"
+      "    (table-put! *t* i (list 't i))"
+      "    (loop (+ i 1))))"));
+  state->setGcStepSize(0);
+  state->collectGarbage();  // All of them get old.
+
+  // Small steps, and cycles start soon: values are swapped between the
+  // vector and the table while they are being marked.
+  state->setGcStepSize(16);
+  state->setGcHeapLimit(state->getHeapBytes());
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(let loop ((n 0))"
+      "  (when (< n 200)"
+      "    (let loop2 ((i 0))"
+      "      (when (< i 100)"
+      "        (let1 x (vector-get *v* i)"
+      "          (vector-set! *v* i (table-get *t* i))"
+      "          (table-put! *t* i x))"
+      "        (make-vector 3)"
+      "        (loop2 (+ i 1))))"
+      "    (loop (+ n 1))))"));
+  GcStats stats;
+  state->getGcStats(&stats);
+  ASSERT_LT(0, stats.stepCount);
+
+  // Finishes the running cycle.
+  state->setGcStepSize(0);
+  state->collectGarbage();
+  Value result;
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(let loop ((i 0))"
+      "  (cond ((eq? i 100) t)"
+      "        ((and (equal? (vector-get *v* i) (list 'v i))"
+      "              (equal? (table-get *t* i) (list 't i)))"
+      "         (loop (+ i 1)))"
+      "        (t i)))", &result));
+  ASSERT_TRUE(result.eq(state->getConstant(State::T)));
+  state->release();
+}
+
+static void countGcEvents(State*, const GcEvent* event, void* userdata) {
+  long* counts = static_cast<long*>(userdata);
+  ++counts[event->kind];
+}
+
+TEST(GcTest, Stats) {
+  State* state = State::create();
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  long counts[3] = {0, 0, 0};
+  state->setGcCallback(countGcEvents, counts);
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(def *l* (let loop ((i 0) (acc ()))"
+      "           (if (< i 200000) (loop (+ i 1) (cons i acc)) acc)))"));
+  state->setGcStepSize(0);
+  state->collectGarbage();
+
+  GcStats stats;
+  state->getGcStats(&stats);
+  ASSERT_LT(0, stats.minorCount);
+  ASSERT_EQ(stats.minorCount, counts[GcEvent::MINOR]);
+  ASSERT_EQ(stats.fullCount, counts[GcEvent::FULL] + counts[GcEvent::INCREMENTAL]);
+  long pauses = 0;
+  for (int i = 0; i < GcStats::PAUSE_BUCKETS; ++i)
+    pauses += stats.pauseHistogram[i];
+  ASSERT_EQ(stats.minorCount + stats.fullCount - counts[GcEvent::INCREMENTAL] +
+            stats.stepCount, pauses);
+  ASSERT_LE(200000u, stats.allocatedObjects[TT_CELL]);
+  ASSERT_LE(200000u, stats.liveObjects[TT_CELL]);
+  ASSERT_GT(stats.allocatedObjects[TT_CELL], stats.liveObjects[TT_CELL]);
+  ASSERT_EQ(state->getHeapBytes(), stats.heapBytes);
+  state->release();
+}
+
+TEST(GcTest, HeapBudget) {
+  const size_t BUDGET = 32 * 1024 * 1024;
+  State* state = State::create(failableAllocFunc, 1, BUDGET);
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+
+  ASSERT_EQ(OUT_OF_MEMORY, state->runFromString(
+      "(let loop ((l ()))"
+      "  (loop (cons (make-vector 125000) l)))"));  // 1MB buffer.
+  ASSERT_GE(BUDGET, state->getHeapBytes());
+
+  // Objects in the failed run are released.
+  state->resetError();
+  Value result;
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(vector-length (make-vector 1000000))", &result));
+  ASSERT_TRUE(Value(1000000).eq(result));
+  state->release();
+}
+
+TEST(GcTest, WeakReferences) {
+  State* state = State::create();
+  ASSERT_EQ(SUCCESS, state->runBinaryFromString(bootBinaryData));
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(def *keys* (table 'eq? 'weak-key))"
+      "(def *values* (table 'weak-value))"
+      "(def *held* ())"
+      "(let loop ((i 0))"
+      "  (when (< i 100)"
+      "    (let1 x (list i)"
+      "      (when (eq? (mod i 2) 0)"
+      "        (set! *held* (cons x *held*)))"
+      "      (table-put! *keys* x i)"
+      "      (table-put! *values* i x))"
+      "    (loop (+ i 1))))"
+      "(def *ref1* (weak-ref (car *held*)))"
+      "(def *ref2* (weak-ref (list 'garbage)))"
+      "(def *ref3* (weak-ref 'symbol))"));
+  state->collectGarbage();
+
+  // Entries with unreachable keys or values are removed.
+  Value result;
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(equal? '(50 50 (98) nil)"
+      "        (list (length (table-keys *keys*))"
+      "              (length (table-keys *values*))"
+      "              (table-get *values* 98)"
+      "              (table-get *values* 99)))", &result));
+  ASSERT_TRUE(result.eq(state->getConstant(State::T)));
+
+  ASSERT_EQ(SUCCESS, state->runFromString(
+      "(equal? '(t nil symbol)"
+      "        (list (eq? (weak-ref-get *ref1*) (car *held*))"
+      "              (weak-ref-get *ref2*)"
+      "              (weak-ref-get *ref3*)))", &result));
+  ASSERT_TRUE(result.eq(state->getConstant(State::T)));
+  state->release();
+}
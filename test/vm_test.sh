@@ -85,6 +85,52 @@ run closure-set 23 '((^(x)
                           (set! x 23)))
                        x)
                      1)'
+run set-local-loop 10 '((^(i n)
+                           (while (< i 5)
+                             (set! n (+ n i)
+                                   i (+ i 1)))
+                           n)
+                         0 0)'
+run closure-set-after-capture 2 '((^(x)
+                                    (let1 f (^() x)
+                                      (set! x 2)
+                                      (f)))
+                                  1)'
+run_raw set-local-reenter-call/cc 3 '(defun f ()
+                                        (let ((k nil) (n 0))
+                                          (call/cc (^(c) (set! k c)))
+                                          (set! n (+ n 1))
+                                          (if (< n 3) (k nil))
+                                          n))
+                                      (print (f))'
+run set-local-box '(t nil nil t)' "(let1 has-box? (^(x)
+                                                  (let1 box nil
+                                                    (vm-walker (compile x)
+                                                               (^(code recur)
+                                                                 (when (eq? (car code) 20)  ; BOX
+                                                                   (set! box t))
+                                                                 nil))
+                                                    box))
+                                       (list (has-box? '(^(v i)  ; Set after call in loop.
+                                                          (while (< i 10)
+                                                            (vector-set! v i i)
+                                                            (set! i (+ i 1)))))
+                                             (has-box? '(^()  ; Not used after call.
+                                                          (let1 n 0
+                                                            (set! n 1)
+                                                            (print n)
+                                                            'done)))
+                                             (has-box? '(^(v)  ; Call in loop, before set.
+                                                          (let loop ((j 0))
+                                                            (when (< j 3)
+                                                              (let1 x (* j 2)
+                                                                (set! x (+ x 1))
+                                                                (vector-set! v j x))
+                                                              (loop (+ j 1))))))
+                                             (has-box? '(^(i)  ; Captured.
+                                                          (let1 f (^() i)
+                                                            (set! i 2)
+                                                            (f))))))"
 run call/cc 123 '(call/cc
                    (^(cc)
                      (cc 123)))'
@@ -164,9 +210,12 @@ run '<' nil '(< 2 2)'
 run '>' t '(> 2 1)'
 run '<=' t '(<= 2 2)'
 run '>=' t '(>= 2 2)'
+run '<-variadic' nil '(< 1 2 2)'
+run '*-negative' '-12' '(* 3 -4)'
+run '*-large' '1000000000000' '(* 1000000 1000000)'
 
 # Flonum
-run 'flonum-eq?' nil '(eq? 1.0 1.0)'
+run 'flonum-eq?' t '(eq? 1.0 1.0)'  # Immediate flonum.
 run 'flonum-equal?' t '(equal? 1.0 1.0)'
 run +float '1.230000' '(+ 1 0.23)'
 run -float '0.770000' '(- 1 0.23)'
@@ -175,6 +224,7 @@ run '*float' '0.460000' '(* 2 0.23)'
 run /float '8.695652' '(/ 2 0.23)'
 run /invert '4.347826' '(/ 0.23)'
 run '<float' t '(< 1 1.1)'
+run '>=float' nil '(>= 1 1.1)'
 
 run apply-native 15 "(apply + 1 2 '(3 4 5))"
 run apply-compound 15 "(apply (^(a b c d e) (+ a b c d e)) 1 2 '(3 4 5))"
@@ -184,11 +234,55 @@ run hash-table 123 "((^(h)
                         (table-put! h 'key 123)
                         (table-get h 'key))
                      (table))"
+run global-variable-table 123 "(def *x* 123) (table-get (global-variable-table) '*x*)"
 
 # eval
 run eval "'x" "(eval '(quote (quote x)))"
 run eval "x" "(eval (eval '(quote (quote x))))"
 
+# Profiler
+run profile 'f' "(defun f (n) (if (eq? n 0) 0 (f (- n 1))))
+                 (let loop ((i 0))  ; Samples might miss f, so retries.
+                   (when (< i 10)
+                     (profile-start)
+                     (f 1000000)
+                     (if (assoc 'f (profile-stop))
+                         'f
+                       (loop (+ i 1)))))"
+run alloc-profile 'CLOSE' "(defun f (n acc) (if (< n 1) acc (f (- n 1) (cons (^() n) acc))))
+                         (alloc-profile-start 1)
+                         (f 100 ())
+                         (cadr (assoc 'f (alloc-profile-stop)))"
+
+# GC
+run write-barrier '(1 2 3)' "(def v (vector nil))
+                             (collect-garbage)  ; v is promoted to old.
+                             (vector-set! v 0 (list 1 2 3))
+                             (let loop ((i 0))  ; Runs minor GC.
+                               (when (< i 100000)
+                                 (cons i i)
+                                 (loop (+ i 1))))
+                             (vector-get v 0)"
+run store-into-old '(200000 (1 2 3))' "(def v (vector nil))
+                                  (collect-garbage)
+                                  (defun build (n acc) (if (< n 1) acc (build (- n 1) (cons n acc))))
+                                  (let1 l (build 200000 ())
+                                    (let loop ((i 0))  ; Stores into old vector.
+                                      (when (< i 1000)
+                                        (vector-set! v 0 (list 1 2 3))
+                                        (build 100 ())
+                                        (loop (+ i 1))))
+                                    (list (length l) (vector-get v 0)))"
+run mark-long-list 1000000 "(defun build (n acc) (if (< n 1) acc (build (- n 1) (cons (list n) acc))))
+                            (let1 l (build 1000000 ())
+                              (collect-garbage)  ; Marks without recursion.
+                              (length l))"
+run gc-stats t "(collect-garbage)
+                (let1 stats (gc-stats)
+                  (if (and (< 0 (cdr (assoc 'full-gc stats)))
+                           (assoc 'pair (cdr (assoc 'live stats))))
+                      t nil))"
+
 # Scheme - yalp value differences
 run '() is false' 3 '(if () 2 3)'
 run '() is nil' t '(eq? () nil)'
@@ -199,12 +293,17 @@ run_raw shadow-inlined-function '3' '(declaim (inline add))
                                      (print (let1 + cons
                                               (add 1 2)))'
 
+# Deep recursion
+run_raw deep-recursion '100000' '(defun f (n) (if (eq? n 0) 0 (+ 1 (f (- n 1)))))
+                                 (print (f 100000))'
+
 # Fail cases
 fail unbound 'abc'
 fail no-global '((^(x) y) 123)'
 fail invalid-apply '(1 2 3)'
 fail too-few-arg-native '(cons 1)'
 fail too-many-arg-native '(cons 1 2 3)'
+fail put-global-variable-table "(table-put! (global-variable-table) 'car 1)"
 fail too-few-arg-lambda-direct '((^(x y)) 1)'
 fail too-few-arg-lambda '((^(f) (f 1)) (^(x y)))'
 fail too-many-arg-lambda-direct '((^(x y)) 1 2 3)'
@@ -214,6 +313,7 @@ fail too-many-arg-receive '(receive (x y) (values 1 2 3))'
 fail empty-param-not-rest-param-direct '((^() nil) 1 2 3)'
 fail empty-param-not-rest-param '((^(f) (f 1 2 3)) (^() nil))'
 fail set-unbound-var '(set! x 123)'
+fail stack-overflow '(defun f (x) (+ 1 (f x))) (f 1)'
 
 ################################################################
 # All tests succeeded.
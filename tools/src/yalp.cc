@@ -254,7 +254,25 @@ static bool runMain(State* state, int argc, char** const argv, Value* pResult) {
   return state->funcall(main, 1, &args, pResult);
 }
 
-static void exitIfError(ErrorCode err) {
+static void writeProfile(State* state, const char* fileName) {
+  FileStream stream(fileName, "w");
+  if (!stream.isOpened()) {
+    cerr << "Can't open profile output: " << fileName << endl;
+    exit(1);
+  }
+  state->outputProfile(&stream);
+}
+
+static void writeAllocProfile(State* state, const char* fileName) {
+  FileStream stream(fileName, "w");
+  if (!stream.isOpened()) {
+    cerr << "Can't open allocation profile output: " << fileName << endl;
+    exit(1);
+  }
+  state->outputAllocProfile(&stream);
+}
+
+static bool checkError(ErrorCode err) {
   switch (err) {
   case FILE_NOT_FOUND:
     cerr << "File not found\n";
@@ -262,7 +280,11 @@ static void exitIfError(ErrorCode err) {
   default:
     break;
   }
-  if (err != SUCCESS)
+  return err == SUCCESS;
+}
+
+static void exitIfError(ErrorCode err) {
+  if (!checkError(err))
     exit(1);
 }
 
@@ -278,6 +300,8 @@ int main(int argc, char* argv[]) {
   bool bCompile = false;
   bool bNoRun = false;
   const char* oneLinear = NULL;
+  const char* profileFileName = NULL;
+  const char* allocProfileFileName = NULL;
   int ii;
   for (ii = 1; ii < argc; ++ii) {
     char* arg = argv[ii];
@@ -300,6 +324,20 @@ int main(int argc, char* argv[]) {
       }
       oneLinear = argv[ii];
       break;
+    case 'p':  // Profile, and write collapsed stacks into the file.
+      if (++ii >= argc) {
+        cerr << "'-p' takes parameter" << endl;
+        exit(1);
+      }
+      profileFileName = argv[ii];
+      break;
+    case 'a':  // Profile allocation sites, and write them into the file.
+      if (++ii >= argc) {
+        cerr << "'-a' takes parameter" << endl;
+        exit(1);
+      }
+      allocProfileFileName = argv[ii];
+      break;
     case 'C':  // Compile, and not run the code.
       bCompile = true;
       bNoRun = true;
@@ -336,19 +374,24 @@ int main(int argc, char* argv[]) {
   if (bCompile && !bDebug)
     tmpFd = reopenFile(stdout, "/dev/null", "w");
 
+  if (profileFileName != NULL && !state->startProfile()) {
+    cerr << "Can't start profiler" << endl;
+    exit(1);
+  }
+  if (allocProfileFileName != NULL)
+    state->startAllocProfile();
+
+  bool succeeded = true;
   if (oneLinear != NULL) {
     StrStream stream(oneLinear);
     repl(state, &stream, false);
   } else if (ii >= argc) {
     FileStream stream(stdin);
-    bool result;
-    if (bBinary)        result = runBinary(state, &stream);
-    else if (bCompile)  result = compile(state, &stream, bNoRun, outFp);
-    else                result = repl(state, &stream, isatty(0) != 0);
-    if (!result)
-      exit(1);
+    if (bBinary)        succeeded = runBinary(state, &stream);
+    else if (bCompile)  succeeded = compile(state, &stream, bNoRun, outFp);
+    else                succeeded = repl(state, &stream, isatty(0) != 0);
   } else if (bCompile) {
-    for (; ii < argc; ++ii) {
+    for (; succeeded && ii < argc; ++ii) {
       if (strcmp(argv[ii], "--") == 0) {
         ++ii;
         break;
@@ -356,19 +399,30 @@ int main(int argc, char* argv[]) {
       FileStream stream(argv[ii], "r");
       if (!stream.isOpened()) {
         std::cerr << "File not found: " << argv[ii] << std::endl;
-        exit(1);
+        succeeded = false;
+      } else {
+        succeeded = compile(state, &stream, bNoRun, outFp);
       }
-      if (!compile(state, &stream, bNoRun, outFp))
-        exit(1);
     }
   } else if (bBinary) {
-    exitIfError(state->runBinaryFromFile(argv[ii++]));
+    succeeded = checkError(state->runBinaryFromFile(argv[ii++]));
   } else {
-    exitIfError(state->runFromFile(argv[ii++]));
+    succeeded = checkError(state->runFromFile(argv[ii++]));
   }
-  if (!bCompile)
-    if (!runMain(state, argc - ii, &argv[ii], NULL))
-      exit(1);
+  if (succeeded && !bCompile)
+    succeeded = runMain(state, argc - ii, &argv[ii], NULL);
+
+  // Profiles are written even if the run fails.
+  if (profileFileName != NULL) {
+    state->stopProfile();
+    writeProfile(state, profileFileName);
+  }
+  if (allocProfileFileName != NULL) {
+    state->stopAllocProfile();
+    writeAllocProfile(state, allocProfileFileName);
+  }
+  if (!succeeded)
+    exit(1);
 
   fclose(outFp);
   if (tmpFd >= 0)